@@ -1,8 +1,10 @@
 #include "hwire.h"
 #include "inputs.h"
 #include <catch2/catch_all.hpp>
+#include <algorithm>
 #include <stdio.h>
 #include <string.h>
+#include <string>
 
 #define MAX_KEY_LEN 256
 
@@ -44,6 +46,313 @@ static void bench_hwire_lc(const unsigned char *data, size_t len)
                         UINT8_MAX);
 }
 
+static void bench_hwire_framing(const unsigned char *data, size_t len,
+                                unsigned int options)
+{
+    size_t pos         = 0;
+    hwire_framing_t fr = {0};
+    hwire_ctx_t cb     = {0};
+    cb.framing         = &fr;
+    cb.options         = options;
+    cb.header_cb   = dummy_header_cb;
+    cb.request_cb  = dummy_request_cb;
+    hwire_parse_request(&cb, (const char *)data, len, &pos, UINT16_MAX,
+                        UINT8_MAX);
+}
+
+static int dummy_body_cb(hwire_ctx_t *ctx, const char *data, size_t len)
+{
+    (void)ctx;
+    (void)data;
+    (void)len;
+    return 0;
+}
+
+static void bench_hwire_msg(const unsigned char *data, size_t len)
+{
+    size_t pos = 0;
+    hwire_msg_parser_t msg;
+    hwire_ctx_t cb = {0};
+    cb.header_cb   = dummy_header_cb;
+    cb.request_cb  = dummy_request_cb;
+    cb.body_cb     = dummy_body_cb;
+    hwire_msg_init(&msg, 0, UINT16_MAX, UINT8_MAX, UINT8_MAX);
+    hwire_msg_parse(&msg, &cb, (const char *)data, len, &pos);
+}
+
+static unsigned int bench_hwire_list(const unsigned char *data, size_t len)
+{
+    size_t pos         = 0;
+    unsigned int total = 0;
+    hwire_list_elem_t elem;
+    while (hwire_list_next(NULL, (const char *)data, len, &pos, &elem) == 1) {
+        total += elem.q;
+    }
+    return total;
+}
+
+#if defined(HWIRE_RING)
+static std::string pipeline_stream(void)
+{
+    std::string stream;
+    for (int i = 0; i < PIPELINE_COUNT; i++) {
+        stream.append((const char *)REQ_HDR_8, sizeof(REQ_HDR_8) - 1);
+    }
+    return stream;
+}
+
+static void pipeline_ctx(hwire_ctx_t *cb)
+{
+    *cb            = hwire_ctx_t{};
+    cb->header_cb  = dummy_header_cb;
+    cb->request_cb = dummy_request_cb;
+    cb->body_cb    = dummy_body_cb;
+}
+
+// linear buffer: the unparsed tail is moved to the front after each read
+static size_t bench_pipeline_compact(const std::string &stream, char *buf)
+{
+    hwire_ctx_t cb;
+    hwire_msg_parser_t msg;
+    size_t len   = 0;
+    size_t sent  = 0;
+    size_t nmsgs = 0;
+    pipeline_ctx(&cb);
+    hwire_msg_init(&msg, 0, UINT16_MAX, UINT8_MAX, UINT8_MAX);
+    while (sent < stream.size()) {
+        size_t n = std::min<size_t>(PIPELINE_READ, PIPELINE_BUF - len);
+        n        = std::min(n, stream.size() - sent);
+        memcpy(buf + len, stream.data() + sent, n); // recv()
+        len += n;
+        sent += n;
+
+        size_t off = 0;
+        size_t pos = 0;
+        while (hwire_msg_parse(&msg, &cb, buf + off, len - off, &pos) ==
+               HWIRE_OK) {
+            off += pos;
+            nmsgs++;
+            hwire_msg_init(&msg, 0, UINT16_MAX, UINT8_MAX, UINT8_MAX);
+        }
+        off += pos;
+        memmove(buf, buf + off, len - off);
+        len -= off;
+    }
+    return nmsgs;
+}
+
+// mirrored ring: unread data is parsed in place, even when it wraps
+static size_t bench_pipeline_ring(const std::string &stream, hwire_ring_t *ring)
+{
+    hwire_ctx_t cb;
+    hwire_msg_parser_t msg;
+    size_t sent  = 0;
+    size_t nmsgs = 0;
+    pipeline_ctx(&cb);
+    hwire_msg_init(&msg, 0, UINT16_MAX, UINT8_MAX, UINT8_MAX);
+    while (sent < stream.size()) {
+        size_t n = 0;
+        char *w  = hwire_ring_wbuf(ring, &n);
+        n        = std::min<size_t>(n, PIPELINE_READ);
+        n        = std::min(n, stream.size() - sent);
+        memcpy(w, stream.data() + sent, n); // recv()
+        hwire_ring_commit(ring, n);
+        sent += n;
+
+        while (hwire_ring_msg_parse(ring, &msg, &cb) == HWIRE_OK) {
+            nmsgs++;
+            hwire_msg_init(&msg, 0, UINT16_MAX, UINT8_MAX, UINT8_MAX);
+        }
+    }
+    hwire_ring_consume(ring, ring->len);
+    return nmsgs;
+}
+#endif
+
+// one file part of MULTIPART_SIZE pseudo-random bytes
+static std::string multipart_body(void)
+{
+    std::string body = "--" MULTIPART_BOUNDARY "\r\n"
+                       "Content-Disposition: form-data; name=\"file\"; "
+                       "filename=\"upload.bin\"\r\n"
+                       "Content-Type: application/octet-stream\r\n"
+                       "\r\n";
+    uint32_t x       = 2463534242u;
+    body.reserve(body.size() + MULTIPART_SIZE + 64);
+    for (size_t i = 0; i < MULTIPART_SIZE; i++) {
+        // xorshift32
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        body.push_back((char)(x >> 24));
+    }
+    body.append("\r\n--" MULTIPART_BOUNDARY "--\r\n");
+    return body;
+}
+
+static int sum_body_cb(hwire_ctx_t *ctx, const char *data, size_t len)
+{
+    (void)data;
+    *(size_t *)ctx->uctx += len;
+    return 0;
+}
+
+static size_t bench_multipart(const std::string &body)
+{
+    hwire_ctx_t cb = hwire_ctx_t{};
+    hwire_multipart_t mp;
+    size_t total = 0;
+    size_t start = 0;
+    size_t avail = 0;
+    int rv       = HWIRE_EAGAIN;
+    cb.uctx      = &total;
+    cb.header_cb = dummy_header_cb;
+    cb.body_cb   = sum_body_cb;
+    hwire_multipart_init(&mp, MULTIPART_BOUNDARY,
+                         sizeof(MULTIPART_BOUNDARY) - 1, UINT16_MAX,
+                         UINT8_MAX);
+    while (rv == HWIRE_EAGAIN && avail < body.size()) {
+        size_t pos = 0;
+        avail      = std::min<size_t>(avail + MULTIPART_READ, body.size());
+        rv = hwire_multipart_parse(&mp, &cb, body.data() + start,
+                                   avail - start, &pos);
+        start += pos;
+    }
+    return total;
+}
+
+// the same windows searched with memmem, holding back a partial delimiter
+static size_t bench_multipart_memmem(const std::string &body)
+{
+    static const char delim[] = "\r\n--" MULTIPART_BOUNDARY;
+    const size_t dlen         = sizeof(delim) - 1;
+    const char *data          = body.data();
+    size_t start              = body.find("\r\n\r\n") + 4;
+    size_t avail              = start;
+    size_t total              = 0;
+    while (avail < body.size()) {
+        avail = std::min<size_t>(avail + MULTIPART_READ, body.size());
+        const char *d =
+            (const char *)memmem(data + start, avail - start, delim, dlen);
+        if (d != NULL) {
+            total += (size_t)(d - (data + start));
+            break;
+        }
+        size_t n = (avail - start >= dlen) ? avail - start - (dlen - 1) : 0;
+        total += n;
+        start += n;
+    }
+    return total;
+}
+
+static int count_header_cb(hwire_ctx_t *ctx, hwire_header_t *header)
+{
+    (void)header;
+    (*(size_t *)ctx->uctx)++;
+    return 0;
+}
+
+// decode the header blocks of three requests on a new connection
+static size_t bench_hpack(void)
+{
+    static hwire_hpack_entry_t entries[128];
+    static char table[8192];
+    static char scratch[1024];
+    char key_buf[MAX_KEY_LEN];
+    hwire_hpack_t hp = hwire_hpack_t{};
+    hwire_ctx_t cb   = hwire_ctx_t{};
+    size_t nfields   = 0;
+    hp.entries       = entries;
+    hp.nentries      = 128;
+    hp.table.buf     = table;
+    hp.table.size    = sizeof(table);
+    hp.scratch.buf   = scratch;
+    hp.scratch.size  = sizeof(scratch);
+    cb.key_lc.buf    = key_buf;
+    cb.key_lc.size   = sizeof(key_buf);
+    cb.uctx          = &nfields;
+    cb.header_cb     = count_header_cb;
+    hwire_hpack_init(&hp, 4096);
+    hwire_hpack_decode(&hp, &cb, (const char *)HPACK_REQ_FIRST,
+                       sizeof(HPACK_REQ_FIRST), UINT16_MAX, UINT8_MAX);
+    for (int i = 0; i < 2; i++) {
+        hwire_hpack_decode(&hp, &cb, (const char *)HPACK_REQ_NEXT,
+                           sizeof(HPACK_REQ_NEXT), UINT16_MAX, UINT8_MAX);
+    }
+    return nfields;
+}
+
+// frames of H2_FRAMES_REQS requests on odd stream identifiers
+static std::string h2_frames(void)
+{
+    std::string buf;
+    for (uint32_t sid = 1; sid < 2 * H2_FRAMES_REQS; sid += 2) {
+        const char id[4] = {0, 0, (char)(sid >> 8), (char)sid};
+        buf.append("\x00\x00", 2);
+        buf.push_back((char)sizeof(HPACK_REQ_NEXT));
+        buf.append("\x01\x04", 2);
+        buf.append(id, 4);
+        buf.append((const char *)HPACK_REQ_NEXT, sizeof(HPACK_REQ_NEXT));
+        buf.append("\x00\x00", 2);
+        buf.push_back((char)H2_FRAMES_DATA);
+        buf.append("\x00\x01", 2);
+        buf.append(id, 4);
+        buf.append(H2_FRAMES_DATA, 'x');
+        buf.append("\x00\x00\x04\x08\x00\x00\x00\x00\x00", 9);
+        buf.append("\x00\x00\x00\x40", 4);
+    }
+    return buf;
+}
+
+// count the frames of buf, H2_FRAMES_BATCH at a time or one by one
+static size_t bench_h2_frames(const std::string &buf, size_t batch)
+{
+    hwire_h2_frame_t frames[H2_FRAMES_BATCH];
+    size_t nframes = 0;
+    size_t cur     = 0;
+
+    while (cur < buf.size()) {
+        size_t pos = 0;
+        size_t n   = batch;
+        if (batch > 1) {
+            hwire_h2_parse_frames(buf.data() + cur, buf.size() - cur, &pos,
+                                  HWIRE_H2_MIN_FRAME_SIZE, frames, &n);
+        } else {
+            hwire_h2_parse_frame(buf.data() + cur, buf.size() - cur, &pos,
+                                 HWIRE_H2_MIN_FRAME_SIZE, frames);
+        }
+        for (size_t i = 0; i < n; i++) {
+            nframes += frames[i].payload.len > 0;
+        }
+        cur += pos;
+    }
+    return nframes;
+}
+
+static const uint8_t WS_MASK[4] = {0x37, 0xfa, 0x21, 0x3d};
+
+static unsigned char bench_ws_unmask(std::string &buf)
+{
+    hwire_ws_unmask(&buf[1], buf.size() - 1, WS_MASK, 1);
+    return (unsigned char)buf[buf.size() / 2];
+}
+
+static unsigned char bench_ws_unmask_bytes(std::string &buf)
+{
+    for (size_t i = 1; i < buf.size(); i++) {
+        buf[i] = (char)(buf[i] ^ WS_MASK[i & 3]);
+    }
+    return (unsigned char)buf[buf.size() / 2];
+}
+
+static void bench_hwire_scan(const unsigned char *data, size_t len)
+{
+    size_t pos = 0;
+    hwire_msginfo_t info;
+    hwire_scan_message((const char *)data, len, &pos, UINT16_MAX, UINT8_MAX,
+                       0, &info);
+}
+
 TEST_CASE("Header Count, 8 Headers", "[req][header-count][8-headers]")
 {
     char n[32];
@@ -57,6 +366,11 @@ TEST_CASE("Header Count, 8 Headers", "[req][header-count][8-headers]")
     {
         return bench_hwire_lc(REQ_HDR_8, sizeof(REQ_HDR_8) - 1);
     };
+    snprintf(n, sizeof(n), "%zu B, Scan", sizeof(REQ_HDR_8) - 1);
+    BENCHMARK(n)
+    {
+        return bench_hwire_scan(REQ_HDR_8, sizeof(REQ_HDR_8) - 1);
+    };
 }
 
 TEST_CASE("Header Count, 15 Headers", "[req][header-count][15-headers]")
@@ -72,6 +386,11 @@ TEST_CASE("Header Count, 15 Headers", "[req][header-count][15-headers]")
     {
         return bench_hwire_lc(REQ_HDR_15, sizeof(REQ_HDR_15) - 1);
     };
+    snprintf(n, sizeof(n), "%zu B, Scan", sizeof(REQ_HDR_15) - 1);
+    BENCHMARK(n)
+    {
+        return bench_hwire_scan(REQ_HDR_15, sizeof(REQ_HDR_15) - 1);
+    };
 }
 
 TEST_CASE("Header Count, 20 Headers", "[req][header-count][20-headers]")
@@ -87,6 +406,11 @@ TEST_CASE("Header Count, 20 Headers", "[req][header-count][20-headers]")
     {
         return bench_hwire_lc(REQ_HDR_20, sizeof(REQ_HDR_20) - 1);
     };
+    snprintf(n, sizeof(n), "%zu B, Scan", sizeof(REQ_HDR_20) - 1);
+    BENCHMARK(n)
+    {
+        return bench_hwire_scan(REQ_HDR_20, sizeof(REQ_HDR_20) - 1);
+    };
 }
 
 TEST_CASE("Header Count, 28 Headers", "[req][header-count][28-headers]")
@@ -102,6 +426,11 @@ TEST_CASE("Header Count, 28 Headers", "[req][header-count][28-headers]")
     {
         return bench_hwire_lc(REQ_HDR_28, sizeof(REQ_HDR_28) - 1);
     };
+    snprintf(n, sizeof(n), "%zu B, Scan", sizeof(REQ_HDR_28) - 1);
+    BENCHMARK(n)
+    {
+        return bench_hwire_scan(REQ_HDR_28, sizeof(REQ_HDR_28) - 1);
+    };
 }
 
 TEST_CASE("Header Value Length, Short Values",
@@ -118,6 +447,11 @@ TEST_CASE("Header Value Length, Short Values",
     {
         return bench_hwire_lc(REQ_VAL_SHORT, sizeof(REQ_VAL_SHORT) - 1);
     };
+    snprintf(n, sizeof(n), "%zu B, Scan", sizeof(REQ_VAL_SHORT) - 1);
+    BENCHMARK(n)
+    {
+        return bench_hwire_scan(REQ_VAL_SHORT, sizeof(REQ_VAL_SHORT) - 1);
+    };
 }
 
 TEST_CASE("Header Value Length, Medium Values",
@@ -134,6 +468,11 @@ TEST_CASE("Header Value Length, Medium Values",
     {
         return bench_hwire_lc(REQ_VAL_MEDIUM, sizeof(REQ_VAL_MEDIUM) - 1);
     };
+    snprintf(n, sizeof(n), "%zu B, Scan", sizeof(REQ_VAL_MEDIUM) - 1);
+    BENCHMARK(n)
+    {
+        return bench_hwire_scan(REQ_VAL_MEDIUM, sizeof(REQ_VAL_MEDIUM) - 1);
+    };
 }
 
 TEST_CASE("Header Value Length, Long Values",
@@ -150,6 +489,11 @@ TEST_CASE("Header Value Length, Long Values",
     {
         return bench_hwire_lc(REQ_VAL_LONG, sizeof(REQ_VAL_LONG) - 1);
     };
+    snprintf(n, sizeof(n), "%zu B, Scan", sizeof(REQ_VAL_LONG) - 1);
+    BENCHMARK(n)
+    {
+        return bench_hwire_scan(REQ_VAL_LONG, sizeof(REQ_VAL_LONG) - 1);
+    };
 }
 
 TEST_CASE("Header Value Length, Extra Long Values",
@@ -166,6 +510,11 @@ TEST_CASE("Header Value Length, Extra Long Values",
     {
         return bench_hwire_lc(REQ_VAL_XLONG, sizeof(REQ_VAL_XLONG) - 1);
     };
+    snprintf(n, sizeof(n), "%zu B, Scan", sizeof(REQ_VAL_XLONG) - 1);
+    BENCHMARK(n)
+    {
+        return bench_hwire_scan(REQ_VAL_XLONG, sizeof(REQ_VAL_XLONG) - 1);
+    };
 }
 
 TEST_CASE("Case Sensitivity, All Lowercase",
@@ -182,6 +531,11 @@ TEST_CASE("Case Sensitivity, All Lowercase",
     {
         return bench_hwire_lc(REQ_CASE_LOWER, sizeof(REQ_CASE_LOWER) - 1);
     };
+    snprintf(n, sizeof(n), "%zu B, Scan", sizeof(REQ_CASE_LOWER) - 1);
+    BENCHMARK(n)
+    {
+        return bench_hwire_scan(REQ_CASE_LOWER, sizeof(REQ_CASE_LOWER) - 1);
+    };
 }
 
 TEST_CASE("Case Sensitivity, Mixed Case", "[req][case-sensitivity][mixed-case]")
@@ -197,6 +551,11 @@ TEST_CASE("Case Sensitivity, Mixed Case", "[req][case-sensitivity][mixed-case]")
     {
         return bench_hwire_lc(REQ_CASE_MIXED, sizeof(REQ_CASE_MIXED) - 1);
     };
+    snprintf(n, sizeof(n), "%zu B, Scan", sizeof(REQ_CASE_MIXED) - 1);
+    BENCHMARK(n)
+    {
+        return bench_hwire_scan(REQ_CASE_MIXED, sizeof(REQ_CASE_MIXED) - 1);
+    };
 }
 
 TEST_CASE("Real-World Requests, Browser", "[req][real-world][browser]")
@@ -212,6 +571,11 @@ TEST_CASE("Real-World Requests, Browser", "[req][real-world][browser]")
     {
         return bench_hwire_lc(REQ_REAL_BROWSER, sizeof(REQ_REAL_BROWSER) - 1);
     };
+    snprintf(n, sizeof(n), "%zu B, Scan", sizeof(REQ_REAL_BROWSER) - 1);
+    BENCHMARK(n)
+    {
+        return bench_hwire_scan(REQ_REAL_BROWSER, sizeof(REQ_REAL_BROWSER) - 1);
+    };
 }
 
 TEST_CASE("Real-World Requests, REST API", "[req][real-world][rest-api]")
@@ -227,6 +591,11 @@ TEST_CASE("Real-World Requests, REST API", "[req][real-world][rest-api]")
     {
         return bench_hwire_lc(REQ_REAL_API, sizeof(REQ_REAL_API) - 1);
     };
+    snprintf(n, sizeof(n), "%zu B, Scan", sizeof(REQ_REAL_API) - 1);
+    BENCHMARK(n)
+    {
+        return bench_hwire_scan(REQ_REAL_API, sizeof(REQ_REAL_API) - 1);
+    };
 }
 
 TEST_CASE("Real-World Requests, Mobile App", "[req][real-world][mobile-app]")
@@ -242,6 +611,11 @@ TEST_CASE("Real-World Requests, Mobile App", "[req][real-world][mobile-app]")
     {
         return bench_hwire_lc(REQ_REAL_MOBILE, sizeof(REQ_REAL_MOBILE) - 1);
     };
+    snprintf(n, sizeof(n), "%zu B, Scan", sizeof(REQ_REAL_MOBILE) - 1);
+    BENCHMARK(n)
+    {
+        return bench_hwire_scan(REQ_REAL_MOBILE, sizeof(REQ_REAL_MOBILE) - 1);
+    };
 }
 
 TEST_CASE("Baseline, No Headers", "[req][baseline][no-headers]")
@@ -257,6 +631,11 @@ TEST_CASE("Baseline, No Headers", "[req][baseline][no-headers]")
     {
         return bench_hwire_lc(REQ_MINIMAL, sizeof(REQ_MINIMAL) - 1);
     };
+    snprintf(n, sizeof(n), "%zu B, Scan", sizeof(REQ_MINIMAL) - 1);
+    BENCHMARK(n)
+    {
+        return bench_hwire_scan(REQ_MINIMAL, sizeof(REQ_MINIMAL) - 1);
+    };
 }
 
 TEST_CASE("Baseline, Host Only", "[req][baseline][host-only]")
@@ -272,4 +651,178 @@ TEST_CASE("Baseline, Host Only", "[req][baseline][host-only]")
     {
         return bench_hwire_lc(REQ_MINIMAL_HOST, sizeof(REQ_MINIMAL_HOST) - 1);
     };
+    snprintf(n, sizeof(n), "%zu B, Scan", sizeof(REQ_MINIMAL_HOST) - 1);
+    BENCHMARK(n)
+    {
+        return bench_hwire_scan(REQ_MINIMAL_HOST, sizeof(REQ_MINIMAL_HOST) - 1);
+    };
+}
+
+TEST_CASE("Baseline, Long URI", "[req][baseline][long-uri]")
+{
+    char n[32];
+    snprintf(n, sizeof(n), "%zu B", sizeof(REQ_LONG_URI) - 1);
+    BENCHMARK(n)
+    {
+        return bench_hwire(REQ_LONG_URI, sizeof(REQ_LONG_URI) - 1);
+    };
+    snprintf(n, sizeof(n), "%zu B, LC", sizeof(REQ_LONG_URI) - 1);
+    BENCHMARK(n)
+    {
+        return bench_hwire_lc(REQ_LONG_URI, sizeof(REQ_LONG_URI) - 1);
+    };
+    snprintf(n, sizeof(n), "%zu B, Scan", sizeof(REQ_LONG_URI) - 1);
+    BENCHMARK(n)
+    {
+        return bench_hwire_scan(REQ_LONG_URI, sizeof(REQ_LONG_URI) - 1);
+    };
+}
+
+TEST_CASE("Message Body, Content-Length", "[req][message-body][content-length]")
+{
+    char n[32];
+    snprintf(n, sizeof(n), "%zu B", sizeof(REQ_BODY_CL) - 1);
+    BENCHMARK(n)
+    {
+        return bench_hwire_msg(REQ_BODY_CL, sizeof(REQ_BODY_CL) - 1);
+    };
+}
+
+TEST_CASE("Message Body, Chunked", "[req][message-body][chunked]")
+{
+    char n[32];
+    snprintf(n, sizeof(n), "%zu B", sizeof(REQ_BODY_CHUNKED) - 1);
+    BENCHMARK(n)
+    {
+        return bench_hwire_msg(REQ_BODY_CHUNKED, sizeof(REQ_BODY_CHUNKED) - 1);
+    };
+}
+
+TEST_CASE("Hardened Mode, 28 Headers", "[req][hardened][28-headers]")
+{
+    char n[32];
+    snprintf(n, sizeof(n), "%zu B", sizeof(REQ_HDR_28) - 1);
+    BENCHMARK(n)
+    {
+        return bench_hwire(REQ_HDR_28, sizeof(REQ_HDR_28) - 1);
+    };
+    snprintf(n, sizeof(n), "%zu B, Framing", sizeof(REQ_HDR_28) - 1);
+    BENCHMARK(n)
+    {
+        return bench_hwire_framing(REQ_HDR_28, sizeof(REQ_HDR_28) - 1, 0);
+    };
+    snprintf(n, sizeof(n), "%zu B, Hardened", sizeof(REQ_HDR_28) - 1);
+    BENCHMARK(n)
+    {
+        return bench_hwire_framing(REQ_HDR_28, sizeof(REQ_HDR_28) - 1,
+                                   HWIRE_OPT_HARDENED);
+    };
+}
+
+TEST_CASE("Field Value Lists, Accept", "[req][list][accept]")
+{
+    char n[32];
+    snprintf(n, sizeof(n), "%zu B", sizeof(LIST_ACCEPT) - 1);
+    BENCHMARK(n)
+    {
+        return bench_hwire_list(LIST_ACCEPT, sizeof(LIST_ACCEPT) - 1);
+    };
+}
+
+#if defined(HWIRE_RING)
+TEST_CASE("Pipelining, Keep-Alive", "[req][pipelining][keep-alive]")
+{
+    static char buf[PIPELINE_BUF];
+    const std::string stream = pipeline_stream();
+    hwire_ring_t ring;
+    char n[48];
+
+    REQUIRE(hwire_ring_init(&ring, PIPELINE_BUF) == HWIRE_OK);
+    snprintf(n, sizeof(n), "%zu B, Compaction", stream.size());
+    BENCHMARK(n)
+    {
+        return bench_pipeline_compact(stream, buf);
+    };
+    snprintf(n, sizeof(n), "%zu B, Ring", stream.size());
+    BENCHMARK(n)
+    {
+        return bench_pipeline_ring(stream, &ring);
+    };
+    hwire_ring_free(&ring);
+}
+#endif
+
+TEST_CASE("Multipart, 100 MB Upload", "[req][multipart][upload]")
+{
+    static const std::string body = multipart_body();
+    char n[48];
+
+    REQUIRE(bench_multipart(body) == MULTIPART_SIZE);
+    REQUIRE(bench_multipart_memmem(body) == MULTIPART_SIZE);
+    snprintf(n, sizeof(n), "%zu B, hwire", body.size());
+    BENCHMARK(n)
+    {
+        return bench_multipart(body);
+    };
+    snprintf(n, sizeof(n), "%zu B, memmem", body.size());
+    BENCHMARK(n)
+    {
+        return bench_multipart_memmem(body);
+    };
+}
+
+TEST_CASE("HPACK, Browser Navigation", "[req][hpack][navigation]")
+{
+    char n[48];
+
+    REQUIRE(bench_hpack() == 3 * 17);
+    snprintf(n, sizeof(n), "%zu B",
+             sizeof(HPACK_REQ_FIRST) + 2 * sizeof(HPACK_REQ_NEXT));
+    BENCHMARK(n)
+    {
+        return bench_hpack();
+    };
+}
+
+TEST_CASE("HTTP/2 Frames, Request Stream", "[req][h2][frames]")
+{
+    static const std::string buf = h2_frames();
+    char n[48];
+
+    REQUIRE(bench_h2_frames(buf, H2_FRAMES_BATCH) == 3 * H2_FRAMES_REQS);
+    REQUIRE(bench_h2_frames(buf, 1) == 3 * H2_FRAMES_REQS);
+    snprintf(n, sizeof(n), "%zu B, hwire batch", buf.size());
+    BENCHMARK(n)
+    {
+        return bench_h2_frames(buf, H2_FRAMES_BATCH);
+    };
+    snprintf(n, sizeof(n), "%zu B, hwire", buf.size());
+    BENCHMARK(n)
+    {
+        return bench_h2_frames(buf, 1);
+    };
+}
+
+TEST_CASE("WebSocket, Unmask 1 MiB", "[req][websocket][unmask]")
+{
+    static std::string buf(WS_UNMASK_SIZE + 1, 'x');
+    const std::string orig = buf;
+    std::string ref        = buf;
+    char n[48];
+
+    // both XOR the same key stream
+    bench_ws_unmask(buf);
+    bench_ws_unmask_bytes(ref);
+    REQUIRE(buf != orig);
+    REQUIRE(buf == ref);
+    snprintf(n, sizeof(n), "%u B, hwire", WS_UNMASK_SIZE);
+    BENCHMARK(n)
+    {
+        return bench_ws_unmask(buf);
+    };
+    snprintf(n, sizeof(n), "%u B, byte loop", WS_UNMASK_SIZE);
+    BENCHMARK(n)
+    {
+        return bench_ws_unmask_bytes(buf);
+    };
 }
@@ -44,6 +44,14 @@ static void bench_hwire_resp_lc(const unsigned char *data, size_t len)
                          UINT8_MAX);
 }
 
+static void bench_hwire_resp_scan(const unsigned char *data, size_t len)
+{
+    size_t pos = 0;
+    hwire_msginfo_t info;
+    hwire_scan_message((const char *)data, len, &pos, UINT16_MAX, UINT8_MAX,
+                       HWIRE_SCAN_RESPONSE, &info);
+}
+
 TEST_CASE("Header Count, 4 Headers", "[resp][header-count][4-headers]")
 {
     char n[32];
@@ -57,6 +65,11 @@ TEST_CASE("Header Count, 4 Headers", "[resp][header-count][4-headers]")
     {
         return bench_hwire_resp_lc(RSP_HDR_4, sizeof(RSP_HDR_4) - 1);
     };
+    snprintf(n, sizeof(n), "%zu B, Scan", sizeof(RSP_HDR_4) - 1);
+    BENCHMARK(n)
+    {
+        return bench_hwire_resp_scan(RSP_HDR_4, sizeof(RSP_HDR_4) - 1);
+    };
 }
 
 TEST_CASE("Header Count, 8 Headers", "[resp][header-count][8-headers]")
@@ -72,6 +85,11 @@ TEST_CASE("Header Count, 8 Headers", "[resp][header-count][8-headers]")
     {
         return bench_hwire_resp_lc(RSP_HDR_8, sizeof(RSP_HDR_8) - 1);
     };
+    snprintf(n, sizeof(n), "%zu B, Scan", sizeof(RSP_HDR_8) - 1);
+    BENCHMARK(n)
+    {
+        return bench_hwire_resp_scan(RSP_HDR_8, sizeof(RSP_HDR_8) - 1);
+    };
 }
 
 TEST_CASE("Header Count, 12 Headers", "[resp][header-count][12-headers]")
@@ -87,6 +105,11 @@ TEST_CASE("Header Count, 12 Headers", "[resp][header-count][12-headers]")
     {
         return bench_hwire_resp_lc(RSP_HDR_12, sizeof(RSP_HDR_12) - 1);
     };
+    snprintf(n, sizeof(n), "%zu B, Scan", sizeof(RSP_HDR_12) - 1);
+    BENCHMARK(n)
+    {
+        return bench_hwire_resp_scan(RSP_HDR_12, sizeof(RSP_HDR_12) - 1);
+    };
 }
 
 TEST_CASE("Header Count, 20 Headers", "[resp][header-count][20-headers]")
@@ -102,6 +125,11 @@ TEST_CASE("Header Count, 20 Headers", "[resp][header-count][20-headers]")
     {
         return bench_hwire_resp_lc(RSP_HDR_20, sizeof(RSP_HDR_20) - 1);
     };
+    snprintf(n, sizeof(n), "%zu B, Scan", sizeof(RSP_HDR_20) - 1);
+    BENCHMARK(n)
+    {
+        return bench_hwire_resp_scan(RSP_HDR_20, sizeof(RSP_HDR_20) - 1);
+    };
 }
 
 TEST_CASE("Header Value Length, Short Values",
@@ -118,6 +146,11 @@ TEST_CASE("Header Value Length, Short Values",
     {
         return bench_hwire_resp_lc(RSP_VAL_SHORT, sizeof(RSP_VAL_SHORT) - 1);
     };
+    snprintf(n, sizeof(n), "%zu B, Scan", sizeof(RSP_VAL_SHORT) - 1);
+    BENCHMARK(n)
+    {
+        return bench_hwire_resp_scan(RSP_VAL_SHORT, sizeof(RSP_VAL_SHORT) - 1);
+    };
 }
 
 TEST_CASE("Header Value Length, Medium Values",
@@ -134,6 +167,12 @@ TEST_CASE("Header Value Length, Medium Values",
     {
         return bench_hwire_resp_lc(RSP_VAL_MEDIUM, sizeof(RSP_VAL_MEDIUM) - 1);
     };
+    snprintf(n, sizeof(n), "%zu B, Scan", sizeof(RSP_VAL_MEDIUM) - 1);
+    BENCHMARK(n)
+    {
+        return bench_hwire_resp_scan(RSP_VAL_MEDIUM,
+                                     sizeof(RSP_VAL_MEDIUM) - 1);
+    };
 }
 
 TEST_CASE("Header Value Length, Long Values",
@@ -150,6 +189,11 @@ TEST_CASE("Header Value Length, Long Values",
     {
         return bench_hwire_resp_lc(RSP_VAL_LONG, sizeof(RSP_VAL_LONG) - 1);
     };
+    snprintf(n, sizeof(n), "%zu B, Scan", sizeof(RSP_VAL_LONG) - 1);
+    BENCHMARK(n)
+    {
+        return bench_hwire_resp_scan(RSP_VAL_LONG, sizeof(RSP_VAL_LONG) - 1);
+    };
 }
 
 TEST_CASE("Header Value Length, Extra Long Values",
@@ -166,6 +210,11 @@ TEST_CASE("Header Value Length, Extra Long Values",
     {
         return bench_hwire_resp_lc(RSP_VAL_XLONG, sizeof(RSP_VAL_XLONG) - 1);
     };
+    snprintf(n, sizeof(n), "%zu B, Scan", sizeof(RSP_VAL_XLONG) - 1);
+    BENCHMARK(n)
+    {
+        return bench_hwire_resp_scan(RSP_VAL_XLONG, sizeof(RSP_VAL_XLONG) - 1);
+    };
 }
 
 TEST_CASE("Case Sensitivity, All Lowercase",
@@ -182,6 +231,12 @@ TEST_CASE("Case Sensitivity, All Lowercase",
     {
         return bench_hwire_resp_lc(RSP_CASE_LOWER, sizeof(RSP_CASE_LOWER) - 1);
     };
+    snprintf(n, sizeof(n), "%zu B, Scan", sizeof(RSP_CASE_LOWER) - 1);
+    BENCHMARK(n)
+    {
+        return bench_hwire_resp_scan(RSP_CASE_LOWER,
+                                     sizeof(RSP_CASE_LOWER) - 1);
+    };
 }
 
 TEST_CASE("Case Sensitivity, Mixed Case",
@@ -198,6 +253,12 @@ TEST_CASE("Case Sensitivity, Mixed Case",
     {
         return bench_hwire_resp_lc(RSP_CASE_MIXED, sizeof(RSP_CASE_MIXED) - 1);
     };
+    snprintf(n, sizeof(n), "%zu B, Scan", sizeof(RSP_CASE_MIXED) - 1);
+    BENCHMARK(n)
+    {
+        return bench_hwire_resp_scan(RSP_CASE_MIXED,
+                                     sizeof(RSP_CASE_MIXED) - 1);
+    };
 }
 
 TEST_CASE("Real-World Responses, HTML Page", "[resp][real-world][html-page]")
@@ -213,6 +274,11 @@ TEST_CASE("Real-World Responses, HTML Page", "[resp][real-world][html-page]")
     {
         return bench_hwire_resp_lc(RSP_REAL_HTML, sizeof(RSP_REAL_HTML) - 1);
     };
+    snprintf(n, sizeof(n), "%zu B, Scan", sizeof(RSP_REAL_HTML) - 1);
+    BENCHMARK(n)
+    {
+        return bench_hwire_resp_scan(RSP_REAL_HTML, sizeof(RSP_REAL_HTML) - 1);
+    };
 }
 
 TEST_CASE("Real-World Responses, REST API", "[resp][real-world][rest-api]")
@@ -228,6 +294,11 @@ TEST_CASE("Real-World Responses, REST API", "[resp][real-world][rest-api]")
     {
         return bench_hwire_resp_lc(RSP_REAL_API, sizeof(RSP_REAL_API) - 1);
     };
+    snprintf(n, sizeof(n), "%zu B, Scan", sizeof(RSP_REAL_API) - 1);
+    BENCHMARK(n)
+    {
+        return bench_hwire_resp_scan(RSP_REAL_API, sizeof(RSP_REAL_API) - 1);
+    };
 }
 
 TEST_CASE("Real-World Responses, Static File",
@@ -260,6 +331,11 @@ TEST_CASE("Baseline, No Extra Headers", "[resp][baseline][no-extra-headers]")
     {
         return bench_hwire_resp_lc(RSP_MINIMAL, sizeof(RSP_MINIMAL) - 1);
     };
+    snprintf(n, sizeof(n), "%zu B, Scan", sizeof(RSP_MINIMAL) - 1);
+    BENCHMARK(n)
+    {
+        return bench_hwire_resp_scan(RSP_MINIMAL, sizeof(RSP_MINIMAL) - 1);
+    };
 }
 
 TEST_CASE("Baseline, Date Header Only", "[resp][baseline][date-header-only]")
@@ -277,3 +353,36 @@ TEST_CASE("Baseline, Date Header Only", "[resp][baseline][date-header-only]")
                                    sizeof(RSP_MINIMAL_DATE) - 1);
     };
 }
+
+TEST_CASE("Baseline, Not Modified", "[resp][baseline][not-modified]")
+{
+    char n[32];
+    snprintf(n, sizeof(n), "%zu B", sizeof(RSP_NOT_MODIFIED) - 1);
+    BENCHMARK(n)
+    {
+        return bench_hwire_resp(RSP_NOT_MODIFIED, sizeof(RSP_NOT_MODIFIED) - 1);
+    };
+    snprintf(n, sizeof(n), "%zu B, LC", sizeof(RSP_NOT_MODIFIED) - 1);
+    BENCHMARK(n)
+    {
+        return bench_hwire_resp_lc(RSP_NOT_MODIFIED,
+                                   sizeof(RSP_NOT_MODIFIED) - 1);
+    };
+}
+
+TEST_CASE("Baseline, Uncommon Status", "[resp][baseline][uncommon-status]")
+{
+    char n[32];
+    snprintf(n, sizeof(n), "%zu B", sizeof(RSP_UNCOMMON_STATUS) - 1);
+    BENCHMARK(n)
+    {
+        return bench_hwire_resp(RSP_UNCOMMON_STATUS,
+                                sizeof(RSP_UNCOMMON_STATUS) - 1);
+    };
+    snprintf(n, sizeof(n), "%zu B, LC", sizeof(RSP_UNCOMMON_STATUS) - 1);
+    BENCHMARK(n)
+    {
+        return bench_hwire_resp_lc(RSP_UNCOMMON_STATUS,
+                                   sizeof(RSP_UNCOMMON_STATUS) - 1);
+    };
+}
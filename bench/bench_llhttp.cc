@@ -40,6 +40,14 @@ static int on_headers_complete(llhttp_t *p)
     return 0;
 }
 
+static int on_body(llhttp_t *p, const char *at, size_t len)
+{
+    (void)p;
+    (void)at;
+    (void)len;
+    return 0;
+}
+
 static int on_message_complete(llhttp_t *p)
 {
     (void)p;
@@ -57,6 +65,7 @@ static void bench_llhttp(const unsigned char *data, size_t len)
     settings.on_header_field     = on_header_field;
     settings.on_header_value     = on_header_value;
     settings.on_headers_complete = on_headers_complete;
+    settings.on_body             = on_body;
     settings.on_message_complete = on_message_complete;
 
     llhttp_init(&parser, HTTP_REQUEST, &settings);
@@ -168,3 +177,24 @@ TEST_CASE("Baseline, Host Only", "[req][baseline][host-only]")
     BENCHMARK(n) { return bench_llhttp(REQ_MINIMAL_HOST, sizeof(REQ_MINIMAL_HOST) - 1); };
 }
 
+TEST_CASE("Baseline, Long URI", "[req][baseline][long-uri]")
+{
+    char n[32];
+    snprintf(n, sizeof(n), "%zu B", sizeof(REQ_LONG_URI) - 1);
+    BENCHMARK(n) { return bench_llhttp(REQ_LONG_URI, sizeof(REQ_LONG_URI) - 1); };
+}
+
+
+TEST_CASE("Message Body, Content-Length", "[req][message-body][content-length]")
+{
+    char n[32];
+    snprintf(n, sizeof(n), "%zu B", sizeof(REQ_BODY_CL) - 1);
+    BENCHMARK(n) { return bench_llhttp(REQ_BODY_CL, sizeof(REQ_BODY_CL) - 1); };
+}
+
+TEST_CASE("Message Body, Chunked", "[req][message-body][chunked]")
+{
+    char n[32];
+    snprintf(n, sizeof(n), "%zu B", sizeof(REQ_BODY_CHUNKED) - 1);
+    BENCHMARK(n) { return bench_llhttp(REQ_BODY_CHUNKED, sizeof(REQ_BODY_CHUNKED) - 1); };
+}
@@ -0,0 +1,62 @@
+#include "inputs.h"
+#include <catch2/catch_all.hpp>
+#include <nghttp2/nghttp2.h>
+#include <stdio.h>
+#include <string.h>
+
+// decode one header block, counting the emitted field lines
+static size_t inflate_block(nghttp2_hd_inflater *inf, const uint8_t *in,
+                            size_t len)
+{
+    size_t nfields = 0;
+    for (;;) {
+        nghttp2_nv nv;
+        int flags  = 0;
+        ssize_t rv = nghttp2_hd_inflate_hd2(inf, &nv, &flags, in, len, 1);
+        if (rv < 0) {
+            return 0;
+        }
+        in += rv;
+        len -= (size_t)rv;
+        if (flags & NGHTTP2_HD_INFLATE_EMIT) {
+            nfields++;
+        }
+        if (flags & NGHTTP2_HD_INFLATE_FINAL) {
+            nghttp2_hd_inflate_end_headers(inf);
+            return nfields;
+        }
+        if (rv == 0 && len == 0) {
+            return nfields;
+        }
+    }
+}
+
+// decode the header blocks of three requests on a new connection; as there
+// is no way to reset an inflater, creating one is part of the measurement
+static size_t bench_nghttp2_hpack(void)
+{
+    nghttp2_hd_inflater *inf = NULL;
+    size_t nfields           = 0;
+    if (nghttp2_hd_inflate_new(&inf) != 0) {
+        return 0;
+    }
+    nfields += inflate_block(inf, HPACK_REQ_FIRST, sizeof(HPACK_REQ_FIRST));
+    for (int i = 0; i < 2; i++) {
+        nfields += inflate_block(inf, HPACK_REQ_NEXT, sizeof(HPACK_REQ_NEXT));
+    }
+    nghttp2_hd_inflate_del(inf);
+    return nfields;
+}
+
+TEST_CASE("HPACK, Browser Navigation", "[req][hpack][navigation]")
+{
+    char n[32];
+
+    REQUIRE(bench_nghttp2_hpack() == 3 * 17);
+    snprintf(n, sizeof(n), "%zu B",
+             sizeof(HPACK_REQ_FIRST) + 2 * sizeof(HPACK_REQ_NEXT));
+    BENCHMARK(n)
+    {
+        return bench_nghttp2_hpack();
+    };
+}
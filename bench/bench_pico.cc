@@ -120,3 +120,10 @@ TEST_CASE("Baseline, Host Only", "[req][baseline][host-only]")
     BENCHMARK(n) { return bench_pico(REQ_MINIMAL_HOST, sizeof(REQ_MINIMAL_HOST) - 1); };
 }
 
+TEST_CASE("Baseline, Long URI", "[req][baseline][long-uri]")
+{
+    char n[32];
+    snprintf(n, sizeof(n), "%zu B", sizeof(REQ_LONG_URI) - 1);
+    BENCHMARK(n) { return bench_pico(REQ_LONG_URI, sizeof(REQ_LONG_URI) - 1); };
+}
+
@@ -120,3 +120,17 @@ TEST_CASE("Baseline, Date Header Only", "[resp][baseline][date-header-only]")
     BENCHMARK(n) { return bench_pico_resp(RSP_MINIMAL_DATE, sizeof(RSP_MINIMAL_DATE) - 1); };
 }
 
+TEST_CASE("Baseline, Not Modified", "[resp][baseline][not-modified]")
+{
+    char n[32];
+    snprintf(n, sizeof(n), "%zu B", sizeof(RSP_NOT_MODIFIED) - 1);
+    BENCHMARK(n) { return bench_pico_resp(RSP_NOT_MODIFIED, sizeof(RSP_NOT_MODIFIED) - 1); };
+}
+
+TEST_CASE("Baseline, Uncommon Status", "[resp][baseline][uncommon-status]")
+{
+    char n[32];
+    snprintf(n, sizeof(n), "%zu B", sizeof(RSP_UNCOMMON_STATUS) - 1);
+    BENCHMARK(n) { return bench_pico_resp(RSP_UNCOMMON_STATUS, sizeof(RSP_UNCOMMON_STATUS) - 1); };
+}
+
@@ -522,3 +522,168 @@ static unsigned char REQ_MINIMAL[] = "GET / HTTP/1.1\r\n"
 static unsigned char REQ_MINIMAL_HOST[] = "GET / HTTP/1.1\r\n"
                                           "Host: example.test\r\n"
                                           "\r\n";
+
+/* Long request-target (~330 chars, path + query) with Host */
+static unsigned char REQ_LONG_URI[] =
+    "GET /api/v2/organizations/acme-corporation/projects/website-redesign/"
+    "repositories/frontend-application/commits/"
+    "9f86d081884c7d659a2feaa0c55ad015a3bf4f1b2b0b822cd15d6c15b0f00a08/files"
+    "?path=src%2Fcomponents%2Fnavigation%2FHeader.tsx&include_diff=true"
+    "&context_lines=3&ignore_whitespace=false&page=1&per_page=100"
+    "&sort=modified&direction=desc HTTP/1.1\r\n"
+    "Host: example.test\r\n"
+    "\r\n";
+
+/* ============================================================================
+ * Category 6: Message Body
+ * Purpose: Full message parsing including body framing
+ * Control: Same 1 KiB JSON payload, fixed-length vs chunked (4 x 256 B)
+ * ============================================================================
+ */
+
+#define BODY_64                                                                \
+    "{\"id\":1024,\"name\":\"widget\",\"tags\":[\"a\",\"b\",\"c\"],"           \
+    "\"price\":199.99}\n"
+#define BODY_256 BODY_64 BODY_64 BODY_64 BODY_64
+
+/* POST with a 1 KiB Content-Length body */
+static unsigned char REQ_BODY_CL[] =
+    "POST /api/v1/items HTTP/1.1\r\n"
+    "Host: api.example.test\r\n"
+    "Content-Type: application/json\r\n"
+    "Content-Length: 1024\r\n"
+    "\r\n" BODY_256 BODY_256 BODY_256 BODY_256;
+
+/* POST with the same body in four chunks and a trailer field */
+static unsigned char REQ_BODY_CHUNKED[] =
+    "POST /api/v1/items HTTP/1.1\r\n"
+    "Host: api.example.test\r\n"
+    "Content-Type: application/json\r\n"
+    "Transfer-Encoding: chunked\r\n"
+    "\r\n"
+    "100\r\n" BODY_256 "\r\n"
+    "100\r\n" BODY_256 "\r\n"
+    "100\r\n" BODY_256 "\r\n"
+    "100\r\n" BODY_256 "\r\n"
+    "0\r\n"
+    "Digest: sha-256=abc\r\n"
+    "\r\n";
+
+/* ============================================================================
+ * Category 7: Field Value Lists
+ * Purpose: Splitting #element lists with weights (hwire_list_next)
+ * Control: The Accept value of REQ_HDR_8
+ * ============================================================================
+ */
+
+static unsigned char LIST_ACCEPT[] =
+    "text/html,application/xhtml+xml,application/xml;q=0.9,image/avif,image/"
+    "webp,image/apng,*/*;q=0.8";
+
+/* ============================================================================
+ * Category 8: Pipelining
+ * Purpose: Receive-buffer management under keep-alive pipelining
+ * Control: PIPELINE_COUNT copies of REQ_HDR_8 received in PIPELINE_READ byte
+ *          reads into a PIPELINE_BUF byte buffer, compacted with memmove
+ *          after each read vs a mirrored ring buffer (hwire_ring_t)
+ * ============================================================================
+ */
+
+#define PIPELINE_COUNT 64
+#define PIPELINE_READ  4096
+#define PIPELINE_BUF   16384
+
+/* ============================================================================
+ * Category 9: Multipart
+ * Purpose: Delimiter search in a large multipart/form-data upload
+ * Control: One file part of MULTIPART_SIZE pseudo-random bytes read in
+ *          MULTIPART_READ byte windows; hwire_multipart_parse vs a loop
+ *          calling memmem(3) on each window
+ * ============================================================================
+ */
+
+#define MULTIPART_SIZE     (100u << 20)
+#define MULTIPART_READ     65536
+#define MULTIPART_BOUNDARY "----WebKitFormBoundary7MA4YWxkTrZu0gW"
+
+/* ============================================================================
+ * Category 10: HPACK
+ * Purpose: HTTP/2 header block decoding (RFC 7541)
+ * Control: The fields of REQ_HDR_15 without Connection, as a browser encodes
+ *          them for three navigations on one connection: Huffman-coded
+ *          literals added to the dynamic table, then indexed field lines
+ *          only; hwire_hpack_decode vs nghttp2_hd_inflate_hd2
+ * ============================================================================
+ */
+
+/* First request: an empty dynamic table */
+static const unsigned char HPACK_REQ_FIRST[] = {
+    0x82, 0x87, 0x84, 0x41, 0x89, 0x2f, 0x91, 0xd3, 0x5d, 0x05, 0x5d, 0x25,
+    0x42, 0x7f, 0x7a, 0xd9, 0xd0, 0x7f, 0x66, 0xa2, 0x81, 0xb0, 0xda, 0xe0,
+    0x53, 0xfa, 0xd0, 0x32, 0x1a, 0xa4, 0x9d, 0x13, 0xfd, 0xa9, 0x92, 0xa4,
+    0x96, 0x85, 0x34, 0x0c, 0x8a, 0x6a, 0xdc, 0xa7, 0xe2, 0x81, 0x04, 0x41,
+    0x6e, 0x27, 0x7f, 0xb5, 0x21, 0xae, 0xba, 0x0b, 0xc8, 0xb1, 0xe6, 0x32,
+    0x58, 0x6d, 0x97, 0x57, 0x65, 0xc5, 0x3f, 0xac, 0xd8, 0xf7, 0xe8, 0xcf,
+    0xf4, 0xa5, 0x06, 0xea, 0x55, 0x31, 0x14, 0x9d, 0x4f, 0xfd, 0xa9, 0x7a,
+    0x7b, 0x0f, 0x49, 0x58, 0x08, 0x82, 0xb8, 0x17, 0x02, 0xe0, 0x53, 0x70,
+    0xe5, 0x1d, 0x86, 0x61, 0xb6, 0x5d, 0x5d, 0x97, 0x3f, 0x53, 0xc8, 0x49,
+    0x7c, 0xa5, 0x89, 0xd3, 0x4d, 0x1f, 0x43, 0xae, 0xba, 0x0c, 0x41, 0xa4,
+    0xc7, 0xa9, 0x8f, 0x33, 0xa6, 0x9a, 0x3f, 0xdf, 0x9a, 0x68, 0xfa, 0x1d,
+    0x75, 0xd0, 0x62, 0x0d, 0x26, 0x3d, 0x4c, 0x79, 0xa6, 0x8f, 0xbe, 0xd0,
+    0x01, 0x77, 0xfe, 0x8d, 0x48, 0xe6, 0x2b, 0x03, 0xee, 0x69, 0x7e, 0x8d,
+    0x48, 0xe6, 0x2b, 0x1e, 0x0b, 0x1d, 0x7f, 0x46, 0xa4, 0x73, 0x15, 0x81,
+    0xd7, 0x54, 0xdf, 0x5f, 0x2c, 0x7c, 0xfd, 0xf6, 0x80, 0x0b, 0xbd, 0x50,
+    0x8d, 0x9b, 0xd9, 0xab, 0xfa, 0x52, 0x42, 0xcb, 0x40, 0xd2, 0x5f, 0xa5,
+    0x23, 0xb3, 0x51, 0x93, 0xe8, 0x3f, 0xa2, 0xd4, 0xb7, 0x0d, 0xdf, 0x7d,
+    0xa0, 0x02, 0xef, 0xfd, 0x16, 0xaf, 0xbe, 0xd0, 0x01, 0x77, 0xbf, 0x58,
+    0x87, 0xa4, 0x7e, 0x56, 0x1c, 0xc5, 0x80, 0x1f, 0x40, 0x92, 0xb6, 0xb9,
+    0xac, 0x1c, 0x85, 0x58, 0xd5, 0x20, 0xa4, 0xb6, 0xc2, 0xad, 0x61, 0x7b,
+    0x5a, 0x54, 0x25, 0x1f, 0x01, 0x31, 0x40, 0x87, 0x41, 0x48, 0xb1, 0x27,
+    0x5a, 0xd1, 0xff, 0xb8, 0xfe, 0x74, 0x9d, 0x2a, 0x43, 0xfd, 0x5d, 0xb0,
+    0x75, 0x49, 0xfc, 0xfd, 0xf7, 0x83, 0xf9, 0x7d, 0xff, 0xe7, 0xe9, 0x4f,
+    0xe7, 0x11, 0xcf, 0x35, 0x05, 0x52, 0xf4, 0xf6, 0x1e, 0x92, 0xff, 0x3f,
+    0x7d, 0xe0, 0xfe, 0x42, 0x20, 0xff, 0x3f, 0x4a, 0x7f, 0x37, 0xa7, 0xb0,
+    0xf4, 0x9a, 0xda, 0x7f, 0x9f, 0xbe, 0xf0, 0x7f, 0x21, 0x10, 0x7f, 0x9f,
+    0x40, 0x8b, 0x41, 0x48, 0xb1, 0x27, 0x5a, 0xd1, 0xad, 0x49, 0xe3, 0x35,
+    0x05, 0x02, 0x3f, 0x30, 0x40, 0x8d, 0x41, 0x48, 0xb1, 0x27, 0x5a, 0xd1,
+    0xad, 0x5d, 0x03, 0x4c, 0xa7, 0xb2, 0x9f, 0x07, 0x22, 0x6d, 0x61, 0x63,
+    0x4f, 0x53, 0x22, 0x40, 0x8a, 0x41, 0x48, 0xb4, 0xa5, 0x49, 0x27, 0x59,
+    0x06, 0x49, 0x7f, 0x88, 0x40, 0xe9, 0x2a, 0xc7, 0xb0, 0xd3, 0x1a, 0xaf,
+    0x40, 0x8a, 0x41, 0x48, 0xb4, 0xa5, 0x49, 0x27, 0x5a, 0x93, 0xc8, 0x5f,
+    0x86, 0xa8, 0x7d, 0xcd, 0x30, 0xd2, 0x5f, 0x40, 0x8a, 0x41, 0x48, 0xb4,
+    0xa5, 0x49, 0x27, 0x5a, 0xd4, 0x16, 0xcf, 0x02, 0x3f, 0x31, 0x40, 0x8a,
+    0x41, 0x48, 0xb4, 0xa5, 0x49, 0x27, 0x5a, 0x42, 0xa1, 0x3f, 0x86, 0x90,
+    0xe4, 0xb6, 0x92, 0xd4, 0x9f,
+};
+
+/* Following requests: every field line indexed */
+static const unsigned char HPACK_REQ_NEXT[] = {
+    0x82, 0x87, 0x84, 0xcb, 0xca, 0xc9, 0xc8, 0xc7, 0xc6, 0xc5, 0xc4, 0xc3,
+    0xc2, 0xc1, 0xc0, 0xbf, 0xbe,
+};
+
+/* ============================================================================
+ * Category 11: HTTP/2 Frames
+ * Purpose: Walking the frames of a read buffer (RFC 9113 Section 4.1)
+ * Control: H2_FRAMES_REQS requests as a client sends them, each a HEADERS
+ *          frame with HPACK_REQ_NEXT, a DATA frame of H2_FRAMES_DATA bytes
+ *          and a connection WINDOW_UPDATE; hwire_h2_parse_frames in batches
+ *          of H2_FRAMES_BATCH vs one hwire_h2_parse_frame call per frame
+ * ============================================================================
+ */
+
+#define H2_FRAMES_REQS  128
+#define H2_FRAMES_DATA  64
+#define H2_FRAMES_BATCH 32
+
+/* ============================================================================
+ * Category 12: WebSocket
+ * Purpose: Unmasking client frame payloads (RFC 6455 Section 5.3)
+ * Control: A WS_UNMASK_SIZE byte payload unmasked in place by
+ *          hwire_ws_unmask, from an odd offset so the vector loop starts
+ *          unaligned, vs a byte-at-a-time XOR loop; the SIMD path is chosen
+ *          by the build (bench_hwire_avx2, _sse42, _sse2, _neon, _nosimd)
+ * ============================================================================
+ */
+
+#define WS_UNMASK_SIZE (1u << 20)
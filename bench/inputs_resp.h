@@ -292,3 +292,13 @@ static unsigned char RSP_MINIMAL_DATE[] =
     "HTTP/1.1 200 OK\r\n"
     "Date: Thu, 20 Feb 2026 09:00:00 GMT\r\n"
     "\r\n";
+
+/* Conditional GET revalidation (304 + ETag) ~61B */
+static unsigned char RSP_NOT_MODIFIED[] = "HTTP/1.1 304 Not Modified\r\n"
+                                          "ETag: \"33a64df551425fcc\"\r\n"
+                                          "\r\n";
+
+/* Uncommon status line (general status-line path) ~31B */
+static unsigned char RSP_UNCOMMON_STATUS[] =
+    "HTTP/1.1 429 Too Many Requests\r\n"
+    "\r\n";
@@ -86,22 +86,46 @@ function getSystemInfo() {
 // Category metadata (keyed by TestCase name)
 const CATEGORY_META = {
     'Header Count': {
-        description: 'Measures parsing time scaling with increasing header counts. hwire `(LC)` variants include lowercase key conversion.'
+        description: 'Measures parsing time scaling with increasing header counts. hwire `(LC)` variants include lowercase key conversion; `(Scan)` variants validate with `hwire_scan_message` only.'
     },
     'Header Value Length': {
-        description: 'Measures how parsing time scales with header value size. hwire `(LC)` variants include lowercase key conversion.'
+        description: 'Measures how parsing time scales with header value size. hwire `(LC)` variants include lowercase key conversion; `(Scan)` variants validate with `hwire_scan_message` only.'
     },
     'Case Sensitivity': {
-        description: 'Measures header name normalization cost (lowercase vs mixed case). hwire `(LC)` variants include lowercase key conversion.'
+        description: 'Measures header name normalization cost (lowercase vs mixed case). hwire `(LC)` variants include lowercase key conversion; `(Scan)` variants validate with `hwire_scan_message` only.'
     },
     'Real-World Requests': {
-        description: 'Typical requests from browsers, REST APIs, and mobile apps. hwire `(LC)` variants include lowercase key conversion.'
+        description: 'Typical requests from browsers, REST APIs, and mobile apps. hwire `(LC)` variants include lowercase key conversion; `(Scan)` variants validate with `hwire_scan_message` only.'
     },
     'Baseline': {
-        description: 'Minimum parsing cost for comparison. hwire `(LC)` variants include lowercase key conversion.'
+        description: 'Minimum parsing cost for comparison. hwire `(LC)` variants include lowercase key conversion; `(Scan)` variants validate with `hwire_scan_message` only.'
+    },
+    'Message Body': {
+        description: 'Complete request including body framing and streaming body callbacks (hwire message parser and llhttp only; picohttpparser and httparse do not parse bodies).'
+    },
+    'Hardened Mode': {
+        description: 'Cost of `HWIRE_OPT_HARDENED` (inline request-smuggling checks) on the 28-header request. `(Framing)` collects the framing fields into `ctx->framing` without the checks, which hardened mode always does (hwire only).'
+    },
+    'Field Value Lists': {
+        description: 'Splitting a comma-separated field value into elements with q-value weights (hwire `hwire_list_next` only).'
+    },
+    'Pipelining': {
+        description: 'Pipelined keep-alive requests received in 4 KiB reads and parsed with the hwire message parser, compacting a linear buffer with memmove vs a mirrored ring buffer (`hwire_ring_t`; hwire only).'
+    },
+    'Multipart': {
+        description: 'A 100 MB multipart/form-data upload read in 64 KiB windows: `hwire_multipart_parse` (SIMD first/last-byte filter) vs a loop calling `memmem` on each window (hwire only).'
+    },
+    'HPACK': {
+        description: 'HTTP/2 header blocks of three browser navigations on one connection, Huffman-coded literals then indexed field lines, decoded by `hwire_hpack_decode` (with lowercase key copy) and by nghttp2 `nghttp2_hd_inflate_hd2` (including creating the inflater; hwire and nghttp2 only).'
+    },
+    'HTTP/2 Frames': {
+        description: 'Client frames of 128 requests (HEADERS, DATA and a connection WINDOW_UPDATE each) in one buffer, walked by `hwire_h2_parse_frames` in batches of 32 vs one `hwire_h2_parse_frame` call per frame (hwire only).'
+    },
+    'WebSocket': {
+        description: 'Unmasking a 1 MiB client frame payload in place with `hwire_ws_unmask` (AVX2, SSE2 or NEON by build, 8-byte scalar without SIMD) vs a byte-at-a-time XOR loop (hwire only).'
     },
     'Real-World Responses': {
-        description: 'Typical responses from web servers and CDNs. hwire `(LC)` variants include lowercase key conversion.'
+        description: 'Typical responses from web servers and CDNs. hwire `(LC)` variants include lowercase key conversion; `(Scan)` variants validate with `hwire_scan_message` only.'
     }
 };
 
@@ -112,6 +136,14 @@ const CATEGORY_ORDER = [
     'Case Sensitivity',
     'Real-World Requests',
     'Baseline',
+    'Message Body',
+    'Hardened Mode',
+    'Field Value Lists',
+    'Pipelining',
+    'Multipart',
+    'HPACK',
+    'HTTP/2 Frames',
+    'WebSocket',
     'Real-World Responses'
 ];
 
@@ -24,11 +24,23 @@
  *  Zero-Allocation HTTP Parser
  */
 
+// memfd_create(2) for the mirrored ring buffer
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+# define _GNU_SOURCE
+#endif
+
 #include "hwire.h"
 #include <assert.h>
 #include <limits.h>
 #include <string.h>
 #include <sys/types.h>
+#include <time.h>
+#if defined(HWIRE_RING)
+# include <errno.h>
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <unistd.h>
+#endif
 
 // ALIGNED(n): compiler-portable alignment specifier.
 // Standard alignas/`_Alignas` is preferred when available (C++11 / C11).
@@ -328,6 +340,135 @@ static const unsigned char HEXDIGIT[256] = {
 
 /** @} */ /* end of Character Validation Tables */
 
+/**
+ * @name CRC32C Functions
+ * @{
+ */
+
+// CRC32C (Castagnoli, reflected polynomial 0x82F63B78) is used to hash the
+// lowercased header field names.  SSE4.2 and ARMv8 provide dedicated
+// instructions; other targets use the byte-wise lookup table below.  All
+// implementations produce identical values, so a hash computed by the parser
+// can be compared against hwire_hash_key() on any build.
+#if defined(__ARM_FEATURE_CRC32) && !defined(NO_SIMD)
+# include <arm_acle.h>
+# define CRC32C_ARM
+#elif defined(__SSE4_2__)
+# define CRC32C_SSE42
+#endif
+
+#if !defined(CRC32C_ARM) && !defined(CRC32C_SSE42)
+static const uint32_t CRC32C_TABLE[256] = {
+    0x00000000, 0xF26B8303, 0xE13B70F7, 0x1350F3F4, 0xC79A971F, 0x35F1141C,
+    0x26A1E7E8, 0xD4CA64EB, 0x8AD958CF, 0x78B2DBCC, 0x6BE22838, 0x9989AB3B,
+    0x4D43CFD0, 0xBF284CD3, 0xAC78BF27, 0x5E133C24, 0x105EC76F, 0xE235446C,
+    0xF165B798, 0x030E349B, 0xD7C45070, 0x25AFD373, 0x36FF2087, 0xC494A384,
+    0x9A879FA0, 0x68EC1CA3, 0x7BBCEF57, 0x89D76C54, 0x5D1D08BF, 0xAF768BBC,
+    0xBC267848, 0x4E4DFB4B, 0x20BD8EDE, 0xD2D60DDD, 0xC186FE29, 0x33ED7D2A,
+    0xE72719C1, 0x154C9AC2, 0x061C6936, 0xF477EA35, 0xAA64D611, 0x580F5512,
+    0x4B5FA6E6, 0xB93425E5, 0x6DFE410E, 0x9F95C20D, 0x8CC531F9, 0x7EAEB2FA,
+    0x30E349B1, 0xC288CAB2, 0xD1D83946, 0x23B3BA45, 0xF779DEAE, 0x05125DAD,
+    0x1642AE59, 0xE4292D5A, 0xBA3A117E, 0x4851927D, 0x5B016189, 0xA96AE28A,
+    0x7DA08661, 0x8FCB0562, 0x9C9BF696, 0x6EF07595, 0x417B1DBC, 0xB3109EBF,
+    0xA0406D4B, 0x522BEE48, 0x86E18AA3, 0x748A09A0, 0x67DAFA54, 0x95B17957,
+    0xCBA24573, 0x39C9C670, 0x2A993584, 0xD8F2B687, 0x0C38D26C, 0xFE53516F,
+    0xED03A29B, 0x1F682198, 0x5125DAD3, 0xA34E59D0, 0xB01EAA24, 0x42752927,
+    0x96BF4DCC, 0x64D4CECF, 0x77843D3B, 0x85EFBE38, 0xDBFC821C, 0x2997011F,
+    0x3AC7F2EB, 0xC8AC71E8, 0x1C661503, 0xEE0D9600, 0xFD5D65F4, 0x0F36E6F7,
+    0x61C69362, 0x93AD1061, 0x80FDE395, 0x72966096, 0xA65C047D, 0x5437877E,
+    0x4767748A, 0xB50CF789, 0xEB1FCBAD, 0x197448AE, 0x0A24BB5A, 0xF84F3859,
+    0x2C855CB2, 0xDEEEDFB1, 0xCDBE2C45, 0x3FD5AF46, 0x7198540D, 0x83F3D70E,
+    0x90A324FA, 0x62C8A7F9, 0xB602C312, 0x44694011, 0x5739B3E5, 0xA55230E6,
+    0xFB410CC2, 0x092A8FC1, 0x1A7A7C35, 0xE811FF36, 0x3CDB9BDD, 0xCEB018DE,
+    0xDDE0EB2A, 0x2F8B6829, 0x82F63B78, 0x709DB87B, 0x63CD4B8F, 0x91A6C88C,
+    0x456CAC67, 0xB7072F64, 0xA457DC90, 0x563C5F93, 0x082F63B7, 0xFA44E0B4,
+    0xE9141340, 0x1B7F9043, 0xCFB5F4A8, 0x3DDE77AB, 0x2E8E845F, 0xDCE5075C,
+    0x92A8FC17, 0x60C37F14, 0x73938CE0, 0x81F80FE3, 0x55326B08, 0xA759E80B,
+    0xB4091BFF, 0x466298FC, 0x1871A4D8, 0xEA1A27DB, 0xF94AD42F, 0x0B21572C,
+    0xDFEB33C7, 0x2D80B0C4, 0x3ED04330, 0xCCBBC033, 0xA24BB5A6, 0x502036A5,
+    0x4370C551, 0xB11B4652, 0x65D122B9, 0x97BAA1BA, 0x84EA524E, 0x7681D14D,
+    0x2892ED69, 0xDAF96E6A, 0xC9A99D9E, 0x3BC21E9D, 0xEF087A76, 0x1D63F975,
+    0x0E330A81, 0xFC588982, 0xB21572C9, 0x407EF1CA, 0x532E023E, 0xA145813D,
+    0x758FE5D6, 0x87E466D5, 0x94B49521, 0x66DF1622, 0x38CC2A06, 0xCAA7A905,
+    0xD9F75AF1, 0x2B9CD9F2, 0xFF56BD19, 0x0D3D3E1A, 0x1E6DCDEE, 0xEC064EED,
+    0xC38D26C4, 0x31E6A5C7, 0x22B65633, 0xD0DDD530, 0x0417B1DB, 0xF67C32D8,
+    0xE52CC12C, 0x1747422F, 0x49547E0B, 0xBB3FFD08, 0xA86F0EFC, 0x5A048DFF,
+    0x8ECEE914, 0x7CA56A17, 0x6FF599E3, 0x9D9E1AE0, 0xD3D3E1AB, 0x21B862A8,
+    0x32E8915C, 0xC083125F, 0x144976B4, 0xE622F5B7, 0xF5720643, 0x07198540,
+    0x590AB964, 0xAB613A67, 0xB831C993, 0x4A5A4A90, 0x9E902E7B, 0x6CFBAD78,
+    0x7FAB5E8C, 0x8DC0DD8F, 0xE330A81A, 0x115B2B19, 0x020BD8ED, 0xF0605BEE,
+    0x24AA3F05, 0xD6C1BC06, 0xC5914FF2, 0x37FACCF1, 0x69E9F0D5, 0x9B8273D6,
+    0x88D28022, 0x7AB90321, 0xAE7367CA, 0x5C18E4C9, 0x4F48173D, 0xBD23943E,
+    0xF36E6F75, 0x0105EC76, 0x12551F82, 0xE03E9C81, 0x34F4F86A, 0xC69F7B69,
+    0xD5CF889D, 0x27A40B9E, 0x79B737BA, 0x8BDCB4B9, 0x988C474D, 0x6AE7C44E,
+    0xBE2DA0A5, 0x4C4623A6, 0x5F16D052, 0xAD7D5351};
+#endif
+
+static inline uint32_t crc32c_u8(uint32_t crc, unsigned char c)
+{
+#if defined(CRC32C_SSE42)
+    return _mm_crc32_u8(crc, c);
+#elif defined(CRC32C_ARM)
+    return __crc32cb(crc, c);
+#else
+    return CRC32C_TABLE[(crc ^ c) & 0xFF] ^ (crc >> 8);
+#endif
+}
+
+// v holds four bytes in little-endian order (byte 0 in bits 0-7)
+static inline uint32_t crc32c_u32(uint32_t crc, uint32_t v)
+{
+#if defined(CRC32C_SSE42)
+    return _mm_crc32_u32(crc, v);
+#elif defined(CRC32C_ARM)
+    return __crc32cw(crc, v);
+#else
+    crc = crc32c_u8(crc, (unsigned char)v);
+    crc = crc32c_u8(crc, (unsigned char)(v >> 8));
+    crc = crc32c_u8(crc, (unsigned char)(v >> 16));
+    return crc32c_u8(crc, (unsigned char)(v >> 24));
+#endif
+}
+
+/**
+ * @brief Update a CRC32C value with len bytes from str
+ *
+ * Hardware builds consume 8 bytes per instruction (4 on 32-bit x86); the
+ * table-driven fallback consumes one byte per step.
+ *
+ * @param crc Current (non-inverted) CRC value
+ * @param str Bytes to hash
+ * @param len Number of bytes
+ * @return Updated CRC value
+ */
+static inline uint32_t crc32c(uint32_t crc, const unsigned char *str,
+                              size_t len)
+{
+#if defined(CRC32C_SSE42) && (defined(__x86_64__) || defined(_M_X64))
+    while (len >= 8) {
+        uint64_t v;
+        memcpy(&v, str, 8);
+        crc = (uint32_t)_mm_crc32_u64(crc, v);
+        str += 8;
+        len -= 8;
+    }
+#elif defined(CRC32C_ARM) && !defined(__ARM_BIG_ENDIAN)
+    while (len >= 8) {
+        uint64_t v;
+        memcpy(&v, str, 8);
+        crc = __crc32cd(crc, v);
+        str += 8;
+        len -= 8;
+    }
+#endif
+    while (len--) {
+        crc = crc32c_u8(crc, *str++);
+    }
+    return crc;
+}
+
+/** @} */ /* end of CRC32C Functions */
+
 /**
  * @name Internal Macros
  * @{
@@ -442,18 +583,29 @@ static const int8_t ALIGNED(16) TCHAR_NIBBLE_HI[16] = {
     0x00, 0x00, 0x01, 0x02, 0x04, 0x08, 0x10, 0x20,
     // hi:   0x8   0x9   0xA   0xB   0xC   0xD   0xE   0xF
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+
+// URI_NIBBLE_LO: low-nibble table for URI_CHAR, paired with TCHAR_NIBBLE_HI
+// (same bit assignment). (URI_NIBBLE_LO[c & 0xF] & TCHAR_NIBBLE_HI[c >> 4])
+// != 0 iff URI_CHAR[c] != 0.
+static const int8_t ALIGNED(16) URI_NIBBLE_LO[16] = {
+    // lo:   0x0   0x1   0x2   0x3   0x4   0x5   0x6   0x7
+    0x2E, 0x3F, 0x3E, 0x3E, 0x3F, 0x3F, 0x3F, 0x3F,
+    // lo:   0x8   0x9   0xA   0xB   0xC   0xD   0xE   0xF
+    0x3F, 0x3F, 0x3F, 0x17, 0x15, 0x17, 0x35, 0x1F};
 #endif
 
 /**
  * @brief Count consecutive tchar characters with lowercase conversion
  *
  * Counts the number of consecutive tchar (token) characters from the
- * beginning of str, writing the lowercase-converted characters into lc->buf.
+ * beginning of str, writing the lowercase-converted characters into lc->buf
+ * and their CRC32C into lc->hash.
  *
  * Uses AVX2 (32B/iter) or SSSE3 (16B/iter) for validation and lowercasing
  * when available.  For typical HTTP header names (4-15 chars) the SIMD path
  * completes in a single iteration.  A scalar 4-char-unrolled fallback handles
- * any remaining bytes.
+ * any remaining bytes.  Each block is folded into the hash right after it is
+ * stored, while it is still in L1, so the name is never walked twice.
  *
  * @param str   String to parse (must not be NULL)
  * @param len   Maximum length of string
@@ -467,6 +619,7 @@ static inline size_t strtchar_cmp_lc(const unsigned char *str, size_t len,
     size_t pos         = 0;
     unsigned char *buf = (unsigned char *)lc->buf;
     size_t limit       = (len < lc->size) ? len : lc->size;
+    uint32_t crc       = UINT32_MAX;
 
 #if defined(__AVX2__)
     if (likely(pos + 32 <= limit)) {
@@ -496,10 +649,13 @@ static inline size_t strtchar_cmp_lc(const unsigned char *str, size_t len,
             // store 32 bytes (safe: pos+32 <= limit <= lc->size)
             _mm256_storeu_si256((__m256i *)(void *)(buf + pos), lc_out);
             if (mask) {
-                pos += (size_t)ctz32((unsigned)mask);
+                size_t n = (size_t)ctz32((unsigned)mask);
+                lc->hash = ~crc32c(crc, buf + pos, n);
+                pos += n;
                 lc->len = pos;
                 return pos;
             }
+            crc = crc32c(crc, buf + pos, 32);
             pos += 32;
         } while (pos + 32 <= limit);
     }
@@ -530,10 +686,13 @@ static inline size_t strtchar_cmp_lc(const unsigned char *str, size_t len,
             // store 16 bytes (safe: pos+16 <= limit <= lc->size)
             _mm_storeu_si128((__m128i *)(void *)(buf + pos), lc_out);
             if (mask) {
-                pos += (size_t)ctz32((unsigned)mask);
+                size_t n = (size_t)ctz32((unsigned)mask);
+                lc->hash = ~crc32c(crc, buf + pos, n);
+                pos += n;
                 lc->len = pos;
                 return pos;
             }
+            crc = crc32c(crc, buf + pos, 16);
             pos += 16;
         } while (pos + 16 <= limit);
     }
@@ -550,6 +709,10 @@ static inline size_t strtchar_cmp_lc(const unsigned char *str, size_t len,
             buf[pos + 1] = TCHAR[c1];
             buf[pos + 2] = TCHAR[c2];
             buf[pos + 3] = TCHAR[c3];
+            crc          = crc32c_u32(crc, (uint32_t)TCHAR[c0] |
+                                               (uint32_t)TCHAR[c1] << 8 |
+                                               (uint32_t)TCHAR[c2] << 16 |
+                                               (uint32_t)TCHAR[c3] << 24);
             pos += 4;
             continue;
         }
@@ -557,9 +720,11 @@ static inline size_t strtchar_cmp_lc(const unsigned char *str, size_t len,
     }
     while (pos < limit && is_tchar(str[pos])) {
         buf[pos] = TCHAR[str[pos]];
+        crc      = crc32c_u8(crc, buf[pos]);
         pos++;
     }
-    lc->len = pos;
+    lc->len  = pos;
+    lc->hash = ~crc;
 
     // buffer is full - check if there are more tchars
     if (pos < len && is_tchar(str[pos])) {
@@ -1165,6 +1330,37 @@ size_t hwire_parse_vchar(const char *str, size_t len, size_t *pos)
     return n;
 }
 
+// A-Z -> a-z, every other byte unchanged (same mapping as TCHAR for tchars)
+static inline uint32_t ascii_tolower(unsigned char c)
+{
+    return (uint32_t)c | ((uint32_t)((unsigned)c - 'A' < 26u) << 5);
+}
+
+/**
+ * @brief Hash a header field name
+ *
+ * Lowercases A-Z on the fly and folds four bytes per CRC32C step, matching
+ * the hash produced by strtchar_cmp_lc for the same name.
+ */
+uint32_t hwire_hash_key(const char *str, size_t len)
+{
+    assert(str != NULL || len == 0);
+    const unsigned char *ustr = (const unsigned char *)str;
+    uint32_t crc              = UINT32_MAX;
+    size_t pos                = 0;
+
+    for (; pos + 4 <= len; pos += 4) {
+        crc = crc32c_u32(crc, ascii_tolower(ustr[pos]) |
+                                  ascii_tolower(ustr[pos + 1]) << 8 |
+                                  ascii_tolower(ustr[pos + 2]) << 16 |
+                                  ascii_tolower(ustr[pos + 3]) << 24);
+    }
+    for (; pos < len; pos++) {
+        crc = crc32c_u8(crc, (unsigned char)ascii_tolower(ustr[pos]));
+    }
+    return ~crc;
+}
+
 /**
  * @see RFC 7230 Section 3.2.6 Field Value Components
  * @see RFC 9110 Section 5.6.4 Quoted Strings
@@ -1479,6 +1675,541 @@ CHECK_PARAM:
     return rv;
 }
 
+/**
+ * @brief Classify a block of a cookie-string
+ *
+ * Sets bit i of *semi and *eq if str[i] is ';' or '=', and bit i of *ctl if
+ * str[i] is a control character other than HT.
+ */
+#if defined(__AVX2__)
+# define COOKIE_BLOCK 32
+static inline void cookie_block_masks(const unsigned char *str, uint32_t *semi,
+                                      uint32_t *eq, uint32_t *ctl)
+{
+    __m256i data = _mm256_loadu_si256((const __m256i *)(const void *)str);
+    __m256i c    = _mm256_or_si256(
+        _mm256_cmpeq_epi8(_mm256_min_epu8(data, _mm256_set1_epi8(0x1F)), data),
+        _mm256_cmpeq_epi8(data, _mm256_set1_epi8(0x7F)));
+    c     = _mm256_andnot_si256(_mm256_cmpeq_epi8(data, _mm256_set1_epi8(HT)),
+                                c);
+    *semi = (uint32_t)_mm256_movemask_epi8(
+        _mm256_cmpeq_epi8(data, _mm256_set1_epi8(SEMICOLON)));
+    *eq = (uint32_t)_mm256_movemask_epi8(
+        _mm256_cmpeq_epi8(data, _mm256_set1_epi8(EQ)));
+    *ctl = (uint32_t)_mm256_movemask_epi8(c);
+}
+#elif defined(__SSE2__)
+# define COOKIE_BLOCK 16
+static inline void cookie_block_masks(const unsigned char *str, uint32_t *semi,
+                                      uint32_t *eq, uint32_t *ctl)
+{
+    __m128i data = _mm_loadu_si128((const __m128i *)(const void *)str);
+    __m128i c    = _mm_or_si128(
+        _mm_cmpeq_epi8(_mm_min_epu8(data, _mm_set1_epi8(0x1F)), data),
+        _mm_cmpeq_epi8(data, _mm_set1_epi8(0x7F)));
+    c     = _mm_andnot_si128(_mm_cmpeq_epi8(data, _mm_set1_epi8(HT)), c);
+    *semi = (uint32_t)_mm_movemask_epi8(
+        _mm_cmpeq_epi8(data, _mm_set1_epi8(SEMICOLON)));
+    *eq =
+        (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(data, _mm_set1_epi8(EQ)));
+    *ctl = (uint32_t)_mm_movemask_epi8(c);
+}
+#endif
+
+static inline int is_cookie_ctl(unsigned char c)
+{
+    return (c < 0x20 && c != HT) || c == 0x7F;
+}
+
+/**
+ * @brief Get the next cookie-pair of a cookie-string
+ *
+ * The pair ends at the first ';' and the name at the first '=' before it;
+ * OWS around the separators is trimmed. A pair without '=' is reported with
+ * an empty name, as user agents do when they serialize such cookies.
+ *
+ * @return 1 if a pair was stored, 0 at the end of the string
+ * @return HWIRE_EILSEQ if the pair contains a control character
+ */
+static int cookie_next(const char *str, size_t len, size_t *pos,
+                       hwire_kv_pair_t *pair)
+{
+    const unsigned char *ustr = (const unsigned char *)str;
+    size_t cur                = *pos;
+    size_t start              = 0;
+    size_t end                = 0;
+    size_t eq                 = SIZE_MAX; // first '=' of the pair
+
+    // skip separators and OWS
+    while (cur < len &&
+           (ustr[cur] == SEMICOLON || ustr[cur] == SP || ustr[cur] == HT)) {
+        cur++;
+    }
+    if (cur >= len) {
+        *pos = len;
+        return 0;
+    }
+    start = cur;
+
+#if defined(COOKIE_BLOCK)
+    while (cur + COOKIE_BLOCK <= len) {
+        uint32_t semi, eqm, ctl;
+
+        cookie_block_masks(ustr + cur, &semi, &eqm, &ctl);
+        if (semi) {
+            // only bytes before the ';' belong to this pair
+            uint32_t keep = ((uint32_t)1 << ctz32(semi)) - 1;
+            eqm &= keep;
+            ctl &= keep;
+        }
+        if (ctl) {
+            return HWIRE_EILSEQ;
+        }
+        if (eq == SIZE_MAX && eqm) {
+            eq = cur + (size_t)ctz32(eqm);
+        }
+        if (semi) {
+            cur += (size_t)ctz32(semi);
+            goto FOUND;
+        }
+        cur += COOKIE_BLOCK;
+    }
+#endif
+    for (; cur < len && ustr[cur] != SEMICOLON; cur++) {
+        if (is_cookie_ctl(ustr[cur])) {
+            return HWIRE_EILSEQ;
+        }
+        if (ustr[cur] == EQ && eq == SIZE_MAX) {
+            eq = cur;
+        }
+    }
+
+#if defined(COOKIE_BLOCK)
+FOUND:
+#endif
+    // ustr[start] is neither OWS nor ';', so trimming stops there
+    end = cur;
+    while (ustr[end - 1] == SP || ustr[end - 1] == HT) {
+        end--;
+    }
+    if (eq == SIZE_MAX) {
+        pair->key.ptr   = str + start;
+        pair->key.len   = 0;
+        pair->value.ptr = str + start;
+        pair->value.len = end - start;
+    } else {
+        size_t k = eq;
+        size_t v = eq + 1;
+        while (k > start && (ustr[k - 1] == SP || ustr[k - 1] == HT)) {
+            k--;
+        }
+        while (v < end && (ustr[v] == SP || ustr[v] == HT)) {
+            v++;
+        }
+        pair->key.ptr   = str + start;
+        pair->key.len   = k - start;
+        pair->value.ptr = str + v;
+        pair->value.len = end - v;
+    }
+    *pos = cur;
+    return 1;
+}
+
+#if defined(COOKIE_BLOCK)
+# undef COOKIE_BLOCK
+#endif
+
+/**
+ * @brief Parse a Cookie header field value
+ *
+ * Pairs are split by vector compares for ';' and '=' over whole blocks, so
+ * the cost is per block rather than per byte. With name set, pairs are only
+ * compared against it and parsing returns at the first match.
+ */
+int hwire_parse_cookie(const char *str, size_t len, hwire_kv_array_t *cookies,
+                       uint8_t maxcookies, const hwire_str_t *name)
+{
+    assert(str != NULL || len == 0);
+    assert(cookies != NULL);
+    assert(cookies->items != NULL || maxcookies == 0);
+    assert(name == NULL || name->ptr != NULL || name->len == 0);
+    size_t pos = 0;
+    hwire_kv_pair_t pair;
+    int rv;
+
+    cookies->count = 0;
+    while ((rv = cookie_next(str, len, &pos, &pair)) == 1) {
+        if (name != NULL) {
+            if (pair.key.len == name->len &&
+                (name->len == 0 ||
+                 memcmp(pair.key.ptr, name->ptr, name->len) == 0)) {
+                if (maxcookies == 0) {
+                    return HWIRE_ENOBUFS;
+                }
+                cookies->items[0] = pair;
+                cookies->count    = 1;
+                return HWIRE_OK;
+            }
+        } else if (cookies->count >= maxcookies) {
+            return HWIRE_ENOBUFS;
+        } else {
+            cookies->items[cookies->count++] = pair;
+        }
+    }
+    return rv;
+}
+
+/**
+ * @brief Parse a qvalue into thousandths
+ *
+ * qvalue = ( "0" [ "." 0*3DIGIT ] ) / ( "1" [ "." 0*3("0") ] )
+ * RFC 9110 12.4.2: Quality Values
+ *
+ * @return HWIRE_OK on success
+ * @return HWIRE_EILSEQ if the value is not a valid qvalue
+ */
+static int parse_qvalue(const unsigned char *str, size_t len, uint16_t *q)
+{
+    unsigned int v    = 0;
+    unsigned int unit = 100;
+
+    if (len == 0 || len > 5 || (str[0] != '0' && str[0] != '1') ||
+        (len > 1 && str[1] != '.')) {
+        return HWIRE_EILSEQ;
+    }
+    v = (unsigned int)(str[0] - '0') * 1000;
+    for (size_t i = 2; i < len; i++, unit /= 10) {
+        if (str[i] < '0' || str[i] > '9') {
+            return HWIRE_EILSEQ;
+        }
+        v += (unsigned int)(str[i] - '0') * unit;
+    }
+    if (v > 1000) {
+        return HWIRE_EILSEQ;
+    }
+    *q = (uint16_t)v;
+    return HWIRE_OK;
+}
+
+/**
+ * @brief Parse one parameter of a list element
+ *
+ * parameter = parameter-name "=" parameter-value
+ *
+ * A "q" parameter with a token value is stored in *q; any other parameter
+ * is passed to ctx->param_cb when one is set.
+ *
+ * @return HWIRE_OK on success
+ * @return HWIRE_EILSEQ for invalid byte sequence or qvalue
+ * @return HWIRE_EKEYLEN if key length exceeds ctx->key_lc.size
+ * @return HWIRE_ECALLBACK if callback returned non-zero
+ */
+static int parse_list_param(hwire_ctx_t *ctx, const char *str, size_t len,
+                            size_t *pos, uint16_t *q)
+{
+    hwire_param_t param       = {0};
+    const unsigned char *ustr = (const unsigned char *)str;
+    size_t cur                = *pos;
+    size_t n                  = 0;
+    int has_cb                = ctx != NULL && ctx->param_cb != NULL;
+
+    // parse parameter-name (token)
+    if (has_cb && ctx->key_lc.size > 0) {
+        ctx->key_lc.len = 0;
+        n               = strtchar(ustr + cur, len - cur, &ctx->key_lc);
+        if (n == SIZE_MAX) {
+            *pos = cur;
+            return HWIRE_EKEYLEN;
+        }
+    } else {
+        n = strtchar(ustr + cur, len - cur, NULL);
+    }
+    param.key.ptr = str + cur;
+    param.key.len = n;
+    cur += n;
+    if (n == 0 || cur >= len || ustr[cur] != EQ) {
+        *pos = cur;
+        return HWIRE_EILSEQ;
+    }
+    // skip '='
+    cur++;
+
+    // parse parameter-value; a weight is never quoted
+    if (cur < len && ustr[cur] == DQUOTE) {
+        size_t head = cur;
+        if ((n == 1 && (param.key.ptr[0] | 0x20) == 'q') ||
+            hwire_parse_quoted_string(str, len, &cur, len - cur) != HWIRE_OK) {
+            *pos = cur;
+            return HWIRE_EILSEQ;
+        }
+        param.value.ptr = str + head + 1; // skip opening quote
+        param.value.len = cur - head - 2; // exclude quotes
+    } else {
+        param.value.ptr = str + cur;
+        param.value.len = hwire_parse_tchar(str, len, &cur);
+        if (param.value.len == 0) {
+            *pos = cur;
+            return HWIRE_EILSEQ;
+        }
+        if (n == 1 && (param.key.ptr[0] | 0x20) == 'q') {
+            *pos = cur;
+            return parse_qvalue((const unsigned char *)param.value.ptr,
+                                param.value.len, q);
+        }
+    }
+
+    *pos = cur;
+    if (has_cb && ctx->param_cb(ctx, &param)) {
+        return HWIRE_ECALLBACK;
+    }
+    return HWIRE_OK;
+}
+
+/**
+ * @brief Find the first ',', ';' or DQUOTE in a block of a list
+ *
+ * List elements are short, so 16-byte blocks are used even with AVX2.
+ *
+ * @return Bit mask with bit i set if str[i] ends the element text
+ */
+#if defined(__SSE2__)
+# define LIST_BLOCK 16
+static inline uint32_t list_block_mask(const unsigned char *str)
+{
+    __m128i data = _mm_loadu_si128((const __m128i *)(const void *)str);
+    __m128i m    = _mm_or_si128(_mm_cmpeq_epi8(data, _mm_set1_epi8(',')),
+                                _mm_cmpeq_epi8(data, _mm_set1_epi8(SEMICOLON)));
+    m = _mm_or_si128(m, _mm_cmpeq_epi8(data, _mm_set1_epi8(DQUOTE)));
+    return (uint32_t)_mm_movemask_epi8(m);
+}
+#endif
+
+/**
+ * @brief Get the next element of a comma-separated list
+ *
+ * Commas inside quoted-strings do not end an element. The weight is taken
+ * from a "q" parameter; all other parameters go to ctx->param_cb.
+ */
+int hwire_list_next(hwire_ctx_t *ctx, const char *str, size_t len,
+                    size_t *pos, hwire_list_elem_t *elem)
+{
+    assert(str != NULL || len == 0);
+    assert(pos != NULL);
+    assert(elem != NULL);
+    const unsigned char *ustr = (const unsigned char *)str;
+    size_t cur                = *pos;
+    size_t start              = 0;
+    size_t end                = 0;
+    uint16_t q                = 1000;
+    int rv                    = HWIRE_OK;
+
+    // skip empty elements and OWS
+    while (cur < len && (ustr[cur] == ',' || ustr[cur] == SP ||
+                         ustr[cur] == HT)) {
+        cur++;
+    }
+    if (cur >= len) {
+        *pos = len;
+        return 0;
+    }
+    start = cur;
+
+    // element up to the first ';' or ',' outside a quoted-string
+    while (cur < len && ustr[cur] != ',' && ustr[cur] != SEMICOLON) {
+        if (ustr[cur] != DQUOTE) {
+            cur++;
+#if defined(LIST_BLOCK)
+            while (cur + LIST_BLOCK <= len) {
+                uint32_t m = list_block_mask(ustr + cur);
+                if (m) {
+                    cur += (size_t)ctz32(m);
+                    break;
+                }
+                cur += LIST_BLOCK;
+            }
+#endif
+        } else if (hwire_parse_quoted_string(str, len, &cur, len - cur) !=
+                   HWIRE_OK) {
+            *pos = cur;
+            return HWIRE_EILSEQ;
+        }
+    }
+    // ustr[start] is not OWS, so trimming stops there
+    end = cur;
+    while (end > start && (ustr[end - 1] == SP || ustr[end - 1] == HT)) {
+        end--;
+    }
+    if (end == start) {
+        // parameters without an element
+        *pos = cur;
+        return HWIRE_EILSEQ;
+    }
+
+    // parameters = *( OWS ";" OWS [ parameter ] )
+    while (cur < len && ustr[cur] == SEMICOLON) {
+        cur++;
+        while (cur < len && (ustr[cur] == SP || ustr[cur] == HT)) {
+            cur++;
+        }
+        if (cur < len && ustr[cur] != ',' && ustr[cur] != SEMICOLON) {
+            rv = parse_list_param(ctx, str, len, &cur, &q);
+            if (rv != HWIRE_OK) {
+                *pos = cur;
+                return rv;
+            }
+            while (cur < len && (ustr[cur] == SP || ustr[cur] == HT)) {
+                cur++;
+            }
+        }
+    }
+    if (cur < len && ustr[cur] != ',') {
+        *pos = cur;
+        return HWIRE_EILSEQ;
+    }
+
+    elem->value.ptr = str + start;
+    elem->value.len = end - start;
+    elem->q         = q;
+    *pos            = cur;
+    return 1;
+}
+
+#if defined(LIST_BLOCK)
+# undef LIST_BLOCK
+#endif
+
+/**
+ * @brief Well-known media types, as "type/subtype" in lowercase
+ */
+typedef struct {
+    const char *name; /**< Media type */
+    uint8_t len;      /**< Length of name */
+    uint8_t id;       /**< hwire_media_id_t */
+} media_name_t;
+
+#define MEDIA_NAME(name, id) {name, (uint8_t)(sizeof(name) - 1), id}
+
+static const media_name_t MEDIA_NAMES[] = {
+    MEDIA_NAME("application/json", HWIRE_MEDIA_APPLICATION_JSON),
+    MEDIA_NAME("application/x-www-form-urlencoded",
+               HWIRE_MEDIA_APPLICATION_FORM),
+    MEDIA_NAME("application/octet-stream", HWIRE_MEDIA_APPLICATION_OCTET),
+    MEDIA_NAME("application/xml", HWIRE_MEDIA_APPLICATION_XML),
+    MEDIA_NAME("application/javascript", HWIRE_MEDIA_APPLICATION_JAVASCRIPT),
+    MEDIA_NAME("application/pdf", HWIRE_MEDIA_APPLICATION_PDF),
+    MEDIA_NAME("application/grpc", HWIRE_MEDIA_APPLICATION_GRPC),
+    MEDIA_NAME("application/problem+json", HWIRE_MEDIA_APPLICATION_PROBLEM),
+    MEDIA_NAME("multipart/form-data", HWIRE_MEDIA_MULTIPART_FORM_DATA),
+    MEDIA_NAME("multipart/mixed", HWIRE_MEDIA_MULTIPART_MIXED),
+    MEDIA_NAME("multipart/byteranges", HWIRE_MEDIA_MULTIPART_BYTERANGES),
+    MEDIA_NAME("text/plain", HWIRE_MEDIA_TEXT_PLAIN),
+    MEDIA_NAME("text/html", HWIRE_MEDIA_TEXT_HTML),
+    MEDIA_NAME("text/css", HWIRE_MEDIA_TEXT_CSS),
+    MEDIA_NAME("text/javascript", HWIRE_MEDIA_TEXT_JAVASCRIPT),
+    MEDIA_NAME("text/csv", HWIRE_MEDIA_TEXT_CSV),
+    MEDIA_NAME("text/xml", HWIRE_MEDIA_TEXT_XML),
+    MEDIA_NAME("text/event-stream", HWIRE_MEDIA_TEXT_EVENT_STREAM),
+    MEDIA_NAME("image/png", HWIRE_MEDIA_IMAGE_PNG),
+    MEDIA_NAME("image/jpeg", HWIRE_MEDIA_IMAGE_JPEG),
+    MEDIA_NAME("image/gif", HWIRE_MEDIA_IMAGE_GIF),
+    MEDIA_NAME("image/webp", HWIRE_MEDIA_IMAGE_WEBP),
+    MEDIA_NAME("image/svg+xml", HWIRE_MEDIA_IMAGE_SVG),
+};
+
+#undef MEDIA_NAME
+
+// longer than any well-known "type/subtype"
+#define MEDIA_NAME_MAX 48
+
+/**
+ * @brief Look up a lowercased "type/subtype"
+ */
+static hwire_media_id_t media_name_id(const char *name, size_t len)
+{
+    for (size_t i = 0; i < sizeof(MEDIA_NAMES) / sizeof(MEDIA_NAMES[0]); i++) {
+        if (MEDIA_NAMES[i].len == len &&
+            memcmp(MEDIA_NAMES[i].name, name, len) == 0) {
+            return (hwire_media_id_t)MEDIA_NAMES[i].id;
+        }
+    }
+    return HWIRE_MEDIA_OTHER;
+}
+
+/**
+ * @brief Parse a media type
+ *
+ * type and subtype are lowercased into a stack buffer by the same token
+ * scan that validates them; names too long for it cannot be well-known and
+ * are only validated.
+ */
+int hwire_parse_media_type(hwire_ctx_t *ctx, const char *str, size_t len,
+                           hwire_media_type_t *mt, uint8_t maxnparams)
+{
+    assert(ctx != NULL);
+    assert(str != NULL || len == 0);
+    assert(mt != NULL);
+    const unsigned char *ustr = (const unsigned char *)str;
+    char name[MEDIA_NAME_MAX];
+    hwire_buf_t lc = {.size = sizeof(name), .buf = name};
+    size_t cur     = 0;
+    size_t end     = len;
+    size_t n       = 0;
+    int rv         = HWIRE_OK;
+
+    // type "/"
+    n = strtchar(ustr, len, &lc);
+    if (n == SIZE_MAX) {
+        lc.size = 0;
+        n       = strtchar(ustr, len, NULL);
+    }
+    if (n == 0 || n >= len || ustr[n] != '/') {
+        return HWIRE_EILSEQ;
+    }
+    mt->type.ptr = str;
+    mt->type.len = n;
+    cur          = n + 1;
+
+    // subtype, lowercased right after "type/"
+    if (lc.size > 0 && n + 1 < sizeof(name)) {
+        name[n]  = '/';
+        lc.size -= n + 1;
+        lc.buf  += n + 1;
+        n        = strtchar(ustr + cur, len - cur, &lc);
+    } else {
+        n = SIZE_MAX;
+    }
+    mt->id = HWIRE_MEDIA_OTHER;
+    if (n == SIZE_MAX) {
+        n = strtchar(ustr + cur, len - cur, NULL);
+    } else {
+        mt->id = media_name_id(name, cur + n);
+    }
+    if (n == 0) {
+        return HWIRE_EILSEQ;
+    }
+    mt->subtype.ptr = str + cur;
+    mt->subtype.len = n;
+    cur += n;
+
+    // parameters; an empty one at the end would need more bytes
+    while (end > cur && (ustr[end - 1] == SEMICOLON || ustr[end - 1] == SP ||
+                         ustr[end - 1] == HT)) {
+        end--;
+    }
+    if (cur < end) {
+        rv = hwire_parse_parameters(ctx, str, end, &cur, end - cur,
+                                    maxnparams, 0);
+        if (rv == HWIRE_EAGAIN || rv == HWIRE_ELEN ||
+            (rv == HWIRE_OK && cur != end)) {
+            // truncated parameter or trailing garbage
+            return HWIRE_EILSEQ;
+        }
+    }
+    return rv;
+}
+
+#undef MEDIA_NAME_MAX
+
 /** @} */ /* end of String Parsing Functions */
 
 /**
@@ -1516,14 +2247,14 @@ CHECK_PARAM:
  *
  * @note This function requires CRLF (\\r\\n) as the line terminator.
  * @note Extensions with no value have empty string as value (ptr="" len=0).
+ *
+ * Body of hwire_parse_chunksize; also stores the chunk size in *chunksize.
+ * chunksize_cb and chunksize_ext_cb are called only when not NULL.
  */
-int hwire_parse_chunksize(hwire_ctx_t *ctx, const char *str, size_t len,
-                          size_t *pos, size_t maxlen, uint8_t maxexts)
+static int parse_chunksize(hwire_ctx_t *ctx, const char *str, size_t len,
+                           size_t *pos, size_t maxlen, uint8_t maxexts,
+                           uint32_t *chunksize)
 {
-    assert(str != NULL);
-    assert(pos != NULL);
-    assert(ctx != NULL);
-    assert(ctx->chunksize_cb != NULL);
     const unsigned char *ustr = (const unsigned char *)str;
     size_t cur  = 0; // hex2size always scans from str[0]; *pos is output-only
     size_t head = 0;
@@ -1552,7 +2283,8 @@ int hwire_parse_chunksize(hwire_ctx_t *ctx, const char *str, size_t len,
     }
 
     // call chunksize callback
-    if (ctx->chunksize_cb(ctx, (uint32_t)size)) {
+    *chunksize = (uint32_t)size;
+    if (ctx->chunksize_cb != NULL && ctx->chunksize_cb(ctx, *chunksize)) {
         return HWIRE_ECALLBACK;
     }
 
@@ -1611,7 +2343,8 @@ CHECK_EOL:
                 .key   = {.len = klen, .ptr = (const char *)key              },
                 .value = {.len = vlen, .ptr = (vlen) ? (const char *)val : ""}
             };
-            if (ctx->chunksize_ext_cb(ctx, &ext)) {
+            if (ctx->chunksize_ext_cb != NULL &&
+                ctx->chunksize_ext_cb(ctx, &ext)) {
                 return HWIRE_ECALLBACK;
             }
         }
@@ -1637,7 +2370,8 @@ CHECK_EOL:
             .key   = {.len = klen, .ptr = (const char *)key              },
             .value = {.len = vlen, .ptr = (vlen) ? (const char *)val : ""}
         };
-        if (ctx->chunksize_ext_cb(ctx, &ext)) {
+        if (ctx->chunksize_ext_cb != NULL &&
+            ctx->chunksize_ext_cb(ctx, &ext)) {
             return HWIRE_ECALLBACK;
         }
         nexts++;
@@ -1690,8 +2424,150 @@ CHECK_EOL:
 #undef skip_bws
 }
 
+/**
+ * @brief Parse chunk size
+ */
+int hwire_parse_chunksize(hwire_ctx_t *ctx, const char *str, size_t len,
+                          size_t *pos, size_t maxlen, uint8_t maxexts)
+{
+    assert(str != NULL);
+    assert(pos != NULL);
+    assert(ctx != NULL);
+    assert(ctx->chunksize_cb != NULL);
+    uint32_t size = 0;
+    return parse_chunksize(ctx, str, len, pos, maxlen, maxexts, &size);
+}
+
 /** @} */ /* end of Chunked Transfer Coding Functions */
 
+/**
+ * @name Header Index Functions
+ * @{
+ */
+
+/**
+ * @brief Find the bucket of a lowercased name
+ *
+ * Linear probing from hash & (nbuckets - 1).  Since nbuckets > nentries there
+ * is always at least one empty bucket, so the loop terminates.
+ *
+ * @return Bucket holding the first entry of name, or the empty bucket where
+ * it would be inserted
+ */
+static inline uint8_t *hdr_index_bucket(const hwire_hdr_index_t *idx,
+                                        const char *name, size_t len,
+                                        uint32_t hash)
+{
+    size_t mask = (size_t)idx->nbuckets - 1;
+    size_t i    = hash & mask;
+
+    while (idx->buckets[i]) {
+        const hwire_hdr_entry_t *e = &idx->entries[idx->buckets[i] - 1];
+        if (e->header.hash == hash && e->name.len == len &&
+            memcmp(e->name.ptr, name, len) == 0) {
+            break;
+        }
+        i = (i + 1) & mask;
+    }
+    return &idx->buckets[i];
+}
+
+/**
+ * @brief Reset the header index before parsing a header block
+ */
+static inline void hdr_index_reset(hwire_hdr_index_t *idx)
+{
+    assert(idx->entries != NULL);
+    assert(idx->buckets != NULL);
+    // nbuckets must be a power of two with at least one bucket left empty
+    assert(idx->nbuckets > idx->nentries);
+    assert((idx->nbuckets & (idx->nbuckets - 1)) == 0);
+
+    idx->count     = 0;
+    idx->names.len = 0;
+    memset(idx->buckets, 0, idx->nbuckets);
+}
+
+/**
+ * @brief Add a parsed header to the index
+ *
+ * The lowercased name and its hash are taken from key_lc when it is
+ * allocated; otherwise they are computed here from the raw field name.
+ *
+ * @return HWIRE_OK on success
+ * @return HWIRE_ENOBUFS if there is no room for the entry or its name
+ */
+static int hdr_index_add(hwire_hdr_index_t *idx, const hwire_header_t *header,
+                         const hwire_buf_t *key_lc)
+{
+    size_t len = header->key.len;
+    hwire_hdr_entry_t *e;
+    uint8_t *bucket;
+    char *name;
+
+    if (unlikely(idx->count >= idx->nentries ||
+                 len > idx->names.size - idx->names.len)) {
+        return HWIRE_ENOBUFS;
+    }
+
+    e         = &idx->entries[idx->count];
+    e->header = *header;
+    name      = idx->names.buf + idx->names.len;
+    if (key_lc->size > 0) {
+        memcpy(name, key_lc->buf, len);
+    } else {
+        const unsigned char *key = (const unsigned char *)header->key.ptr;
+        for (size_t i = 0; i < len; i++) {
+            name[i] = (char)TCHAR[key[i]];
+        }
+        e->header.hash = ~crc32c(UINT32_MAX, (const unsigned char *)name, len);
+    }
+    idx->names.len += len;
+    e->name.ptr = name;
+    e->name.len = len;
+    e->next     = 0;
+    e->last     = 0;
+    idx->count++;
+
+    bucket = hdr_index_bucket(idx, name, len, e->header.hash);
+    if (*bucket == 0) {
+        // first field with this name
+        *bucket = idx->count;
+        e->last = idx->count;
+    } else {
+        // duplicate name: append to the chain in arrival order
+        hwire_hdr_entry_t *first = &idx->entries[*bucket - 1];
+        idx->entries[first->last - 1].next = idx->count;
+        first->last                        = idx->count;
+    }
+    return HWIRE_OK;
+}
+
+const hwire_hdr_entry_t *hwire_hdr_index_get(const hwire_hdr_index_t *idx,
+                                             const char *name, size_t len)
+{
+    assert(idx != NULL);
+    assert(name != NULL);
+    uint32_t hash = ~crc32c(UINT32_MAX, (const unsigned char *)name, len);
+    uint8_t *bucket;
+
+    if (idx->count == 0) {
+        return NULL;
+    }
+    bucket = hdr_index_bucket(idx, name, len, hash);
+    return (*bucket) ? &idx->entries[*bucket - 1] : NULL;
+}
+
+const hwire_hdr_entry_t *hwire_hdr_index_next(const hwire_hdr_index_t *idx,
+                                              const hwire_hdr_entry_t *entry)
+{
+    assert(idx != NULL);
+    assert(entry != NULL);
+    return (entry->next) ? &idx->entries[entry->next - 1] : NULL;
+}
+
+/** @} */ /* end of Header Index Functions */
+
 /**
  * @name HTTP Headers Parsing Functions
  * @{
@@ -1739,6 +2615,7 @@ REMOVE_OWS:
         } else if (likely(endc == LF)) {
             // only LF found - valid end of header value, continue to trim OWS
             // and check LF
+            *cur = pos + 1; // skip LF
             goto REMOVE_OWS;
         } else if (unlikely(endc != CR)) {
             // invalid character in header value
@@ -1758,23 +2635,20 @@ REMOVE_OWS:
 }
 
 /**
- * @brief Parse header key and store lowercase in key_lc
+ * @brief Parse header key and store lowercase in lc
  *
  * Ported from parse.c:parse_hkey
+ *
+ * lc may be NULL to validate the key without copying it.
  */
 static int parse_hkey(const unsigned char *str, size_t len, size_t *cur,
-                      size_t *maxlen, hwire_ctx_t *ctx)
+                      size_t *maxlen, hwire_buf_t *lc)
 {
     size_t max       = (len > *maxlen) ? *maxlen : len;
-    size_t tchar_len = 0;
+    size_t tchar_len = strtchar(str, max, lc);
 
-    if (ctx->key_lc.size > 0) {
-        tchar_len = strtchar(str, max, &ctx->key_lc);
-        if (tchar_len == SIZE_MAX) {
-            return HWIRE_EKEYLEN;
-        }
-    } else {
-        tchar_len = strtchar(str, max, NULL);
+    if (tchar_len == SIZE_MAX) {
+        return HWIRE_EKEYLEN;
     }
 
     if (unlikely(tchar_len == 0)) {
@@ -1803,18 +2677,310 @@ static int parse_hkey(const unsigned char *str, size_t len, size_t *cur,
     return HWIRE_EAGAIN;
 }
 
+/**
+ * @brief Compare a field name with a lowercase name
+ *
+ * str must consist of tchar and lc of lowercase letters and '-' only; for
+ * such input OR-ing 0x20 into every byte of str folds case exactly.  Eight
+ * bytes are compared at a time, the last word overlapping the previous one.
+ *
+ * @param str Field name (tchar only)
+ * @param lc Lowercase name
+ * @param len Length of both names (must be at least 8)
+ * @return 1 if the names are equal ignoring case, 0 otherwise
+ */
+static inline int hname_eq(const unsigned char *str, const char *lc,
+                           size_t len)
+{
+    const uint64_t fold = 0x2020202020202020ULL;
+    uint64_t a, b;
+    size_t i = 0;
+
+    for (; i + 8 < len; i += 8) {
+        memcpy(&a, str + i, 8);
+        memcpy(&b, lc + i, 8);
+        if ((a | fold) != b) {
+            return 0;
+        }
+    }
+    memcpy(&a, str + len - 8, 8);
+    memcpy(&b, lc + len - 8, 8);
+    return (a | fold) == b;
+}
+
+/**
+ * @brief Compare a list element with a lowercase token
+ *
+ * lc must consist of lowercase letters, digits and '-' only, so OR-ing 0x20
+ * into the field-content bytes of str cannot produce a false match.
+ */
+static inline int token_eq(const unsigned char *str, size_t len,
+                           const char *lc, size_t lclen)
+{
+    if (len != lclen) {
+        return 0;
+    }
+    for (size_t i = 0; i < len; i++) {
+        if ((str[i] | 0x20) != (unsigned char)lc[i]) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/**
+ * @brief Get the next element of a comma-separated list
+ *
+ * #element = [ element ] *( OWS "," OWS [ element ] )
+ * RFC 9110 5.6.1: Lists.  Empty elements are skipped and OWS around each
+ * element is removed.
+ *
+ * @param str Field value (OWS already trimmed at both ends)
+ * @param len Length of field value
+ * @param cur Input/Output: scan position
+ * @param elem Output: next element (references str)
+ * @return 1 if an element was found, 0 at the end of the list
+ */
+static inline int next_list_elem(const unsigned char *str, size_t len,
+                                 size_t *cur, hwire_str_t *elem)
+{
+    size_t pos = *cur;
+    size_t end = 0;
+
+    while (pos < len) {
+        if (str[pos] == ',' || str[pos] == SP || str[pos] == HT) {
+            pos++;
+            continue;
+        }
+        end = pos;
+        while (end < len && str[end] != ',') {
+            end++;
+        }
+        *cur      = end;
+        elem->ptr = (const char *)(str + pos);
+        while (str[end - 1] == SP || str[end - 1] == HT) {
+            end--;
+        }
+        elem->len = end - pos;
+        return 1;
+    }
+    *cur = pos;
+    return 0;
+}
+
+/**
+ * @brief Parse a Content-Length field value
+ *
+ * Content-Length = 1*DIGIT
+ * RFC 9110 8.6: Content-Length
+ *
+ * @return HWIRE_OK on success
+ * @return HWIRE_EHDRVALUE if the value is empty or not all digits
+ * @return HWIRE_ERANGE if the value does not fit in 64 bits
+ */
+static int parse_content_length(const unsigned char *str, size_t len,
+                                uint64_t *value)
+{
+    uint64_t n = 0;
+
+    if (unlikely(len == 0)) {
+        return HWIRE_EHDRVALUE;
+    }
+    for (size_t i = 0; i < len; i++) {
+        unsigned int d = (unsigned int)str[i] - '0';
+        if (unlikely(d > 9)) {
+            return HWIRE_EHDRVALUE;
+        } else if (unlikely(n > UINT64_MAX / 10 ||
+                            (n == UINT64_MAX / 10 && d > UINT64_MAX % 10))) {
+            return HWIRE_ERANGE;
+        }
+        n = n * 10 + d;
+    }
+    *value = n;
+    return HWIRE_OK;
+}
+
+/**
+ * @brief Classify an invalid field line
+ *
+ * Called only after parse_hkey returned HWIRE_EHDRNAME, to report the
+ * request-smuggling vectors of RFC 9112 5.1 and 5.2 separately.
+ *
+ * @param str Start of the field line
+ * @param len Length of str
+ * @return HWIRE_EOBSFOLD if the line starts with whitespace
+ * @return HWIRE_EHDRWS if the field name is followed by whitespace
+ * @return HWIRE_EHDRNAME otherwise
+ */
+static int hname_error(const unsigned char *str, size_t len)
+{
+    size_t n = 0;
+
+    if (len > 0 && (str[0] == SP || str[0] == HT)) {
+        return HWIRE_EOBSFOLD;
+    }
+    while (n < len && is_tchar(str[n])) {
+        n++;
+    }
+    if (n > 0 && n < len && (str[n] == SP || str[n] == HT)) {
+        return HWIRE_EHDRWS;
+    }
+    return HWIRE_EHDRNAME;
+}
+
+// hwire_hash_key() of the framing-related field names
+#define HASH_CONNECTION        0x0BAC1178u
+#define HASH_CONTENT_LENGTH    0x187B63A4u
+#define HASH_EXPECT            0x6D83214Cu
+#define HASH_PROXY_CONNECTION  0x7A31525Au
+#define HASH_TRANSFER_ENCODING 0x4FF967FBu
+#define HASH_UPGRADE           0x51D8A237u
+
+/**
+ * @brief Record a framing-related header field
+ *
+ * Dispatches on the name length first, so most fields cost a single
+ * compare.  When the lowercase pass already produced the name hash, a
+ * mismatching hash rejects the field without touching the name again.
+ * Updates fr for Content-Length, Transfer-Encoding, Connection,
+ * Proxy-Connection, Upgrade and Expect; other fields are ignored.
+ *
+ * @param fr Framing state
+ * @param key Field name (tchar only)
+ * @param klen Length of field name
+ * @param hash CRC32C of the lowercased name, or 0 if not computed
+ * @param val Field value (OWS trimmed)
+ * @param vlen Length of field value
+ * @return HWIRE_OK on success
+ * @return HWIRE_EHDRVALUE for an invalid Content-Length
+ * @return HWIRE_ERANGE if Content-Length does not fit in 64 bits
+ * @return HWIRE_ECLDUP if Content-Length differs from an earlier one
+ */
+static int framing_field(hwire_framing_t *fr, const unsigned char *key,
+                         size_t klen, uint32_t hash, const unsigned char *val,
+                         size_t vlen)
+{
+    hwire_str_t elem = {0};
+    size_t cur       = 0;
+    uint64_t n       = 0;
+    int rv           = 0;
+
+    switch (klen) {
+    case 6:
+        if ((hash != 0 && hash != HASH_EXPECT) ||
+            !token_eq(key, klen, "expect", 6)) {
+            break;
+        }
+        // RFC 9110 10.1.1: the only defined expectation is 100-continue
+        while (next_list_elem(val, vlen, &cur, &elem)) {
+            if (token_eq((const unsigned char *)elem.ptr, elem.len,
+                         "100-continue", 12)) {
+                fr->flags |= HWIRE_FRAMING_CONTINUE;
+            }
+        }
+        break;
+
+    case 7:
+        if ((hash != 0 && hash != HASH_UPGRADE) ||
+            !token_eq(key, klen, "upgrade", 7)) {
+            break;
+        }
+        // protocol = protocol-name ["/" protocol-version]
+        while (next_list_elem(val, vlen, &cur, &elem)) {
+            const unsigned char *e = (const unsigned char *)elem.ptr;
+            const void *slash      = memchr(e, '/', elem.len);
+            size_t plen            = elem.len;
+            if (slash != NULL) {
+                plen = (size_t)((const unsigned char *)slash - e);
+            }
+            if (token_eq(e, plen, "websocket", 9)) {
+                fr->flags |= HWIRE_FRAMING_WEBSOCKET;
+            } else if (token_eq(e, plen, "h2c", 3)) {
+                fr->flags |= HWIRE_FRAMING_H2C;
+            }
+        }
+        break;
+
+    case 10:
+        if ((hash != 0 && hash != HASH_CONNECTION) ||
+            !hname_eq(key, "connection", 10)) {
+            break;
+        }
+        goto CONNECTION;
+
+    case 16:
+        // not standardized, but still sent by some HTTP/1.0 clients
+        if ((hash != 0 && hash != HASH_PROXY_CONNECTION) ||
+            !hname_eq(key, "proxy-connection", 16)) {
+            break;
+        }
+    CONNECTION:
+        while (next_list_elem(val, vlen, &cur, &elem)) {
+            const unsigned char *e = (const unsigned char *)elem.ptr;
+            if (token_eq(e, elem.len, "close", 5)) {
+                fr->flags |= HWIRE_FRAMING_CLOSE;
+            } else if (token_eq(e, elem.len, "keep-alive", 10)) {
+                fr->flags |= HWIRE_FRAMING_KEEP_ALIVE;
+            } else if (token_eq(e, elem.len, "upgrade", 7)) {
+                fr->flags |= HWIRE_FRAMING_UPGRADE;
+            }
+        }
+        break;
+
+    case 14:
+        if ((hash != 0 && hash != HASH_CONTENT_LENGTH) ||
+            !hname_eq(key, "content-length", 14)) {
+            break;
+        }
+        rv = parse_content_length(val, vlen, &n);
+        if (unlikely(rv != HWIRE_OK)) {
+            return rv;
+        } else if (fr->flags & HWIRE_FRAMING_CONTENT_LENGTH) {
+            // RFC 9110 8.6: differing values are unrecoverable
+            if (unlikely(fr->content_length != n)) {
+                return HWIRE_ECLDUP;
+            }
+        }
+        fr->content_length = n;
+        fr->flags |= HWIRE_FRAMING_CONTENT_LENGTH;
+        break;
+
+    case 17:
+        if ((hash != 0 && hash != HASH_TRANSFER_ENCODING) ||
+            !hname_eq(key, "transfer-encoding", 17)) {
+            break;
+        }
+        fr->flags |= HWIRE_FRAMING_TRANSFER_ENCODING;
+        // only the final transfer coding decides the framing
+        if (next_list_elem(val, vlen, &cur, &elem)) {
+            while (next_list_elem(val, vlen, &cur, &elem)) {
+            }
+            if (token_eq((const unsigned char *)elem.ptr, elem.len, "chunked",
+                         7)) {
+                fr->flags |= HWIRE_FRAMING_CHUNKED;
+            } else {
+                fr->flags &= (uint16_t)~HWIRE_FRAMING_CHUNKED;
+            }
+        }
+        break;
+    }
+    return HWIRE_OK;
+}
+
 /**
  * @brief Parse HTTP headers
  *
  * Ported from parse.c:parse_header
+ *
+ * Body of hwire_parse_headers.  idx is the header index to fill (NULL =
+ * none) and fr, if not NULL, receives the framing-related fields.  When
+ * hardened is non-zero invalid field names are classified by hname_error.
  */
-int hwire_parse_headers(hwire_ctx_t *ctx, const char *str, size_t len,
-                        size_t *pos, size_t maxlen, uint8_t maxnhdrs)
+static int parse_headers(hwire_ctx_t *ctx, const char *str, size_t len,
+                         size_t *pos, size_t maxlen, uint8_t maxnhdrs,
+                         hwire_hdr_index_t *idx, hwire_framing_t *fr,
+                         int hardened)
 {
-    assert(str != NULL);
-    assert(pos != NULL);
-    assert(ctx != NULL);
-    assert(ctx->header_cb != NULL);
     const unsigned char *ustr = (const unsigned char *)str;
     const unsigned char *top  = ustr;
     const unsigned char *head = 0;
@@ -1825,6 +2991,10 @@ int hwire_parse_headers(hwire_ctx_t *ctx, const char *str, size_t len,
     size_t vlen               = 0;
     hwire_header_t header;
 
+    if (idx != NULL) {
+        hdr_index_reset(idx);
+    }
+
 RETRY:
     // End-of-headers (CR/LF) or incomplete data — happens once per request,
     // not once per header. Use unlikely to keep the hot header-parsing path
@@ -1864,8 +3034,12 @@ RETRY:
     // header-field = field-name ":" OWS field-value OWS
     // field-name = token
     // RFC 7230 3.2 / RFC 9112 5.1: Field Names
-    rv              = parse_hkey(ustr, len, &cur, &klen, ctx);
+    rv              = parse_hkey(ustr, len, &cur, &klen,
+                                 (ctx->key_lc.size > 0) ? &ctx->key_lc : NULL);
     if (unlikely(rv != HWIRE_OK)) {
+        if (rv == HWIRE_EHDRNAME && hardened) {
+            return hname_error(ustr, len);
+        }
         return rv;
     }
 
@@ -1893,193 +3067,594 @@ RETRY:
     ustr += cur;
     len -= cur;
 
-    // set header key and value
+    // set header key, value and the name hash computed by parse_hkey
     header.key.ptr   = (const char *)head;
     header.key.len   = klen;
     header.value.len = vlen;
+    header.hash      = (ctx->key_lc.size > 0) ? ctx->key_lc.hash : 0;
+
+    if (fr != NULL) {
+        rv = framing_field(fr, head, klen, header.hash,
+                           (const unsigned char *)header.value.ptr, vlen);
+        if (unlikely(rv != HWIRE_OK)) {
+            return rv;
+        }
+    }
+
+    if (idx != NULL) {
+        rv = hdr_index_add(idx, &header, &ctx->key_lc);
+        if (unlikely(rv != HWIRE_OK)) {
+            return rv;
+        }
+    }
 
     // call callback
-    if (unlikely(ctx->header_cb(ctx, &header) != 0)) {
+    if (ctx->header_cb != NULL && unlikely(ctx->header_cb(ctx, &header) != 0)) {
         return HWIRE_ECALLBACK;
     }
 
     goto RETRY;
 }
 
-/** @} */ /* end of HTTP Headers Parsing Functions */
-
-/**
- * @name HTTP Request Parsing Functions
- * @{
- */
-
 /**
- * @brief Parse HTTP version string
- *
- * @param str String to parse (must not be NULL)
- * @param len Length of string
- * @param pos Output: position after version string (must not be NULL)
- * @param version Output: HTTP version enum
- * @return HWIRE_OK on success
- * @return HWIRE_EAGAIN if more data needed
- * @return HWIRE_EVERSION for invalid version
+ * @brief Parse HTTP headers
  */
-static int parse_version(const unsigned char *str, size_t len, size_t *pos,
-                         hwire_http_version_t *version)
+int hwire_parse_headers(hwire_ctx_t *ctx, const char *str, size_t len,
+                        size_t *pos, size_t maxlen, uint8_t maxnhdrs)
 {
-#define VER_LEN 8
-    if (len < VER_LEN) {
-        return HWIRE_EAGAIN;
+    assert(str != NULL);
+    assert(pos != NULL);
+    assert(ctx != NULL);
+    assert(ctx->header_cb != NULL || ctx->hdr_index != NULL ||
+           ctx->framing != NULL);
+    hwire_framing_t local;
+    hwire_framing_t *fr = ctx->framing;
+    int hardened        = (ctx->options & HWIRE_OPT_HARDENED) != 0;
+    size_t n            = 0;
+    int rv              = 0;
+
+    if (fr == NULL && hardened) {
+        fr = &local;
     }
-    if (memcmp(str, "HTTP/1.1", VER_LEN) == 0) {
-        *version = HWIRE_HTTP_V11;
-        *pos     = VER_LEN;
-        return HWIRE_OK;
-    } else if (memcmp(str, "HTTP/1.0", VER_LEN) == 0) {
-        *version = HWIRE_HTTP_V10;
-        *pos     = VER_LEN;
-        return HWIRE_OK;
+    if (fr != NULL) {
+        *fr = (hwire_framing_t){0};
     }
-    return HWIRE_EVERSION;
-#undef VER_LEN
+    rv = parse_headers(ctx, str, len, &n, maxlen, maxnhdrs, ctx->hdr_index, fr,
+                       hardened);
+    if (rv != HWIRE_OK) {
+        return rv;
+    } else if (hardened && (fr->flags & HWIRE_FRAMING_CONTENT_LENGTH) &&
+               (fr->flags & HWIRE_FRAMING_TRANSFER_ENCODING)) {
+        // RFC 9112 6.3: a message with both is a likely smuggling attempt
+        return HWIRE_ECLTE;
+    }
+    *pos = n;
+    return HWIRE_OK;
 }
 
 /**
- * @brief Parse request-target (URI)
- *
- * Scans the request-target until a space (SP) is found.
- * Defines the request-target as origin-form / absolute-form /
- * authority-form / asterisk-form (RFC 7230 3.1.1 / RFC 9112 3.2).
+ * @brief Check whether a field is forbidden in a trailer section
  *
- * @param str Input string
- * @param len Total length of input string
- * @param pos Output: position after parsed URI (excluding SP)
- * @param maxlen Maximum allowed length for URI
- * @param uri Output: URI string slice
- * @return HWIRE_OK on success
- * @return HWIRE_EAGAIN if more data is needed
- * @return HWIRE_ELEN if URI exceeds maxlen
- * @return HWIRE_EURI if invalid character is found
+ * RFC 9110 6.5.1: fields needed for message framing, routing, request
+ * modifiers, authentication, response control data or content processing
+ * must not be used as trailers; neither can connection-specific fields.
  */
-static int parse_uri(const unsigned char *str, size_t len, size_t *pos,
-                     size_t maxlen, hwire_str_t *uri)
+static int trailer_forbidden(const unsigned char *key, size_t klen)
 {
-    size_t limit   = len > maxlen ? maxlen : len;
-    size_t uri_len = strurichar(str, limit);
-
-    if (uri_len < len && str[uri_len] == SP) {
-        if (uri_len == 0) {
-            return HWIRE_EURI;
+#define NAME(s) {s, sizeof(s) - 1}
+    static const struct {
+        const char *name;
+        size_t len;
+    } names[] = {
+        NAME("te"),
+        NAME("age"),
+        NAME("date"),
+        NAME("host"),
+        NAME("vary"),
+        NAME("range"),
+        NAME("cookie"),
+        NAME("expect"),
+        NAME("pragma"),
+        NAME("expires"),
+        NAME("trailer"),
+        NAME("upgrade"),
+        NAME("warning"),
+        NAME("if-match"),
+        NAME("if-range"),
+        NAME("location"),
+        NAME("connection"),
+        NAME("keep-alive"),
+        NAME("set-cookie"),
+        NAME("retry-after"),
+        NAME("content-type"),
+        NAME("max-forwards"),
+        NAME("authorization"),
+        NAME("cache-control"),
+        NAME("content-range"),
+        NAME("if-none-match"),
+        NAME("content-length"),
+        NAME("content-encoding"),
+        NAME("proxy-connection"),
+        NAME("www-authenticate"),
+        NAME("if-modified-since"),
+        NAME("transfer-encoding"),
+        NAME("proxy-authenticate"),
+        NAME("if-unmodified-since"),
+        NAME("proxy-authorization"),
+    };
+#undef NAME
+
+    // names are sorted by length
+    for (size_t i = 0; i < sizeof(names) / sizeof(names[0]); i++) {
+        if (names[i].len > klen) {
+            break;
+        } else if (names[i].len == klen &&
+                   token_eq(key, klen, names[i].name, klen)) {
+            return 1;
         }
-        uri->ptr = (const char *)str;
-        uri->len = uri_len;
-        *pos     = uri_len + 1;
-        return HWIRE_OK;
-    }
-
-    if (uri_len != limit) {
-        // found an illegal character before reaching maxlen
-        return HWIRE_EURI;
-    } else if (uri_len == len) {
-        // reached end of string without finding SP, need more bytes
-        return HWIRE_EAGAIN;
     }
-    return HWIRE_ELEN;
+    return 0;
 }
 
 /**
- * @brief Parse HTTP method
+ * @brief Parse one field line
  *
- * Parses method as 1*tchar followed by SP.
+ * field-line = field-name ":" OWS field-value OWS, followed by its EOL.
+ * Used where a caller has to stop after every line (trailer sections and
+ * scatter/gather input); hwire_parse_headers keeps its own loop.
  *
- * @param str String to parse (must not be NULL)
- * @param len Length of string
- * @param pos Input: start offset, Output: end offset (must not be NULL)
- * @param method Output: method string slice
+ * @param ctx Parser context (key_lc receives the lowercased name)
+ * @param line Start of the field line (not an empty line)
+ * @param len Bytes available at line
+ * @param maxlen Maximum field line length
+ * @param hardened Non-zero to classify invalid names with hname_error
+ * @param field Output: field name, value and name hash
+ * @param linelen Output: length of the line including its EOL
  * @return HWIRE_OK on success
- * @return HWIRE_EAGAIN if more data needed
- * @return HWIRE_EMETHOD for invalid method (not tchar or no SP)
+ * @return HWIRE_EAGAIN if the line is incomplete
+ * @return Any error of parse_hkey / parse_hval or hname_error
  */
-static int parse_method(const unsigned char *str, size_t len, size_t *pos,
-                        hwire_str_t *method)
+static int parse_field_line(hwire_ctx_t *ctx, const unsigned char *line,
+                            size_t len, size_t maxlen, int hardened,
+                            hwire_header_t *field, size_t *linelen)
 {
     size_t cur  = 0;
-    size_t mlen = 0;
+    size_t eol  = 0;
+    size_t klen = maxlen;
+    size_t vlen = 0;
+    int rv      = 0;
 
-    // method = 1*tchar
-    mlen = hwire_parse_tchar((const char *)str, len, &cur);
-    if (mlen == 0) {
-        // first character is not tchar
-        return HWIRE_EMETHOD;
+    ctx->key_lc.len = 0;
+    rv              = parse_hkey(line, len, &cur, &klen,
+                                 (ctx->key_lc.size > 0) ? &ctx->key_lc : NULL);
+    if (unlikely(rv != HWIRE_OK)) {
+        if (rv == HWIRE_EHDRNAME && hardened) {
+            return hname_error(line, len);
+        }
+        return rv;
     }
-
-    // SP is required
-    if (cur >= len) {
-        return HWIRE_EAGAIN;
+    while (cur < len && (line[cur] == SP || line[cur] == HT)) {
+        cur++;
+    }
+    if (unlikely(cur > maxlen)) {
+        return HWIRE_EHDRLEN;
     }
-    if (str[cur] != SP) {
-        return HWIRE_EMETHOD;
+    vlen = maxlen - cur;
+    rv   = parse_hval(line + cur, len - cur, &eol, &vlen);
+    if (unlikely(rv != HWIRE_OK)) {
+        return rv;
     }
 
-    method->ptr = (const char *)str;
-    method->len = mlen;
-    *pos        = cur + 1; // skip SP
+    field->key.ptr   = (const char *)line;
+    field->key.len   = klen;
+    field->value.ptr = (const char *)line + cur;
+    field->value.len = vlen;
+    field->hash      = (ctx->key_lc.size > 0) ? ctx->key_lc.hash : 0;
+    *linelen         = cur + eol;
     return HWIRE_OK;
 }
 
 /**
- * @brief Parse request line
+ * @brief Parse a trailer section
+ *
+ * Body of hwire_parse_trailers.  Each field line is committed to *pos and
+ * *nfields once it has been reported, so an incomplete line is the only
+ * part scanned again on the next call.
  */
-int hwire_parse_request(hwire_ctx_t *ctx, const char *str, size_t len,
-                        size_t *pos, size_t maxlen, uint8_t maxnhdrs)
+static int parse_trailers(hwire_ctx_t *ctx, const char *str, size_t len,
+                          size_t *pos, size_t maxlen, uint8_t maxnfields,
+                          uint8_t *nfields, int hardened)
 {
-    assert(str != NULL);
-    assert(pos != NULL);
-    assert(ctx != NULL);
-    assert(ctx->request_cb != NULL);
-    assert(ctx->header_cb != NULL);
     const unsigned char *ustr = (const unsigned char *)str;
-    const unsigned char *top  = ustr;
-    hwire_request_t req;
-    size_t cur = 0;
-    int rv     = 0;
+    const unsigned char *line = NULL;
+    size_t done               = 0; // end of the last complete field line
+    size_t rest               = 0;
+    size_t n                  = 0;
+    int rv                    = 0;
+    hwire_header_t field;
+
+    for (;;) {
+        *pos = done;
+        line = ustr + done;
+        rest = len - done;
+        if (unlikely(rest == 0)) {
+            return HWIRE_EAGAIN;
+        } else if (*line == CR) {
+            if (unlikely(rest < 2)) {
+                return HWIRE_EAGAIN;
+            } else if (likely(line[1] == LF)) {
+                *pos = done + 2;
+                return HWIRE_OK;
+            }
+        } else if (*line == LF) {
+            *pos = done + 1;
+            return HWIRE_OK;
+        }
+
+        if (unlikely(*nfields >= maxnfields)) {
+            return HWIRE_ENOBUFS;
+        }
+        rv = parse_field_line(ctx, line, rest, maxlen, hardened, &field, &n);
+        if (unlikely(rv != HWIRE_OK)) {
+            return rv;
+        }
+
+        if (unlikely(trailer_forbidden(line, field.key.len))) {
+            // RFC 9110 6.5.1: recipients may discard such fields
+            if (hardened) {
+                return HWIRE_ETRAILER;
+            }
+        } else if (ctx->header_cb != NULL &&
+                   unlikely(ctx->header_cb(ctx, &field) != 0)) {
+            return HWIRE_ECALLBACK;
+        }
+
+        done += n;
+        (*nfields)++;
+    }
+}
+
+/**
+ * @brief Parse a chunked trailer section
+ */
+int hwire_parse_trailers(hwire_ctx_t *ctx, const char *str, size_t len,
+                         size_t *pos, size_t maxlen, uint8_t maxnfields,
+                         uint8_t *nfields)
+{
+    assert(ctx != NULL);
+    assert(str != NULL || len == 0);
+    assert(pos != NULL);
+    assert(nfields != NULL);
+    return parse_trailers(ctx, str, len, pos, maxlen, maxnfields, nfields,
+                          (ctx->options & HWIRE_OPT_HARDENED) != 0);
+}
+
+/** @} */ /* end of HTTP Headers Parsing Functions */
+
+/**
+ * @name HTTP Request Parsing Functions
+ * @{
+ */
+
+/**
+ * @brief Parse HTTP version string
+ *
+ * @param str String to parse (must not be NULL)
+ * @param len Length of string
+ * @param pos Output: position after version string (must not be NULL)
+ * @param version Output: HTTP version enum
+ * @return HWIRE_OK on success
+ * @return HWIRE_EAGAIN if more data needed
+ * @return HWIRE_EVERSION for invalid version
+ */
+static int parse_version(const unsigned char *str, size_t len, size_t *pos,
+                         hwire_http_version_t *version)
+{
+#define VER_LEN 8
+    uint64_t v, v11, v10;
+
+    if (len < VER_LEN) {
+        return HWIRE_EAGAIN;
+    }
+    // compare all 8 bytes at once; memcpy keeps the loads alignment-safe and
+    // is folded into a single load (constants are folded at compile time)
+    memcpy(&v, str, VER_LEN);
+    memcpy(&v11, "HTTP/1.1", VER_LEN);
+    memcpy(&v10, "HTTP/1.0", VER_LEN);
+    if (likely(v == v11)) {
+        *version = HWIRE_HTTP_V11;
+        *pos     = VER_LEN;
+        return HWIRE_OK;
+    } else if (v == v10) {
+        *version = HWIRE_HTTP_V10;
+        *pos     = VER_LEN;
+        return HWIRE_OK;
+    }
+    return HWIRE_EVERSION;
+#undef VER_LEN
+}
+
+/**
+ * @brief Split the request-target and classify its form
+ *
+ * RFC 9112 3.2: origin-form starts with "/", asterisk-form is "*" and
+ * authority-form is only used with CONNECT; anything else is taken as
+ * absolute-form.  A fragment cannot occur since '#' is not a URI_CHAR.
+ *
+ * @param req Request with method and uri set
+ * @param mlen Length of the method
+ * @param qoff Offset of the first '?' in uri (any value >= uri.len if none)
+ */
+static inline void set_request_target(hwire_request_t *req, size_t mlen,
+                                      size_t qoff)
+{
+    const char *uri = req->uri.ptr;
+    size_t len      = req->uri.len;
+
+    if (qoff < len) {
+        req->path.len  = qoff;
+        req->query.ptr = uri + qoff + 1;
+        req->query.len = len - qoff - 1;
+    } else {
+        req->path.len  = len;
+        req->query.ptr = NULL;
+        req->query.len = 0;
+    }
+    req->path.ptr = uri;
+
+    if (likely(uri[0] == '/')) {
+        req->form = HWIRE_TARGET_ORIGIN;
+    } else if (len == 1 && uri[0] == '*') {
+        req->form = HWIRE_TARGET_ASTERISK;
+    } else if (mlen == 7 && memcmp(req->method.ptr, "CONNECT", 7) == 0) {
+        req->form = HWIRE_TARGET_AUTHORITY;
+    } else {
+        req->form = HWIRE_TARGET_ABSOLUTE;
+    }
+}
+
+/**
+ * @brief Parse method and request-target of the request line
+ *
+ * Parses `method SP request-target SP` in a single sweep.  With AVX2/SSSE3
+ * every 32/16-byte block is loaded once and classified against both the
+ * tchar and the URI nibble tables; the method end, the request-target end
+ * and the following SP are then resolved from the two bitmasks of the same
+ * block.  For typical request lines ("GET /path HTTP/1.1") the method and
+ * the request-target are found in the first block.  Other builds run the
+ * same two scans back to back using the scalar lookup tables.
+ *
+ * The first '?' of the request-target is located in the same blocks, so the
+ * path and query slices and the form of the request-target come for free.
+ *
+ * The method length is not limited; the request-target is limited to maxlen.
+ *
+ * @param str String to parse (must not be NULL)
+ * @param len Length of string
+ * @param pos Output: position after the SP that follows the request-target
+ * @param maxlen Maximum allowed length for the request-target
+ * @param req Output: method, uri, path and query slices and target form
+ * @return HWIRE_OK on success
+ * @return HWIRE_EAGAIN if more data is needed
+ * @return HWIRE_EMETHOD for invalid method (not tchar or no SP)
+ * @return HWIRE_ELEN if the request-target exceeds maxlen
+ * @return HWIRE_EURI if invalid character is found in the request-target
+ */
+static int parse_request_line(const unsigned char *str, size_t len,
+                              size_t *pos, size_t maxlen, hwire_request_t *req)
+{
+    size_t cur  = 0;        // scan position (block start in the SIMD loop)
+    size_t mlen = SIZE_MAX; // method length, SIZE_MAX while unresolved
+    size_t uri  = 0;        // start of request-target
+    size_t ulen = SIZE_MAX; // leading URI characters at uri, SIZE_MAX while
+                            // unresolved
+    size_t query = SIZE_MAX; // first '?' at or after uri, SIZE_MAX if none
+    size_t limit;
+
+#if defined(__AVX2__) || defined(__SSSE3__)
+# if defined(__AVX2__)
+#  define BLOCK 32
+    const __m256i t_lut  = _mm256_broadcastsi128_si256(
+        _mm_loadu_si128((const __m128i *)(const void *)TCHAR_NIBBLE_LO));
+    const __m256i u_lut  = _mm256_broadcastsi128_si256(
+        _mm_loadu_si128((const __m128i *)(const void *)URI_NIBBLE_LO));
+    const __m256i hi_lut = _mm256_broadcastsi128_si256(
+        _mm_loadu_si128((const __m128i *)(const void *)TCHAR_NIBBLE_HI));
+    const __m256i nibble = _mm256_set1_epi8(0x0F);
+    const __m256i zero   = _mm256_setzero_si256();
+    const __m256i qmark  = _mm256_set1_epi8('?');
+# else
+#  define BLOCK 16
+    const __m128i t_lut =
+        _mm_loadu_si128((const __m128i *)(const void *)TCHAR_NIBBLE_LO);
+    const __m128i u_lut =
+        _mm_loadu_si128((const __m128i *)(const void *)URI_NIBBLE_LO);
+    const __m128i hi_lut =
+        _mm_loadu_si128((const __m128i *)(const void *)TCHAR_NIBBLE_HI);
+    const __m128i nibble = _mm_set1_epi8(0x0F);
+    const __m128i zero   = _mm_setzero_si128();
+    const __m128i qmark  = _mm_set1_epi8('?');
+# endif
+
+    while (cur + BLOCK <= len) {
+        // bit i of tbad/ubad is set if str[cur + i] is not tchar/URI char
+# if defined(__AVX2__)
+        __m256i data =
+            _mm256_loadu_si256((const __m256i *)(const void *)(str + cur));
+        __m256i lo = _mm256_and_si256(data, nibble);
+        __m256i hi_v = _mm256_shuffle_epi8(
+            hi_lut, _mm256_and_si256(_mm256_srli_epi16(data, 4), nibble));
+        uint64_t tbad = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(
+            _mm256_and_si256(_mm256_shuffle_epi8(t_lut, lo), hi_v), zero));
+        uint64_t ubad = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(
+            _mm256_and_si256(_mm256_shuffle_epi8(u_lut, lo), hi_v), zero));
+        uint64_t qpos =
+            (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(data, qmark));
+# else
+        __m128i data =
+            _mm_loadu_si128((const __m128i *)(const void *)(str + cur));
+        __m128i lo   = _mm_and_si128(data, nibble);
+        __m128i hi_v = _mm_shuffle_epi8(
+            hi_lut, _mm_and_si128(_mm_srli_epi16(data, 4), nibble));
+        uint64_t tbad = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(
+            _mm_and_si128(_mm_shuffle_epi8(t_lut, lo), hi_v), zero));
+        uint64_t ubad = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(
+            _mm_and_si128(_mm_shuffle_epi8(u_lut, lo), hi_v), zero));
+        uint64_t qpos =
+            (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(data, qmark));
+# endif
+        if (mlen == SIZE_MAX) {
+            if (!tbad) {
+                cur += BLOCK;
+                continue;
+            }
+            // method ends at the first non-tchar, which must be SP
+            mlen = cur + (size_t)ctz32((unsigned)tbad);
+            if (mlen == 0 || str[mlen] != SP) {
+                return HWIRE_EMETHOD;
+            }
+            uri = mlen + 1;
+            // ignore the method bytes and the SP (uri - cur <= BLOCK)
+            ubad &= ~(uint64_t)0 << (uri - cur);
+            qpos &= ~(uint64_t)0 << (uri - cur);
+        }
+        if (query == SIZE_MAX && qpos) {
+            // may lie past the request-target; checked once ulen is known
+            query = cur + (size_t)ctz32((unsigned)qpos);
+        }
+        if (ubad) {
+            ulen = cur + (size_t)ctz32((unsigned)ubad) - uri;
+            break;
+        }
+        cur += BLOCK;
+        if (cur - uri > maxlen) {
+            // request-target already longer than maxlen
+            ulen = cur - uri;
+            break;
+        }
+    }
+# undef BLOCK
+#endif
+
+    if (ulen == SIZE_MAX) {
+        // scalar tail (or whole line without SIMD)
+        if (mlen == SIZE_MAX) {
+            // method = 1*tchar
+            while (cur < len && TCHAR[str[cur]]) {
+                cur++;
+            }
+            if (cur == 0) {
+                // first character is not tchar
+                return HWIRE_EMETHOD;
+            }
+            // SP is required
+            if (cur >= len) {
+                return HWIRE_EAGAIN;
+            }
+            if (str[cur] != SP) {
+                return HWIRE_EMETHOD;
+            }
+            mlen = cur;
+            uri  = cur + 1;
+            cur  = uri;
+        }
+        // request-target: scan no further than one byte past maxlen
+        limit = len - cur;
+        if (limit > maxlen - (cur - uri)) {
+            limit = maxlen - (cur - uri) + 1;
+        }
+        ulen = cur - uri + strurichar(str + cur, limit);
+        if (query == SIZE_MAX && uri + ulen > cur) {
+            const void *q = memchr(str + cur, '?', uri + ulen - cur);
+            if (q != NULL) {
+                query = (size_t)((const unsigned char *)q - str);
+            }
+        }
+    }
+
+    req->method.ptr = (const char *)str;
+    req->method.len = mlen;
+
+    // request-target = origin-form / absolute-form / authority-form /
+    // asterisk-form RFC 7230 3.1.1 / RFC 9112 3.2: Request Target
+    len -= uri;
+    limit = (len > maxlen) ? maxlen : len;
+    if (ulen > limit) {
+        ulen = limit;
+    }
+    if (ulen < len && str[uri + ulen] == SP) {
+        if (ulen == 0) {
+            return HWIRE_EURI;
+        }
+        req->uri.ptr = (const char *)(str + uri);
+        req->uri.len = ulen;
+        set_request_target(req, mlen, query - uri);
+        *pos = uri + ulen + 1;
+        return HWIRE_OK;
+    }
+
+    if (ulen != limit) {
+        // found an illegal character before reaching maxlen
+        return HWIRE_EURI;
+    } else if (ulen == len) {
+        // reached end of string without finding SP, need more bytes
+        return HWIRE_EAGAIN;
+    }
+    return HWIRE_ELEN;
+}
+
+/**
+ * @brief Parse request line
+ *
+ * Skips leading empty lines, then parses the request-line including its
+ * end-of-line.
+ *
+ * @param str String to parse (must not be NULL)
+ * @param len Length of string
+ * @param pos Output: bytes consumed from str[0] (must not be NULL)
+ * @param maxlen Maximum allowed length for the request-target
+ * @param req Output: parsed request line
+ * @return HWIRE_OK on success
+ * @return HWIRE_EAGAIN if more data needed
+ * @return HWIRE_EMETHOD for invalid method
+ * @return HWIRE_EVERSION for invalid HTTP version
+ * @return HWIRE_EEOL for invalid end-of-line
+ * @return HWIRE_ELEN if the request-target exceeds maxlen
+ * @return HWIRE_EURI for invalid URI character
+ */
+static int parse_request_head(const unsigned char *str, size_t len,
+                              size_t *pos, size_t maxlen, hwire_request_t *req)
+{
+    const unsigned char *top = str;
+    size_t cur               = 0;
+    int rv                   = 0;
 
 SKIP_NEXT_CRLF:
     if (unlikely(len == 0)) {
         return HWIRE_EAGAIN;
     }
-    switch (*ustr) {
+    switch (*str) {
     case CR:
     case LF:
-        ustr++;
+        str++;
         len--;
         goto SKIP_NEXT_CRLF;
     }
 
-    // parse method
-    // method = 1*tchar
-    // RFC 7230 3.1.1 / RFC 9112 3.1: Method
-    rv = parse_method(ustr, len, &cur, &req.method);
+    // parse method and request-target in one sweep
+    // request-line = method SP request-target SP HTTP-version
+    // RFC 7230 3.1.1 / RFC 9112 3: Request Line
+    rv = parse_request_line(str, len, &cur, maxlen, req);
     if (rv != HWIRE_OK) {
         return rv;
     }
-    ustr += cur;
-    len -= cur;
-
-    // parse-uri (find SP delimiter)
-    // request-target = origin-form / absolute-form / authority-form /
-    // asterik-form RFC 7230 3.1.1 / RFC 9112 3.2: Request Target
-    rv = parse_uri(ustr, len, &cur, maxlen, &req.uri);
-    if (rv != HWIRE_OK) {
-        return rv;
-    }
-    ustr += cur;
+    str += cur;
     len -= cur;
 
     // parse version
     // HTTP-version = HTTP-name "/" DIGIT "." DIGIT
     // RFC 7230 2.6 / RFC 9110 2.5: Protocol Versioning
-    rv = parse_version(ustr, len, &cur, &req.version);
+    rv = parse_version(str, len, &cur, &req->version);
     if (rv != HWIRE_OK) {
         return rv;
     }
@@ -2088,11 +3663,11 @@ SKIP_NEXT_CRLF:
     if (unlikely(cur >= len)) {
         return HWIRE_EAGAIN;
     }
-    switch (ustr[cur]) {
+    switch (str[cur]) {
     case CR:
         if (cur + 1 >= len) {
             return HWIRE_EAGAIN;
-        } else if (ustr[cur + 1] != LF) {
+        } else if (str[cur + 1] != LF) {
             // invalid end-of-line terminator
             return HWIRE_EEOL;
         }
@@ -2106,6 +3681,59 @@ SKIP_NEXT_CRLF:
         return HWIRE_EVERSION;
     }
 
+    *pos = (size_t)(str + cur - top);
+    return HWIRE_OK;
+}
+
+/**
+ * @brief Match the HTTP/2 client connection preface
+ *
+ * Called after the request-line failed on its version, so the common case
+ * of an HTTP/1.x request never gets here.
+ *
+ * @return HWIRE_EPREFACE with *pos set past the preface
+ * @return HWIRE_EAGAIN if str is a proper prefix of the preface
+ * @return HWIRE_EVERSION otherwise
+ */
+static int h2_preface(const unsigned char *str, size_t len, size_t *pos)
+{
+    if (len < HWIRE_H2_PREFACE_LEN) {
+        return memcmp(str, HWIRE_H2_PREFACE, len) == 0 ? HWIRE_EAGAIN :
+                                                         HWIRE_EVERSION;
+    }
+    if (memcmp(str, HWIRE_H2_PREFACE, HWIRE_H2_PREFACE_LEN) != 0) {
+        return HWIRE_EVERSION;
+    }
+    *pos = HWIRE_H2_PREFACE_LEN;
+    return HWIRE_EPREFACE;
+}
+
+/**
+ * @brief Parse HTTP request
+ */
+int hwire_parse_request(hwire_ctx_t *ctx, const char *str, size_t len,
+                        size_t *pos, size_t maxlen, uint8_t maxnhdrs)
+{
+    assert(str != NULL);
+    assert(pos != NULL);
+    assert(ctx != NULL);
+    assert(ctx->request_cb != NULL);
+    assert(ctx->header_cb != NULL || ctx->hdr_index != NULL ||
+           ctx->framing != NULL);
+    const unsigned char *ustr = (const unsigned char *)str;
+    const unsigned char *top  = ustr;
+    hwire_request_t req;
+    size_t cur = 0;
+    int rv     = 0;
+
+    rv = parse_request_head(ustr, len, &cur, maxlen, &req);
+    if (rv != HWIRE_OK) {
+        // "PRI * HTTP/2.0" is a valid request-line up to its version
+        if (rv == HWIRE_EVERSION) {
+            rv = h2_preface(ustr, len, pos);
+        }
+        return rv;
+    }
     ustr += cur;
     len -= cur;
 
@@ -2216,75 +3844,232 @@ static int parse_status(const unsigned char *str, size_t len, size_t *cur,
 }
 
 /**
- * @brief Parse HTTP response
+ * @brief Common status lines
  *
- * Parses status line and headers, calling response_cb after status line
- * and header_cb for each header.
+ * Complete "HTTP/1.1 <status> <reason>\r\n" lines for the most frequent
+ * responses.  Every line is longer than 16 bytes, so the first 16 bytes can
+ * always be compared with a single vector compare.
  */
-int hwire_parse_response(hwire_ctx_t *ctx, const char *str, size_t len,
-                         size_t *pos, size_t maxlen, uint8_t maxnhdrs)
+typedef struct {
+    const char *line; /**< Complete status line including CRLF */
+    uint8_t len;      /**< Length of line */
+    uint16_t status;  /**< Status code */
+} status_line_t;
+
+#define STATUS_LINE(status, reason)                                            \
+    {"HTTP/1.1 " #status " " reason "\r\n",                                    \
+     (uint8_t)(sizeof("HTTP/1.1 " #status " " reason "\r\n") - 1), status}
+
+static const status_line_t STATUS_LINES[] = {
+    STATUS_LINE(200, "OK"),
+    STATUS_LINE(204, "No Content"),
+    STATUS_LINE(301, "Moved Permanently"),
+    STATUS_LINE(302, "Found"),
+    STATUS_LINE(304, "Not Modified"),
+    STATUS_LINE(404, "Not Found"),
+    STATUS_LINE(500, "Internal Server Error"),
+};
+
+#undef STATUS_LINE
+
+// offset of the reason-phrase in a status line: "HTTP/1.1 200 "
+#define STATUS_LINE_REASON 13
+
+/**
+ * @brief Match the input against the common status lines
+ *
+ * Picks the only candidate from the three status digits, then compares the
+ * first 16 bytes at once (SSE2/NEON, or two 8-byte words) and the remaining
+ * bytes with memcmp.
+ *
+ * @param str String to parse (must not be NULL)
+ * @param len Length of string (must be at least 17)
+ * @return Matching entry of STATUS_LINES, or NULL
+ */
+static inline const status_line_t *match_status_line(const unsigned char *str,
+                                                     size_t len)
 {
-    assert(str != NULL);
-    assert(pos != NULL);
-    assert(ctx != NULL);
-    assert(ctx->response_cb != NULL);
-    assert(ctx->header_cb != NULL);
-    const unsigned char *ustr = (const unsigned char *)str;
-    const unsigned char *top  = ustr;
-    hwire_response_t rsp;
-    size_t cur = 0;
-    int rv     = 0;
+#define STATUS3(a, b, c) ((uint32_t)(a) << 16 | (uint32_t)(b) << 8 | (c))
+    const status_line_t *sl;
+
+    switch (STATUS3(str[9], str[10], str[11])) {
+    case STATUS3('2', '0', '0'):
+        sl = &STATUS_LINES[0];
+        break;
+    case STATUS3('2', '0', '4'):
+        sl = &STATUS_LINES[1];
+        break;
+    case STATUS3('3', '0', '1'):
+        sl = &STATUS_LINES[2];
+        break;
+    case STATUS3('3', '0', '2'):
+        sl = &STATUS_LINES[3];
+        break;
+    case STATUS3('3', '0', '4'):
+        sl = &STATUS_LINES[4];
+        break;
+    case STATUS3('4', '0', '4'):
+        sl = &STATUS_LINES[5];
+        break;
+    case STATUS3('5', '0', '0'):
+        sl = &STATUS_LINES[6];
+        break;
+    default:
+        return NULL;
+    }
+#undef STATUS3
+
+    if (len < sl->len) {
+        return NULL;
+    }
+#if defined(__SSE2__)
+    if (_mm_movemask_epi8(_mm_cmpeq_epi8(
+            _mm_loadu_si128((const __m128i *)(const void *)str),
+            _mm_loadu_si128((const __m128i *)(const void *)sl->line))) !=
+        0xFFFF) {
+        return NULL;
+    }
+#elif defined(__aarch64__)
+    if (vminvq_u8(vceqq_u8(vld1q_u8(str),
+                           vld1q_u8((const uint8_t *)sl->line))) != 0xFF) {
+        return NULL;
+    }
+#else
+    {
+        uint64_t a[2], b[2];
+        memcpy(a, str, 16);
+        memcpy(b, sl->line, 16);
+        if (((a[0] ^ b[0]) | (a[1] ^ b[1])) != 0) {
+            return NULL;
+        }
+    }
+#endif
+    if (memcmp(str + 16, sl->line + 16, (size_t)sl->len - 16) != 0) {
+        return NULL;
+    }
+    return sl;
+}
+
+/**
+ * @brief Parse status line
+ *
+ * Skips leading empty lines, then parses the status-line including its
+ * end-of-line.  Lines listed in STATUS_LINES are matched directly.
+ *
+ * @param str String to parse (must not be NULL)
+ * @param len Length of string
+ * @param pos Output: bytes consumed from str[0] (must not be NULL)
+ * @param maxlen Maximum allowed length for the reason-phrase
+ * @param rsp Output: parsed status line
+ * @return HWIRE_OK on success
+ * @return HWIRE_EAGAIN if more data needed
+ * @return HWIRE_ESTATUS for invalid status code
+ * @return HWIRE_EVERSION for invalid HTTP version
+ * @return HWIRE_EEOL for invalid end-of-line
+ * @return HWIRE_EILSEQ for invalid character in reason phrase
+ * @return HWIRE_ELEN if the reason-phrase exceeds maxlen
+ */
+static int parse_status_line(const unsigned char *str, size_t len,
+                             size_t *pos, size_t maxlen, hwire_response_t *rsp)
+{
+    const unsigned char *top = str;
+    size_t cur               = 0;
+    int rv                   = 0;
 
 SKIP_NEXT_CRLF:
     if (unlikely(len == 0)) {
         return HWIRE_EAGAIN;
     }
-    switch (*ustr) {
+    switch (*str) {
     case CR:
     case LF:
-        ustr++;
+        str++;
         len--;
         goto SKIP_NEXT_CRLF;
     }
 
+    // fast path: the whole status line is one of STATUS_LINES.
+    // The reason-phrase must be shorter than maxlen, as in parse_reason;
+    // otherwise fall back to the general path to report the error.
+    if (likely(len > 16)) {
+        const status_line_t *sl = match_status_line(str, len);
+        if (sl != NULL && (size_t)sl->len - STATUS_LINE_REASON - 2 < maxlen) {
+            rsp->version    = HWIRE_HTTP_V11;
+            rsp->status     = sl->status;
+            rsp->reason.ptr = (const char *)(str + STATUS_LINE_REASON);
+            rsp->reason.len = (size_t)sl->len - STATUS_LINE_REASON - 2;
+            *pos            = (size_t)(str + sl->len - top);
+            return HWIRE_OK;
+        }
+    }
+
     // parse version
     // status-line = HTTP-version SP status-code SP reason-phrase CRLF
     // RFC 7230 3.1.2 / RFC 9112 4: Status Line
-    // RFC 7230 3.1.2 / RFC 9112 4: Status Line
-    rv = parse_version(ustr, len, &cur, &rsp.version);
+    rv = parse_version(str, len, &cur, &rsp->version);
     if (rv != HWIRE_OK) {
         return rv;
     } else if (cur >= len) {
         return HWIRE_EAGAIN;
-    } else if (ustr[cur] != SP) {
+    } else if (str[cur] != SP) {
         return HWIRE_EVERSION;
     }
-    ustr += cur + 1;
+    str += cur + 1;
     len -= cur + 1;
 
     // parse status
     // status-code = 3DIGIT
     // RFC 7230 3.1.2 / RFC 9112 4: Status Code
-    rv = parse_status(ustr, len, &cur, &rsp.status);
+    rv = parse_status(str, len, &cur, &rsp->status);
     if (rv != HWIRE_OK) {
         return rv;
     }
-    ustr += cur;
+    str += cur;
     len -= cur;
 
     // parse reason
     // reason-phrase = *( HTAB / SP / VCHAR / obs-text )
     // RFC 7230 3.1.2 / RFC 9112 4: Reason Phrase
-    rsp.reason.ptr = (const char *)ustr;
-    rsp.reason.len = maxlen;
-    rv             = parse_reason(ustr, len, &cur, &rsp.reason.len);
+    rsp->reason.ptr = (const char *)str;
+    rsp->reason.len = maxlen;
+    rv              = parse_reason(str, len, &cur, &rsp->reason.len);
     if (rv != HWIRE_OK) {
         return rv;
     }
-    ustr += cur;
-    len -= cur;
 
-    // call response callback
+    *pos = (size_t)(str + cur - top);
+    return HWIRE_OK;
+}
+
+/**
+ * @brief Parse HTTP response
+ *
+ * Parses status line and headers, calling response_cb after status line
+ * and header_cb for each header.
+ */
+int hwire_parse_response(hwire_ctx_t *ctx, const char *str, size_t len,
+                         size_t *pos, size_t maxlen, uint8_t maxnhdrs)
+{
+    assert(str != NULL);
+    assert(pos != NULL);
+    assert(ctx != NULL);
+    assert(ctx->response_cb != NULL);
+    assert(ctx->header_cb != NULL || ctx->hdr_index != NULL ||
+           ctx->framing != NULL);
+    const unsigned char *ustr = (const unsigned char *)str;
+    const unsigned char *top  = ustr;
+    hwire_response_t rsp;
+    size_t cur = 0;
+    int rv     = 0;
+
+    rv = parse_status_line(ustr, len, &cur, maxlen, &rsp);
+    if (rv != HWIRE_OK) {
+        return rv;
+    }
+    ustr += cur;
+    len -= cur;
+
+    // call response callback
     if (ctx->response_cb(ctx, &rsp) != 0) {
         return HWIRE_ECALLBACK;
     }
@@ -2304,4 +4089,4552 @@ SKIP_NEXT_CRLF:
 
 /** @} */ /* end of HTTP Response Parsing Functions */
 
+/**
+ * @name Scatter/Gather Parsing Functions
+ * @{
+ */
+
+/**
+ * @brief Read position in a sequence of segments
+ */
+typedef struct {
+    const hwire_iov_t *iov;
+    size_t iovcnt;
+    size_t idx; // current segment
+    size_t off; // offset in iov[idx]
+    size_t pos; // bytes consumed from all segments
+} iov_cursor_t;
+
+/**
+ * @brief Get the unread bytes of the current segment
+ *
+ * Steps over exhausted and empty segments first.
+ *
+ * @return Number of bytes at *ptr, 0 at the end of the input
+ */
+static size_t iov_peek(iov_cursor_t *c, const unsigned char **ptr)
+{
+    while (c->idx < c->iovcnt && c->off >= c->iov[c->idx].len) {
+        c->idx++;
+        c->off = 0;
+    }
+    if (c->idx == c->iovcnt) {
+        return 0;
+    }
+    *ptr = (const unsigned char *)c->iov[c->idx].base + c->off;
+    return c->iov[c->idx].len - c->off;
+}
+
+/**
+ * @brief Consume n bytes, which must be available
+ */
+static void iov_advance(iov_cursor_t *c, size_t n)
+{
+    const unsigned char *ptr = NULL;
+
+    c->pos += n;
+    while (n > 0) {
+        size_t avail = iov_peek(c, &ptr);
+        size_t take  = (avail < n) ? avail : n;
+        assert(avail > 0);
+        c->off += take;
+        n -= take;
+    }
+}
+
+/**
+ * @brief Get the byte at offset n from the cursor
+ *
+ * @return The byte value, or -1 if the input ends before it
+ */
+static int iov_byte(const iov_cursor_t *c, size_t n)
+{
+    size_t off = c->off;
+
+    for (size_t i = c->idx; i < c->iovcnt; i++, off = 0) {
+        size_t avail = (c->iov[i].len > off) ? c->iov[i].len - off : 0;
+        if (n < avail) {
+            return ((const unsigned char *)c->iov[i].base)[off + n];
+        }
+        n -= avail;
+    }
+    return -1;
+}
+
+/**
+ * @brief Copy the line at the cursor into the stitch buffer
+ *
+ * Bytes are appended up to and including the next LF; earlier contents of
+ * stitch are kept, so lines stitched before stay valid.
+ *
+ * @param line Output: start of the copied line in stitch
+ * @param len Output: number of bytes copied
+ * @return HWIRE_OK if the line end was copied
+ * @return HWIRE_EAGAIN if the input ends before a LF
+ * @return HWIRE_ENOBUFS if stitch is full before a LF
+ */
+static int iov_stitch(const iov_cursor_t *c, hwire_buf_t *stitch,
+                      const unsigned char **line, size_t *len)
+{
+    size_t start = stitch->len;
+    size_t off   = c->off;
+
+    *line = (const unsigned char *)stitch->buf + start;
+    for (size_t i = c->idx; i < c->iovcnt; i++, off = 0) {
+        const char *seg = (const char *)c->iov[i].base;
+        size_t n        = (c->iov[i].len > off) ? c->iov[i].len - off : 0;
+        const char *lf  = (n > 0) ? memchr(seg + off, LF, n) : NULL;
+        size_t room     = stitch->size - stitch->len;
+        int rv          = HWIRE_EAGAIN;
+
+        if (lf != NULL) {
+            n  = (size_t)(lf - (seg + off)) + 1;
+            rv = HWIRE_OK;
+        }
+        if (n > room) {
+            n  = room;
+            rv = HWIRE_ENOBUFS;
+        }
+        if (n > 0) {
+            memcpy(stitch->buf + stitch->len, seg + off, n);
+            stitch->len += n;
+        }
+        if (rv != HWIRE_EAGAIN) {
+            *len = stitch->len - start;
+            return rv;
+        }
+    }
+    *len = stitch->len - start;
+    return HWIRE_EAGAIN;
+}
+
+/**
+ * @brief Parser for one line of a message head
+ *
+ * Parses the line at str and sets *n to its length including the EOL.
+ */
+typedef int (*iov_line_parser_t)(hwire_ctx_t *ctx, const unsigned char *str,
+                                 size_t len, size_t maxlen, void *out,
+                                 size_t *n);
+
+static int iov_request_line(hwire_ctx_t *ctx, const unsigned char *str,
+                            size_t len, size_t maxlen, void *out, size_t *n)
+{
+    (void)ctx;
+    return parse_request_head(str, len, n, maxlen, (hwire_request_t *)out);
+}
+
+static int iov_status_line(hwire_ctx_t *ctx, const unsigned char *str,
+                           size_t len, size_t maxlen, void *out, size_t *n)
+{
+    (void)ctx;
+    return parse_status_line(str, len, n, maxlen, (hwire_response_t *)out);
+}
+
+static int iov_field_line(hwire_ctx_t *ctx, const unsigned char *str,
+                          size_t len, size_t maxlen, void *out, size_t *n)
+{
+    return parse_field_line(ctx, str, len, maxlen,
+                            (ctx->options & HWIRE_OPT_HARDENED) != 0,
+                            (hwire_header_t *)out, n);
+}
+
+/**
+ * @brief Parse the line at the cursor and consume it
+ *
+ * The line is parsed in place when it ends in the current segment, which is
+ * the common case. Only a line that crosses a segment boundary is copied to
+ * stitch and parsed from there; results then point into stitch.
+ */
+static int iov_parse_line(hwire_ctx_t *ctx, iov_cursor_t *c,
+                          hwire_buf_t *stitch, iov_line_parser_t parse,
+                          size_t maxlen, void *out)
+{
+    const unsigned char *line = NULL;
+    size_t len                = iov_peek(c, &line);
+    size_t n                  = 0;
+    int rv                    = HWIRE_EAGAIN;
+    int srv                   = 0;
+
+    if (len > 0) {
+        rv = parse(ctx, line, len, maxlen, out, &n);
+    }
+    if (rv == HWIRE_EAGAIN && c->idx + 1 < c->iovcnt) {
+        srv = iov_stitch(c, stitch, &line, &len);
+        rv  = parse(ctx, line, len, maxlen, out, &n);
+        if (rv == HWIRE_EAGAIN && srv == HWIRE_ENOBUFS) {
+            return HWIRE_ENOBUFS;
+        }
+    }
+    if (rv == HWIRE_OK) {
+        iov_advance(c, n);
+    }
+    return rv;
+}
+
+/**
+ * @brief Parse header fields at the cursor up to the empty line
+ *
+ * Same checks and callbacks as hwire_parse_headers.
+ */
+static int parse_headers_iov(hwire_ctx_t *ctx, iov_cursor_t *c,
+                             size_t maxlen, uint8_t maxnhdrs,
+                             hwire_buf_t *stitch)
+{
+    hwire_framing_t local;
+    hwire_framing_t *fr     = ctx->framing;
+    hwire_hdr_index_t *idx  = ctx->hdr_index;
+    int hardened            = (ctx->options & HWIRE_OPT_HARDENED) != 0;
+    uint8_t nhdr            = 0;
+    int rv                  = 0;
+    hwire_header_t header;
+
+    if (fr == NULL && hardened) {
+        fr = &local;
+    }
+    if (fr != NULL) {
+        *fr = (hwire_framing_t){0};
+    }
+    if (idx != NULL) {
+        hdr_index_reset(idx);
+    }
+
+    for (;;) {
+        // end of the header section
+        int b = iov_byte(c, 0);
+        if (b < 0) {
+            return HWIRE_EAGAIN;
+        } else if (b == CR) {
+            b = iov_byte(c, 1);
+            if (b < 0) {
+                return HWIRE_EAGAIN;
+            } else if (b == LF) {
+                iov_advance(c, 2);
+                break;
+            }
+        } else if (b == LF) {
+            iov_advance(c, 1);
+            break;
+        }
+
+        if (unlikely(nhdr >= maxnhdrs)) {
+            return HWIRE_ENOBUFS;
+        }
+        nhdr++;
+        rv = iov_parse_line(ctx, c, stitch, iov_field_line, maxlen, &header);
+        if (rv != HWIRE_OK) {
+            return rv;
+        }
+        if (fr != NULL) {
+            rv = framing_field(fr, (const unsigned char *)header.key.ptr,
+                               header.key.len, header.hash,
+                               (const unsigned char *)header.value.ptr,
+                               header.value.len);
+            if (unlikely(rv != HWIRE_OK)) {
+                return rv;
+            }
+        }
+        if (idx != NULL) {
+            rv = hdr_index_add(idx, &header, &ctx->key_lc);
+            if (unlikely(rv != HWIRE_OK)) {
+                return rv;
+            }
+        }
+        if (ctx->header_cb != NULL &&
+            unlikely(ctx->header_cb(ctx, &header) != 0)) {
+            return HWIRE_ECALLBACK;
+        }
+    }
+
+    if (hardened && (fr->flags & HWIRE_FRAMING_CONTENT_LENGTH) &&
+        (fr->flags & HWIRE_FRAMING_TRANSFER_ENCODING)) {
+        // RFC 9112 6.3: a message with both is a likely smuggling attempt
+        return HWIRE_ECLTE;
+    }
+    return HWIRE_OK;
+}
+
+/**
+ * @brief Skip empty lines before a start line
+ *
+ * RFC 9112 2.2: at least one empty line received before a request-line
+ * should be ignored; the contiguous parsers accept any number.
+ */
+static void iov_skip_crlf(iov_cursor_t *c)
+{
+    int b = 0;
+
+    while ((b = iov_byte(c, 0)) == CR || b == LF) {
+        iov_advance(c, 1);
+    }
+}
+
+/**
+ * @brief Parse HTTP headers from a sequence of segments
+ */
+int hwire_parse_headers_iov(hwire_ctx_t *ctx, const hwire_iov_t *iov,
+                            size_t iovcnt, size_t *pos, size_t maxlen,
+                            uint8_t maxnhdrs, hwire_buf_t *stitch)
+{
+    assert(iov != NULL || iovcnt == 0);
+    assert(pos != NULL);
+    assert(ctx != NULL);
+    assert(stitch != NULL);
+    assert(ctx->header_cb != NULL || ctx->hdr_index != NULL ||
+           ctx->framing != NULL);
+    iov_cursor_t c = {.iov = iov, .iovcnt = iovcnt};
+    int rv         = 0;
+
+    stitch->len = 0;
+    rv          = parse_headers_iov(ctx, &c, maxlen, maxnhdrs, stitch);
+    if (rv != HWIRE_OK) {
+        return rv;
+    }
+    *pos = c.pos;
+    return HWIRE_OK;
+}
+
+/**
+ * @brief Parse HTTP request from a sequence of segments
+ */
+int hwire_parse_request_iov(hwire_ctx_t *ctx, const hwire_iov_t *iov,
+                            size_t iovcnt, size_t *pos, size_t maxlen,
+                            uint8_t maxnhdrs, hwire_buf_t *stitch)
+{
+    assert(iov != NULL || iovcnt == 0);
+    assert(pos != NULL);
+    assert(ctx != NULL);
+    assert(ctx->request_cb != NULL);
+    assert(stitch != NULL);
+    assert(ctx->header_cb != NULL || ctx->hdr_index != NULL ||
+           ctx->framing != NULL);
+    iov_cursor_t c = {.iov = iov, .iovcnt = iovcnt};
+    hwire_request_t req;
+    int rv = 0;
+
+    stitch->len = 0;
+    iov_skip_crlf(&c);
+    rv = iov_parse_line(ctx, &c, stitch, iov_request_line, maxlen, &req);
+    if (rv != HWIRE_OK) {
+        return rv;
+    }
+
+    // call request callback
+    if (ctx->request_cb(ctx, &req) != 0) {
+        return HWIRE_ECALLBACK;
+    }
+
+    rv = parse_headers_iov(ctx, &c, maxlen, maxnhdrs, stitch);
+    if (rv != HWIRE_OK) {
+        return rv;
+    }
+    *pos = c.pos;
+    return HWIRE_OK;
+}
+
+/**
+ * @brief Parse HTTP response from a sequence of segments
+ */
+int hwire_parse_response_iov(hwire_ctx_t *ctx, const hwire_iov_t *iov,
+                             size_t iovcnt, size_t *pos, size_t maxlen,
+                             uint8_t maxnhdrs, hwire_buf_t *stitch)
+{
+    assert(iov != NULL || iovcnt == 0);
+    assert(pos != NULL);
+    assert(ctx != NULL);
+    assert(ctx->response_cb != NULL);
+    assert(stitch != NULL);
+    assert(ctx->header_cb != NULL || ctx->hdr_index != NULL ||
+           ctx->framing != NULL);
+    iov_cursor_t c = {.iov = iov, .iovcnt = iovcnt};
+    hwire_response_t rsp;
+    int rv = 0;
+
+    stitch->len = 0;
+    iov_skip_crlf(&c);
+    rv = iov_parse_line(ctx, &c, stitch, iov_status_line, maxlen, &rsp);
+    if (rv != HWIRE_OK) {
+        return rv;
+    }
+
+    // call response callback
+    if (ctx->response_cb(ctx, &rsp) != 0) {
+        return HWIRE_ECALLBACK;
+    }
+
+    rv = parse_headers_iov(ctx, &c, maxlen, maxnhdrs, stitch);
+    if (rv != HWIRE_OK) {
+        return rv;
+    }
+    *pos = c.pos;
+    return HWIRE_OK;
+}
+
+/** @} */ /* end of Scatter/Gather Parsing Functions */
+
+/**
+ * @name HTTP Message Scanning Functions
+ * @{
+ */
+
+#if defined(__AVX2__) || defined(__SSSE3__)
+# if defined(__AVX2__)
+#  define HDR_BLOCK 32
+# else
+#  define HDR_BLOCK 16
+# endif
+
+/**
+ * @brief Classify one block of a header line
+ *
+ * Loads HDR_BLOCK bytes once and sets bit i of *tbad if str[i] is not tchar
+ * and bit i of *fbad if str[i] is not field-content (CTL other than HT, or
+ * DEL), so both the field name and, for short lines, the field value are
+ * resolved from a single load.
+ */
+static inline void header_block_masks(const unsigned char *str,
+                                      uint32_t *tbad, uint32_t *fbad)
+{
+# if defined(__AVX2__)
+    const __m256i lo_lut = _mm256_broadcastsi128_si256(
+        _mm_loadu_si128((const __m128i *)(const void *)TCHAR_NIBBLE_LO));
+    const __m256i hi_lut = _mm256_broadcastsi128_si256(
+        _mm_loadu_si128((const __m128i *)(const void *)TCHAR_NIBBLE_HI));
+    const __m256i nibble = _mm256_set1_epi8(0x0F);
+    __m256i data = _mm256_loadu_si256((const __m256i *)(const void *)str);
+    __m256i lo_v = _mm256_shuffle_epi8(lo_lut, _mm256_and_si256(data, nibble));
+    __m256i hi_v = _mm256_shuffle_epi8(
+        hi_lut, _mm256_and_si256(_mm256_srli_epi16(data, 4), nibble));
+    __m256i ctl  = _mm256_andnot_si256(
+        _mm256_cmpeq_epi8(data, _mm256_set1_epi8(HT)),
+        _mm256_cmpeq_epi8(_mm256_min_epu8(data, _mm256_set1_epi8(0x1F)), data));
+
+    *tbad = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(
+        _mm256_and_si256(lo_v, hi_v), _mm256_setzero_si256()));
+    *fbad = (uint32_t)_mm256_movemask_epi8(_mm256_or_si256(
+        ctl, _mm256_cmpeq_epi8(data, _mm256_set1_epi8(0x7F))));
+# else
+    const __m128i lo_lut =
+        _mm_loadu_si128((const __m128i *)(const void *)TCHAR_NIBBLE_LO);
+    const __m128i hi_lut =
+        _mm_loadu_si128((const __m128i *)(const void *)TCHAR_NIBBLE_HI);
+    const __m128i nibble = _mm_set1_epi8(0x0F);
+    __m128i data = _mm_loadu_si128((const __m128i *)(const void *)str);
+    __m128i lo_v = _mm_shuffle_epi8(lo_lut, _mm_and_si128(data, nibble));
+    __m128i hi_v = _mm_shuffle_epi8(
+        hi_lut, _mm_and_si128(_mm_srli_epi16(data, 4), nibble));
+    __m128i ctl  = _mm_andnot_si128(
+        _mm_cmpeq_epi8(data, _mm_set1_epi8(HT)),
+        _mm_cmpeq_epi8(_mm_min_epu8(data, _mm_set1_epi8(0x1F)), data));
+
+    *tbad = (uint32_t)_mm_movemask_epi8(
+        _mm_cmpeq_epi8(_mm_and_si128(lo_v, hi_v), _mm_setzero_si128()));
+    *fbad = (uint32_t)_mm_movemask_epi8(
+        _mm_or_si128(ctl, _mm_cmpeq_epi8(data, _mm_set1_epi8(0x7F))));
+# endif
+}
+#endif
+
+/**
+ * @brief Scan HTTP headers
+ *
+ * Same validation as hwire_parse_headers without lowercasing, hashing or
+ * callbacks; only the framing-related fields are recorded in fr.
+ *
+ * With AVX2/SSSE3 the first block of every line is classified once by
+ * header_block_masks.  A line that ends inside that block and within maxlen
+ * is taken as a whole; otherwise the field name still comes from the block
+ * when it ends there, and the rest is parsed by parse_hkey/parse_hval, which
+ * also produce the error codes.
+ *
+ * @param str String to parse (must not be NULL)
+ * @param len Length of string
+ * @param pos Output: bytes consumed from str[0] after empty-line CRLF
+ * @param maxlen Maximum individual header length
+ * @param maxnhdrs Maximum number of headers
+ * @param fr Output: framing-related fields
+ * @param hardened Classify invalid field names by hname_error
+ * @return HWIRE_OK on success, empty line consumed
+ * @return Any error of hwire_parse_headers except HWIRE_EKEYLEN and
+ * HWIRE_ECALLBACK, or of framing_field
+ */
+static int scan_headers(const unsigned char *str, size_t len, size_t *pos,
+                        size_t maxlen, uint8_t maxnhdrs, hwire_framing_t *fr,
+                        int hardened)
+{
+    const unsigned char *top  = str;
+    const unsigned char *head = 0;
+    uint8_t nhdr              = 0;
+    size_t cur                = 0;
+    int rv                    = 0;
+    size_t klen               = 0;
+    size_t vlen               = 0;
+
+RETRY:
+    if (unlikely(len == 0)) {
+        return HWIRE_EAGAIN;
+    }
+    if (unlikely(*str <= CR)) {
+        if (likely(*str == CR)) {
+            if (unlikely(len < 2)) {
+                return HWIRE_EAGAIN;
+            } else if (likely(str[1] == LF)) {
+                *pos = (size_t)(str + 2 - top);
+                return HWIRE_OK;
+            }
+        } else if (*str == LF) {
+            *pos = (size_t)(str + 1 - top);
+            return HWIRE_OK;
+        }
+    }
+
+    // check maximum header number constraint
+    if (unlikely(nhdr >= maxnhdrs)) {
+        return HWIRE_ENOBUFS;
+    }
+    nhdr++;
+
+    head = str;
+    klen = 0;
+#if defined(HDR_BLOCK)
+    if (likely(len >= HDR_BLOCK)) {
+        uint32_t tbad, fbad;
+        size_t end;
+
+        header_block_masks(str, &tbad, &fbad);
+        if (likely(tbad)) {
+            end = (size_t)ctz32(tbad);
+            if (likely(end > 0 && end < maxlen && str[end] == COLON)) {
+                klen = end;
+                cur  = end + 1;
+                while (cur < HDR_BLOCK && (str[cur] == SP || str[cur] == HT)) {
+                    cur++;
+                }
+                fbad &= (cur < HDR_BLOCK) ? ~(uint32_t)0 << cur : 0;
+                end = fbad ? (size_t)ctz32(fbad) : SIZE_MAX;
+                if (end < maxlen && (str[end] == LF ||
+                                     (str[end] == CR && end + 1 < HDR_BLOCK &&
+                                      str[end + 1] == LF))) {
+                    // the whole line is in the block
+                    size_t next = end + 1 + (str[end] == CR);
+                    while (end > cur &&
+                           (str[end - 1] == SP || str[end - 1] == HT)) {
+                        end--;
+                    }
+                    rv = framing_field(fr, head, klen, 0, str + cur,
+                                       end - cur);
+                    if (unlikely(rv != HWIRE_OK)) {
+                        return rv;
+                    }
+                    str += next;
+                    len -= next;
+                    goto RETRY;
+                }
+            }
+        }
+    }
+#endif
+    if (klen == 0) {
+        klen = maxlen;
+        rv   = parse_hkey(str, len, &cur, &klen, NULL);
+        if (unlikely(rv != HWIRE_OK)) {
+            if (rv == HWIRE_EHDRNAME && hardened) {
+                return hname_error(str, len);
+            }
+            return rv;
+        }
+    }
+
+    // skip OWS
+    while (cur < len && (str[cur] == SP || str[cur] == HT)) {
+        cur++;
+    }
+
+    // re-check maximum header length constraint
+    if (unlikely(cur > maxlen)) {
+        return HWIRE_EHDRLEN;
+    }
+    str += cur;
+    len -= cur;
+
+    vlen = maxlen - (size_t)(str - head);
+    rv   = parse_hval(str, len, &cur, &vlen);
+    if (unlikely(rv != HWIRE_OK)) {
+        return rv;
+    }
+
+    rv = framing_field(fr, head, klen, 0, str, vlen);
+    if (unlikely(rv != HWIRE_OK)) {
+        return rv;
+    }
+    str += cur;
+    len -= cur;
+
+    goto RETRY;
+}
+
+#if defined(HDR_BLOCK)
+# undef HDR_BLOCK
+#endif
+
+/**
+ * @brief Reset the fields of a message summary that are set conditionally
+ */
+static inline void msginfo_init(hwire_msginfo_t *info)
+{
+    info->status                 = 0;
+    info->method.ptr             = NULL;
+    info->method.len             = 0;
+    info->framing.content_length = 0;
+    info->framing.flags          = 0;
+}
+
+/**
+ * @brief Resolve body framing and persistence
+ *
+ * RFC 9112 6.3: Message Body Length
+ * RFC 9112 9.3: Persistence
+ *
+ * @param info Message summary (version, status and framing set)
+ * @param flags HWIRE_SCAN_* flags
+ * @return HWIRE_OK on success
+ * @return HWIRE_EHDRVALUE if a request's final transfer coding is not
+ * chunked
+ * @return HWIRE_ECLTE for Content-Length with Transfer-Encoding when
+ * HWIRE_SCAN_HARDENED is set
+ */
+static int resolve_framing(hwire_msginfo_t *info, unsigned int flags)
+{
+    uint16_t fr = info->framing.flags;
+
+    if ((flags & HWIRE_SCAN_HARDENED) && (fr & HWIRE_FRAMING_CONTENT_LENGTH) &&
+        (fr & HWIRE_FRAMING_TRANSFER_ENCODING)) {
+        return HWIRE_ECLTE;
+    }
+
+    // a "close" option always wins; HTTP/1.0 needs an explicit keep-alive.
+    // RFC 9112 6.1: Transfer-Encoding in HTTP/1.0 is faulty framing and the
+    // connection closes after the message
+    if ((fr & HWIRE_FRAMING_CLOSE) ||
+        (info->version == HWIRE_HTTP_V10 &&
+         (fr & HWIRE_FRAMING_TRANSFER_ENCODING))) {
+        info->keep_alive = 0;
+    } else if (info->version == HWIRE_HTTP_V11) {
+        info->keep_alive = 1;
+    } else {
+        info->keep_alive = (fr & HWIRE_FRAMING_KEEP_ALIVE) != 0;
+    }
+
+    if (flags & HWIRE_SCAN_RESPONSE) {
+        uint16_t status = info->status;
+        if ((flags & HWIRE_SCAN_HEAD) || status < 200 || status == 204 ||
+            status == 304) {
+            info->body = HWIRE_BODY_NONE;
+            return HWIRE_OK;
+        } else if ((flags & HWIRE_SCAN_CONNECT) && status < 300) {
+            // the connection becomes a tunnel
+            info->body       = HWIRE_BODY_NONE;
+            info->keep_alive = 0;
+            return HWIRE_OK;
+        } else if (fr & HWIRE_FRAMING_TRANSFER_ENCODING) {
+            info->body = (fr & HWIRE_FRAMING_CHUNKED) ? HWIRE_BODY_CHUNKED :
+                                                        HWIRE_BODY_CLOSE;
+        } else if (fr & HWIRE_FRAMING_CONTENT_LENGTH) {
+            info->body = HWIRE_BODY_LENGTH;
+        } else {
+            info->body = HWIRE_BODY_CLOSE;
+        }
+    } else if (fr & HWIRE_FRAMING_TRANSFER_ENCODING) {
+        if (!(fr & HWIRE_FRAMING_CHUNKED)) {
+            return HWIRE_EHDRVALUE;
+        }
+        info->body = HWIRE_BODY_CHUNKED;
+        if (fr & HWIRE_FRAMING_CONTENT_LENGTH) {
+            // the length is ambiguous to other recipients
+            info->keep_alive = 0;
+        }
+    } else if (fr & HWIRE_FRAMING_CONTENT_LENGTH) {
+        info->body = HWIRE_BODY_LENGTH;
+    } else {
+        info->body = HWIRE_BODY_NONE;
+    }
+
+    if (info->body == HWIRE_BODY_CLOSE) {
+        info->keep_alive = 0;
+    }
+    return HWIRE_OK;
+}
+
+/**
+ * @brief Scan an HTTP message head without callbacks
+ */
+int hwire_scan_message(const char *str, size_t len, size_t *pos,
+                       size_t maxlen, uint8_t maxnhdrs, unsigned int flags,
+                       hwire_msginfo_t *info)
+{
+    assert(str != NULL);
+    assert(pos != NULL);
+    assert(info != NULL);
+    const unsigned char *ustr = (const unsigned char *)str;
+    size_t cur                = 0;
+    size_t hlen               = 0;
+    int rv                    = 0;
+
+    msginfo_init(info);
+    if (flags & HWIRE_SCAN_RESPONSE) {
+        hwire_response_t rsp;
+        rv = parse_status_line(ustr, len, &cur, maxlen, &rsp);
+        if (rv != HWIRE_OK) {
+            return rv;
+        }
+        info->version = rsp.version;
+        info->status  = rsp.status;
+    } else {
+        hwire_request_t req;
+        rv = parse_request_head(ustr, len, &cur, maxlen, &req);
+        if (rv != HWIRE_OK) {
+            return rv;
+        }
+        info->version = req.version;
+        info->method  = req.method;
+    }
+
+    rv = scan_headers(ustr + cur, len - cur, &hlen, maxlen, maxnhdrs,
+                      &info->framing, (flags & HWIRE_SCAN_HARDENED) != 0);
+    if (rv != HWIRE_OK) {
+        return rv;
+    }
+
+    rv = resolve_framing(info, flags);
+    if (rv != HWIRE_OK) {
+        return rv;
+    }
+
+    *pos = cur + hlen;
+    return HWIRE_OK;
+}
+
+/** @} */ /* end of HTTP Message Scanning Functions */
+
+/**
+ * @name HTTP Message Functions
+ * @{
+ */
+
+/**
+ * @brief Initialize a message parser
+ */
+void hwire_msg_init(hwire_msg_parser_t *msg, unsigned int flags,
+                    size_t maxlen, uint8_t maxnhdrs, uint8_t maxexts)
+{
+    assert(msg != NULL);
+    msginfo_init(&msg->info);
+    msg->info.version    = HWIRE_HTTP_V11;
+    msg->info.body       = HWIRE_BODY_NONE;
+    msg->info.keep_alive = 0;
+    msg->remaining       = 0;
+    msg->maxlen          = maxlen;
+    msg->maxnhdrs        = maxnhdrs;
+    msg->maxexts         = maxexts;
+    msg->ntrailers       = 0;
+    msg->flags           = (uint8_t)flags;
+    msg->state           = HWIRE_MSG_HEAD;
+}
+
+/**
+ * @brief Parse the message head and select the body state
+ *
+ * @param msg Message parser
+ * @param ctx Parser context
+ * @param str String to parse
+ * @param len Length of string
+ * @param pos Output: bytes consumed from str[0]
+ * @return HWIRE_OK on success
+ * @return Any error of hwire_parse_request / hwire_parse_response or of
+ * resolve_framing
+ */
+static int parse_msg_head(hwire_msg_parser_t *msg, hwire_ctx_t *ctx,
+                          const unsigned char *str, size_t len, size_t *pos)
+{
+    hwire_msginfo_t *info = &msg->info;
+    size_t cur            = 0;
+    size_t hlen           = 0;
+    int rv                = 0;
+
+    msginfo_init(info);
+    if (ctx->options & HWIRE_OPT_HARDENED) {
+        msg->flags |= HWIRE_SCAN_HARDENED;
+    }
+    if (msg->flags & HWIRE_SCAN_RESPONSE) {
+        hwire_response_t rsp;
+        rv = parse_status_line(str, len, &cur, msg->maxlen, &rsp);
+        if (rv != HWIRE_OK) {
+            return rv;
+        }
+        info->version = rsp.version;
+        info->status  = rsp.status;
+        if (ctx->response_cb(ctx, &rsp) != 0) {
+            return HWIRE_ECALLBACK;
+        }
+    } else {
+        hwire_request_t req;
+        rv = parse_request_head(str, len, &cur, msg->maxlen, &req);
+        if (rv != HWIRE_OK) {
+            return rv;
+        }
+        info->version = req.version;
+        info->method  = req.method;
+        if (ctx->request_cb(ctx, &req) != 0) {
+            return HWIRE_ECALLBACK;
+        }
+    }
+
+    rv = parse_headers(ctx, (const char *)str + cur, len - cur, &hlen,
+                       msg->maxlen, msg->maxnhdrs, ctx->hdr_index,
+                       &info->framing, msg->flags & HWIRE_SCAN_HARDENED);
+    if (rv != HWIRE_OK) {
+        return rv;
+    }
+    rv = resolve_framing(info, msg->flags);
+    if (rv != HWIRE_OK) {
+        return rv;
+    }
+
+    switch (info->body) {
+    case HWIRE_BODY_LENGTH:
+        msg->remaining = info->framing.content_length;
+        msg->state     = (msg->remaining > 0) ? HWIRE_MSG_BODY : HWIRE_MSG_DONE;
+        break;
+    case HWIRE_BODY_CHUNKED:
+        msg->state = HWIRE_MSG_CHUNK_SIZE;
+        break;
+    case HWIRE_BODY_CLOSE:
+        msg->state = HWIRE_MSG_CLOSE_BODY;
+        break;
+    default:
+        msg->state = HWIRE_MSG_DONE;
+    }
+
+    *pos = cur + hlen;
+    return HWIRE_OK;
+}
+
+/**
+ * @brief Parse the next fragment of an HTTP message
+ */
+int hwire_msg_parse(hwire_msg_parser_t *msg, hwire_ctx_t *ctx,
+                    const char *str, size_t len, size_t *pos)
+{
+    assert(msg != NULL);
+    assert(ctx != NULL);
+    assert(str != NULL);
+    assert(pos != NULL);
+    assert((msg->flags & HWIRE_SCAN_RESPONSE) ? ctx->response_cb != NULL :
+                                                ctx->request_cb != NULL);
+    assert(ctx->header_cb != NULL || ctx->hdr_index != NULL);
+    const unsigned char *ustr = (const unsigned char *)str;
+    size_t cur                = 0;
+    size_t n                  = 0;
+    uint32_t size             = 0;
+    int rv                    = 0;
+
+    for (;;) {
+        switch (msg->state) {
+        case HWIRE_MSG_HEAD:
+            rv = parse_msg_head(msg, ctx, ustr, len, &n);
+            if (rv != HWIRE_OK) {
+                *pos = 0;
+                return rv;
+            }
+            cur = n;
+            break;
+
+        case HWIRE_MSG_BODY:
+        case HWIRE_MSG_CHUNK_DATA:
+            // hand out as much of the body or chunk as is available
+            n = len - cur;
+            if ((uint64_t)n > msg->remaining) {
+                n = (size_t)msg->remaining;
+            }
+            if (n > 0 && ctx->body_cb != NULL &&
+                ctx->body_cb(ctx, str + cur, n) != 0) {
+                return HWIRE_ECALLBACK;
+            }
+            cur += n;
+            msg->remaining -= n;
+            if (msg->remaining > 0) {
+                *pos = cur;
+                return HWIRE_EAGAIN;
+            }
+            msg->state = (msg->state == HWIRE_MSG_BODY) ? HWIRE_MSG_DONE :
+                                                          HWIRE_MSG_CHUNK_EOL;
+            break;
+
+        case HWIRE_MSG_CHUNK_SIZE:
+            // chunk = chunk-size [ chunk-ext ] CRLF chunk-data CRLF
+            // last-chunk = 1*("0") [ chunk-ext ] CRLF
+            // RFC 9112 7.1: Chunked Transfer Coding
+            n  = 0;
+            rv = parse_chunksize(ctx, str + cur, len - cur, &n, msg->maxlen,
+                                 msg->maxexts, &size);
+            if (rv != HWIRE_OK) {
+                *pos = cur;
+                return rv;
+            }
+            cur += n;
+            msg->remaining = size;
+            msg->state = (size > 0) ? HWIRE_MSG_CHUNK_DATA : HWIRE_MSG_TRAILER;
+            break;
+
+        case HWIRE_MSG_CHUNK_EOL:
+            if (cur >= len) {
+                *pos = cur;
+                return HWIRE_EAGAIN;
+            } else if (ustr[cur] == CR) {
+                if (cur + 1 >= len) {
+                    *pos = cur;
+                    return HWIRE_EAGAIN;
+                } else if (ustr[cur + 1] != LF) {
+                    return HWIRE_EEOL;
+                }
+                cur++;
+            } else if (ustr[cur] != LF) {
+                return HWIRE_EEOL;
+            }
+            cur++;
+            msg->state = HWIRE_MSG_CHUNK_SIZE;
+            break;
+
+        case HWIRE_MSG_TRAILER:
+            // trailer-section = *( field-line CRLF )
+            // RFC 9112 7.1.2: Chunked Trailer Section
+            n  = 0;
+            rv = parse_trailers(ctx, str + cur, len - cur, &n, msg->maxlen,
+                                msg->maxnhdrs, &msg->ntrailers,
+                                msg->flags & HWIRE_SCAN_HARDENED);
+            // complete field lines are consumed even when more is needed
+            cur += n;
+            if (rv != HWIRE_OK) {
+                *pos = cur;
+                return rv;
+            }
+            msg->state = HWIRE_MSG_DONE;
+            break;
+
+        case HWIRE_MSG_CLOSE_BODY:
+            // everything up to the end of the connection is body
+            n = len - cur;
+            if (n > 0 && ctx->body_cb != NULL &&
+                ctx->body_cb(ctx, str + cur, n) != 0) {
+                return HWIRE_ECALLBACK;
+            }
+            *pos = len;
+            return HWIRE_EAGAIN;
+
+        default:
+            *pos = cur;
+            return HWIRE_OK;
+        }
+    }
+}
+
+/**
+ * @brief Signal the end of input to a message parser
+ */
+int hwire_msg_eof(hwire_msg_parser_t *msg)
+{
+    assert(msg != NULL);
+    if (msg->state == HWIRE_MSG_CLOSE_BODY) {
+        msg->state = HWIRE_MSG_DONE;
+    }
+    return (msg->state == HWIRE_MSG_DONE) ? HWIRE_OK : HWIRE_EAGAIN;
+}
+
+/** @} */ /* end of HTTP Message Functions */
+
+/**
+ * @name Serialization Functions
+ * @{
+ */
+
+// separators; the last two CRLFs are adjacent so that the CRLF of the last
+// field line and the empty line merge into one segment
+static const char SER_SEP[] = ": \r\n\r\n";
+#define SER_COLON  (SER_SEP)
+#define SER_CRLF   (SER_SEP + 2)
+#define SER_EMPTY  (SER_SEP + 4)
+
+static const char SER_V10[] = " HTTP/1.0\r\n";
+static const char SER_V11[] = " HTTP/1.1\r\n";
+
+// "NNN " for every status code from 100 to 599
+#define DIGITS_1(h, t)                                                         \
+    h t "0 " h t "1 " h t "2 " h t "3 " h t "4 " h t "5 " h t "6 " h t "7 "    \
+    h t "8 " h t "9 "
+#define DIGITS_2(h)                                                            \
+    DIGITS_1(h, "0") DIGITS_1(h, "1") DIGITS_1(h, "2") DIGITS_1(h, "3")        \
+    DIGITS_1(h, "4") DIGITS_1(h, "5") DIGITS_1(h, "6") DIGITS_1(h, "7")        \
+    DIGITS_1(h, "8") DIGITS_1(h, "9")
+static const char STATUS_DIGITS[] =
+    DIGITS_2("1") DIGITS_2("2") DIGITS_2("3") DIGITS_2("4") DIGITS_2("5");
+#undef DIGITS_2
+#undef DIGITS_1
+
+/**
+ * @brief Preformatted status lines
+ *
+ * "HTTP/1.1 <status> <reason>\r\n" for the status codes registered in
+ * RFC 9110 15 and a few common extensions, sorted by status.
+ */
+typedef struct {
+    const char *line; /**< Complete status line including CRLF */
+    uint8_t len;      /**< Length of line */
+    uint16_t status;  /**< Status code */
+} ser_status_t;
+
+#define SER_STATUS(status, reason)                                             \
+    {"HTTP/1.1 " #status " " reason "\r\n",                                    \
+     (uint8_t)(sizeof("HTTP/1.1 " #status " " reason "\r\n") - 1), status}
+
+static const ser_status_t SER_STATUS_LINES[] = {
+    SER_STATUS(100, "Continue"),
+    SER_STATUS(101, "Switching Protocols"),
+    SER_STATUS(103, "Early Hints"),
+    SER_STATUS(200, "OK"),
+    SER_STATUS(201, "Created"),
+    SER_STATUS(202, "Accepted"),
+    SER_STATUS(203, "Non-Authoritative Information"),
+    SER_STATUS(204, "No Content"),
+    SER_STATUS(205, "Reset Content"),
+    SER_STATUS(206, "Partial Content"),
+    SER_STATUS(300, "Multiple Choices"),
+    SER_STATUS(301, "Moved Permanently"),
+    SER_STATUS(302, "Found"),
+    SER_STATUS(303, "See Other"),
+    SER_STATUS(304, "Not Modified"),
+    SER_STATUS(305, "Use Proxy"),
+    SER_STATUS(307, "Temporary Redirect"),
+    SER_STATUS(308, "Permanent Redirect"),
+    SER_STATUS(400, "Bad Request"),
+    SER_STATUS(401, "Unauthorized"),
+    SER_STATUS(402, "Payment Required"),
+    SER_STATUS(403, "Forbidden"),
+    SER_STATUS(404, "Not Found"),
+    SER_STATUS(405, "Method Not Allowed"),
+    SER_STATUS(406, "Not Acceptable"),
+    SER_STATUS(407, "Proxy Authentication Required"),
+    SER_STATUS(408, "Request Timeout"),
+    SER_STATUS(409, "Conflict"),
+    SER_STATUS(410, "Gone"),
+    SER_STATUS(411, "Length Required"),
+    SER_STATUS(412, "Precondition Failed"),
+    SER_STATUS(413, "Content Too Large"),
+    SER_STATUS(414, "URI Too Long"),
+    SER_STATUS(415, "Unsupported Media Type"),
+    SER_STATUS(416, "Range Not Satisfiable"),
+    SER_STATUS(417, "Expectation Failed"),
+    SER_STATUS(421, "Misdirected Request"),
+    SER_STATUS(422, "Unprocessable Content"),
+    SER_STATUS(426, "Upgrade Required"),
+    SER_STATUS(428, "Precondition Required"),
+    SER_STATUS(429, "Too Many Requests"),
+    SER_STATUS(431, "Request Header Fields Too Large"),
+    SER_STATUS(500, "Internal Server Error"),
+    SER_STATUS(501, "Not Implemented"),
+    SER_STATUS(502, "Bad Gateway"),
+    SER_STATUS(503, "Service Unavailable"),
+    SER_STATUS(504, "Gateway Timeout"),
+    SER_STATUS(505, "HTTP Version Not Supported"),
+};
+
+#undef SER_STATUS
+
+// offset of "<status> " in a preformatted status line: "HTTP/1.1 "
+#define SER_STATUS_DIGITS 9
+
+static const ser_status_t *ser_status_find(uint16_t status)
+{
+    size_t lo = 0;
+    size_t hi = sizeof(SER_STATUS_LINES) / sizeof(SER_STATUS_LINES[0]);
+
+    while (lo < hi) {
+        size_t mid = (lo + hi) / 2;
+        if (SER_STATUS_LINES[mid].status < status) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    if (lo < sizeof(SER_STATUS_LINES) / sizeof(SER_STATUS_LINES[0]) &&
+        SER_STATUS_LINES[lo].status == status) {
+        return &SER_STATUS_LINES[lo];
+    }
+    return NULL;
+}
+
+/**
+ * @brief Append a segment, merging it with the last one when adjacent
+ *
+ * @return HWIRE_OK on success
+ * @return HWIRE_ENOBUFS if out has no room for another segment
+ */
+static int ser_push(hwire_iov_array_t *out, const char *base, size_t len)
+{
+    hwire_iov_t *last = NULL;
+
+    if (len == 0) {
+        return HWIRE_OK;
+    } else if (out->count > 0) {
+        last = &out->items[out->count - 1];
+        if ((const char *)last->base + last->len == base) {
+            last->len += len;
+            out->len += len;
+            return HWIRE_OK;
+        }
+    }
+    if (out->count >= out->size) {
+        return HWIRE_ENOBUFS;
+    }
+    out->items[out->count++] = (hwire_iov_t){.base = base, .len = len};
+    out->len += len;
+    return HWIRE_OK;
+}
+
+/**
+ * @brief State of a segment array, to undo a partial append
+ */
+typedef struct {
+    size_t count;
+    size_t len;
+    size_t lastlen;
+} ser_mark_t;
+
+static ser_mark_t ser_mark(const hwire_iov_array_t *out)
+{
+    ser_mark_t m = {out->count, out->len, 0};
+    if (out->count > 0) {
+        m.lastlen = out->items[out->count - 1].len;
+    }
+    return m;
+}
+
+static int ser_undo(hwire_iov_array_t *out, ser_mark_t m)
+{
+    out->count = m.count;
+    out->len   = m.len;
+    if (m.count > 0) {
+        out->items[m.count - 1].len = m.lastlen;
+    }
+    return HWIRE_ENOBUFS;
+}
+
+/**
+ * @brief Append one field line without undoing on failure
+ */
+static int ser_header(hwire_iov_array_t *out, const hwire_str_t *name,
+                      const hwire_str_t *value)
+{
+    // a line re-emitted from the parsed input is still "name: value"
+    if (value->ptr == name->ptr + name->len + 2 &&
+        name->ptr[name->len] == ':' && name->ptr[name->len + 1] == ' ') {
+        if (ser_push(out, name->ptr, name->len + 2 + value->len) !=
+            HWIRE_OK) {
+            return HWIRE_ENOBUFS;
+        }
+    } else if (ser_push(out, name->ptr, name->len) != HWIRE_OK ||
+               ser_push(out, SER_COLON, 2) != HWIRE_OK ||
+               ser_push(out, value->ptr, value->len) != HWIRE_OK) {
+        return HWIRE_ENOBUFS;
+    }
+    return ser_push(out, SER_CRLF, 2);
+}
+
+/**
+ * @brief Append a request line
+ */
+int hwire_serialize_request_line(hwire_iov_array_t *out,
+                                 const hwire_str_t *method,
+                                 const hwire_str_t *target,
+                                 hwire_http_version_t version)
+{
+    assert(out != NULL);
+    assert(method != NULL);
+    assert(target != NULL);
+    const char *ver = NULL;
+    ser_mark_t m    = ser_mark(out);
+
+    switch (version) {
+    case HWIRE_HTTP_V10:
+        ver = SER_V10;
+        break;
+    case HWIRE_HTTP_V11:
+        ver = SER_V11;
+        break;
+    default:
+        return HWIRE_EVERSION;
+    }
+
+    if (ser_push(out, method->ptr, method->len) != HWIRE_OK ||
+        ser_push(out, ver, 1) != HWIRE_OK ||
+        ser_push(out, target->ptr, target->len) != HWIRE_OK ||
+        ser_push(out, ver, sizeof(SER_V11) - 1) != HWIRE_OK) {
+        return ser_undo(out, m);
+    }
+    return HWIRE_OK;
+}
+
+/**
+ * @brief Append a status line
+ */
+int hwire_serialize_status_line(hwire_iov_array_t *out,
+                                hwire_http_version_t version, uint16_t status,
+                                const hwire_str_t *reason)
+{
+    assert(out != NULL);
+    const ser_status_t *sl = NULL;
+    const char *ver        = NULL;
+    ser_mark_t m           = ser_mark(out);
+
+    switch (version) {
+    case HWIRE_HTTP_V10:
+        ver = "HTTP/1.0 ";
+        break;
+    case HWIRE_HTTP_V11:
+        ver = "HTTP/1.1 ";
+        break;
+    default:
+        return HWIRE_EVERSION;
+    }
+    if (status < 100 || status > 599) {
+        return HWIRE_ESTATUS;
+    }
+
+    sl = ser_status_find(status);
+    if (reason == NULL && sl != NULL) {
+        if (version == HWIRE_HTTP_V11) {
+            // fast path: the whole line in one segment
+            return ser_push(out, sl->line, sl->len);
+        } else if (ser_push(out, ver, 9) != HWIRE_OK ||
+                   ser_push(out, sl->line + SER_STATUS_DIGITS,
+                            (size_t)sl->len - SER_STATUS_DIGITS) !=
+                       HWIRE_OK) {
+            return ser_undo(out, m);
+        }
+        return HWIRE_OK;
+    }
+
+    if (ser_push(out, ver, 9) != HWIRE_OK ||
+        ser_push(out, STATUS_DIGITS + (size_t)(status - 100) * 4, 4) !=
+            HWIRE_OK ||
+        (reason != NULL &&
+         ser_push(out, reason->ptr, reason->len) != HWIRE_OK) ||
+        ser_push(out, SER_CRLF, 2) != HWIRE_OK) {
+        return ser_undo(out, m);
+    }
+    return HWIRE_OK;
+}
+
+/**
+ * @brief Append a field line
+ */
+int hwire_serialize_header(hwire_iov_array_t *out, const hwire_str_t *name,
+                           const hwire_str_t *value)
+{
+    assert(out != NULL);
+    assert(name != NULL);
+    assert(value != NULL);
+    ser_mark_t m = ser_mark(out);
+
+    if (ser_header(out, name, value) != HWIRE_OK) {
+        return ser_undo(out, m);
+    }
+    return HWIRE_OK;
+}
+
+/**
+ * @brief Append a list of field lines
+ */
+int hwire_serialize_headers(hwire_iov_array_t *out,
+                            const hwire_header_t *headers, size_t n)
+{
+    assert(out != NULL);
+    assert(headers != NULL || n == 0);
+    ser_mark_t m = ser_mark(out);
+
+    for (size_t i = 0; i < n; i++) {
+        if (ser_header(out, &headers[i].key, &headers[i].value) != HWIRE_OK) {
+            return ser_undo(out, m);
+        }
+    }
+    return HWIRE_OK;
+}
+
+/**
+ * @brief Append the empty line that ends the head
+ */
+int hwire_serialize_end(hwire_iov_array_t *out)
+{
+    assert(out != NULL);
+    return ser_push(out, SER_EMPTY, 2);
+}
+
+#undef SER_STATUS_DIGITS
+#undef SER_EMPTY
+#undef SER_CRLF
+#undef SER_COLON
+
+/** @} */ /* end of Serialization Functions */
+
+/**
+ * @name HTTP-Date Functions
+ * @{
+ */
+
+// 4 bytes as a little-endian word, for comparing names in one step
+#define DATE_WORD(a, b, c, d)                                                  \
+    ((uint32_t)(unsigned char)(a) | (uint32_t)(unsigned char)(b) << 8 |        \
+     (uint32_t)(unsigned char)(c) << 16 | (uint32_t)(unsigned char)(d) << 24)
+
+static inline uint32_t date_word(const unsigned char *s)
+{
+    return DATE_WORD(s[0], s[1], s[2], s[3]);
+}
+
+static const char DATE_WDAYS[]  = "SunMonTueWedThuFriSat";
+static const char DATE_MONTHS[] = "JanFebMarAprMayJunJulAugSepOctNovDec";
+
+// rest of the day names of the rfc850-date form, after the first 3 bytes
+static const char *const DATE_WDAYS_TAIL[] = {"day",    "day",   "sday",
+                                              "nesday", "rsday", "day",
+                                              "urday"};
+
+/**
+ * @brief Days since 1970-01-01 of a proleptic Gregorian date (mon is 1-12)
+ *
+ * H. Hinnant's days_from_civil algorithm.
+ */
+static int64_t days_from_civil(int64_t year, unsigned int mon,
+                               unsigned int mday)
+{
+    year -= mon <= 2;
+    int64_t era     = (year >= 0 ? year : year - 399) / 400;
+    unsigned int y  = (unsigned int)(year - era * 400);
+    unsigned int dy = (153 * (mon > 2 ? mon - 3 : mon + 9) + 2) / 5 + mday - 1;
+    unsigned int de = y * 365 + y / 4 - y / 100 + dy;
+    return era * 146097 + (int64_t)de - 719468;
+}
+
+/**
+ * @brief Proleptic Gregorian date of a day count since 1970-01-01
+ *
+ * H. Hinnant's civil_from_days algorithm.
+ */
+static void civil_from_days(int64_t days, int64_t *year, unsigned int *mon,
+                            unsigned int *mday)
+{
+    days += 719468;
+    int64_t era     = (days >= 0 ? days : days - 146096) / 146097;
+    unsigned int de = (unsigned int)(days - era * 146097);
+    unsigned int y  = (de - de / 1460 + de / 36524 - de / 146096) / 365;
+    unsigned int dy = de - (365 * y + y / 4 - y / 100);
+    unsigned int mp = (5 * dy + 2) / 153;
+
+    *mday = dy - (153 * mp + 2) / 5 + 1;
+    *mon  = mp < 10 ? mp + 3 : mp - 9;
+    *year = (int64_t)y + era * 400 + (*mon <= 2);
+}
+
+static inline void date_put2(char *buf, unsigned int v)
+{
+    buf[0] = (char)('0' + v / 10);
+    buf[1] = (char)('0' + v % 10);
+}
+
+int hwire_format_date(int64_t t, char *buf)
+{
+    assert(buf != NULL);
+    // 0001-01-01T00:00:00Z .. 9999-12-31T23:59:59Z
+    if (t < INT64_C(-62135596800) || t > INT64_C(253402300799)) {
+        return HWIRE_ERANGE;
+    }
+
+    int64_t days      = (t >= 0 ? t : t - 86399) / 86400;
+    unsigned int secs = (unsigned int)(t - days * 86400);
+    // 1970-01-01 was a Thursday
+    unsigned int wday = (unsigned int)(days % 7 + 11) % 7;
+    unsigned int mon  = 0;
+    unsigned int mday = 0;
+    int64_t year      = 0;
+
+    civil_from_days(days, &year, &mon, &mday);
+
+    // "Sun, 06 Nov 1994 08:49:37 GMT"
+    memcpy(buf, DATE_WDAYS + wday * 3, 3);
+    buf[3] = ',';
+    buf[4] = SP;
+    date_put2(buf + 5, mday);
+    buf[7] = SP;
+    memcpy(buf + 8, DATE_MONTHS + (mon - 1) * 3, 3);
+    buf[11] = SP;
+    date_put2(buf + 12, (unsigned int)(year / 100));
+    date_put2(buf + 14, (unsigned int)(year % 100));
+    buf[16] = SP;
+    date_put2(buf + 17, secs / 3600);
+    buf[19] = COLON;
+    date_put2(buf + 20, secs / 60 % 60);
+    buf[22] = COLON;
+    date_put2(buf + 23, secs % 60);
+    memcpy(buf + 25, " GMT", 4);
+    return HWIRE_OK;
+}
+
+#if defined(__GNUC__) || defined(__clang__)
+/**
+ * @brief Date of the current second, shared by all threads
+ *
+ * A sequence lock: seq is odd while a writer updates the fields. Every
+ * field is accessed atomically, so a reader that races with a writer sees
+ * seq change and formats the date itself instead of waiting.
+ */
+static struct {
+    uint32_t seq;
+    int64_t sec;
+    uint64_t date[4]; // HWIRE_DATE_LEN bytes, zero padded
+} DATE_CACHE = {0, INT64_MIN, {0}};
+#endif
+
+void hwire_date_now(char *buf)
+{
+    assert(buf != NULL);
+    int64_t now = (int64_t)time(NULL);
+
+#if defined(__GNUC__) || defined(__clang__)
+    uint64_t date[4];
+    uint32_t seq = __atomic_load_n(&DATE_CACHE.seq, __ATOMIC_ACQUIRE);
+
+    if ((seq & 1) == 0 &&
+        __atomic_load_n(&DATE_CACHE.sec, __ATOMIC_RELAXED) == now) {
+        for (size_t i = 0; i < 4; i++) {
+            date[i] = __atomic_load_n(&DATE_CACHE.date[i], __ATOMIC_RELAXED);
+        }
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        if (__atomic_load_n(&DATE_CACHE.seq, __ATOMIC_RELAXED) == seq) {
+            memcpy(buf, date, HWIRE_DATE_LEN);
+            return;
+        }
+    }
+
+    // a new second or a concurrent update: format, then publish unless
+    // another writer holds the lock
+    memset(date, 0, sizeof(date));
+    hwire_format_date(now, (char *)date);
+    memcpy(buf, date, HWIRE_DATE_LEN);
+    if ((seq & 1) == 0 &&
+        __atomic_compare_exchange_n(&DATE_CACHE.seq, &seq, seq + 1, 0,
+                                    __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+        __atomic_thread_fence(__ATOMIC_RELEASE);
+        __atomic_store_n(&DATE_CACHE.sec, now, __ATOMIC_RELAXED);
+        for (size_t i = 0; i < 4; i++) {
+            __atomic_store_n(&DATE_CACHE.date[i], date[i], __ATOMIC_RELAXED);
+        }
+        __atomic_store_n(&DATE_CACHE.seq, seq + 2, __ATOMIC_RELEASE);
+    }
+#else
+    // without atomics there is nothing to share safely
+    hwire_format_date(now, buf);
+#endif
+}
+
+/**
+ * @brief Parse 2 digits
+ *
+ * @return The value, or UINT_MAX if s does not start with 2 digits
+ */
+static inline unsigned int date_2digit(const unsigned char *s)
+{
+    unsigned int hi = (unsigned int)s[0] - '0';
+    unsigned int lo = (unsigned int)s[1] - '0';
+    return (hi < 10 && lo < 10) ? hi * 10 + lo : UINT_MAX;
+}
+
+/**
+ * @brief Parse 4 digits
+ *
+ * @return The value, or UINT_MAX if s does not start with 4 digits
+ */
+static inline unsigned int date_4digit(const unsigned char *s)
+{
+    unsigned int hi = date_2digit(s);
+    unsigned int lo = date_2digit(s + 2);
+    return (hi != UINT_MAX && lo != UINT_MAX) ? hi * 100 + lo : UINT_MAX;
+}
+
+/**
+ * @brief Look up a 3-letter day name
+ *
+ * @return The day of the week (0 is Sunday), or -1
+ */
+static int date_wday(const unsigned char *s)
+{
+    switch (DATE_WORD(s[0], s[1], s[2], 0)) {
+    case DATE_WORD('S', 'u', 'n', 0):
+        return 0;
+    case DATE_WORD('M', 'o', 'n', 0):
+        return 1;
+    case DATE_WORD('T', 'u', 'e', 0):
+        return 2;
+    case DATE_WORD('W', 'e', 'd', 0):
+        return 3;
+    case DATE_WORD('T', 'h', 'u', 0):
+        return 4;
+    case DATE_WORD('F', 'r', 'i', 0):
+        return 5;
+    case DATE_WORD('S', 'a', 't', 0):
+        return 6;
+    }
+    return -1;
+}
+
+/**
+ * @brief Look up a 3-letter month name followed by sep
+ *
+ * @return The month (1-12), or 0
+ */
+static unsigned int date_month(const unsigned char *s, unsigned char sep)
+{
+    uint32_t w = date_word(s);
+
+#define DATE_MONTH(a, b, c, m)                                                 \
+    if (w == DATE_WORD(a, b, c, sep)) {                                        \
+        return m;                                                              \
+    }
+    DATE_MONTH('J', 'a', 'n', 1)
+    DATE_MONTH('F', 'e', 'b', 2)
+    DATE_MONTH('M', 'a', 'r', 3)
+    DATE_MONTH('A', 'p', 'r', 4)
+    DATE_MONTH('M', 'a', 'y', 5)
+    DATE_MONTH('J', 'u', 'n', 6)
+    DATE_MONTH('J', 'u', 'l', 7)
+    DATE_MONTH('A', 'u', 'g', 8)
+    DATE_MONTH('S', 'e', 'p', 9)
+    DATE_MONTH('O', 'c', 't', 10)
+    DATE_MONTH('N', 'o', 'v', 11)
+    DATE_MONTH('D', 'e', 'c', 12)
+#undef DATE_MONTH
+    return 0;
+}
+
+/**
+ * @brief Parse time-of-day = hour ":" minute ":" second
+ *
+ * @return Seconds since midnight, or -1
+ */
+static int64_t date_time(const unsigned char *s)
+{
+    unsigned int h = date_2digit(s);
+    unsigned int m = date_2digit(s + 3);
+    unsigned int c = date_2digit(s + 6);
+
+    // second may be 60 for a leap second (RFC 5322 3.3)
+    if (s[2] != COLON || s[5] != COLON || h > 23 || m > 59 || c > 60) {
+        return -1;
+    }
+    return (int64_t)(h * 3600 + m * 60 + c);
+}
+
+/**
+ * @brief Check the date fields and convert them to seconds since the epoch
+ */
+static int date_make(unsigned int year, unsigned int mon, unsigned int mday,
+                     int64_t secs, int64_t *t)
+{
+    static const uint8_t MDAYS[] = {31, 29, 31, 30, 31, 30,
+                                    31, 31, 30, 31, 30, 31};
+
+    // years 1 to 9999, as for hwire_format_date
+    if (year == 0 || year > 9999 || mon == 0 || mday == 0 ||
+        mday > MDAYS[mon - 1] || secs < 0 ||
+        (mon == 2 && mday == 29 &&
+         (year % 4 != 0 || (year % 100 == 0 && year % 400 != 0)))) {
+        return HWIRE_EILSEQ;
+    }
+    *t = days_from_civil(year, mon, mday) * 86400 + secs;
+    return HWIRE_OK;
+}
+
+/**
+ * @brief Parse rfc850-date = day-name-l "," SP date2 SP time-of-day SP GMT
+ *
+ * "Sunday, 06-Nov-94 08:49:37 GMT"
+ */
+static int parse_rfc850_date(const unsigned char *s, size_t len,
+                             unsigned int now, int64_t *t)
+{
+    int wday = 0;
+    size_t n = 0;
+
+    // the shortest day name is "Friday"
+    if (len < 30 || len > 33 || (wday = date_wday(s)) < 0) {
+        return HWIRE_EILSEQ;
+    }
+    n = len - 27;
+    s += 3;
+    if (strlen(DATE_WDAYS_TAIL[wday]) != n ||
+        memcmp(s, DATE_WDAYS_TAIL[wday], n) != 0) {
+        return HWIRE_EILSEQ;
+    }
+    s += n;
+    // ", 06-Nov-94 08:49:37 GMT"
+    unsigned int yy = date_2digit(s + 9);
+    if (s[0] != ',' || s[1] != SP || s[4] != '-' || s[11] != SP ||
+        date_word(s + 20) != DATE_WORD(' ', 'G', 'M', 'T') || yy == UINT_MAX) {
+        return HWIRE_EILSEQ;
+    }
+
+    // RFC 9110 5.6.7: a year more than 50 years in the future is in the
+    // previous century
+    if (now == 0) {
+        int64_t year     = 0;
+        unsigned int mon = 0;
+        unsigned int day = 0;
+        civil_from_days((int64_t)time(NULL) / 86400, &year, &mon, &day);
+        now = (unsigned int)year;
+    }
+    unsigned int y = now / 100 * 100 + yy;
+    if (y > now + 50) {
+        y -= 100;
+    }
+
+    return date_make(y, date_month(s + 5, '-'), date_2digit(s + 2),
+                     date_time(s + 12), t);
+}
+
+int hwire_parse_date(const char *str, size_t len, int64_t *t)
+{
+    return hwire_parse_date_at(str, len, 0, t);
+}
+
+int hwire_parse_date_at(const char *str, size_t len, unsigned int year,
+                        int64_t *t)
+{
+    assert(str != NULL || len == 0);
+    assert(t != NULL);
+    const unsigned char *s = (const unsigned char *)str;
+
+    if (len == HWIRE_DATE_LEN && s[3] == ',') {
+        // IMF-fixdate: "Sun, 06 Nov 1994 08:49:37 GMT"
+        if (date_wday(s) < 0 || s[4] != SP || s[7] != SP || s[16] != SP ||
+            date_word(s + 25) != DATE_WORD(' ', 'G', 'M', 'T')) {
+            return HWIRE_EILSEQ;
+        }
+        return date_make(date_4digit(s + 12), date_month(s + 8, SP),
+                         date_2digit(s + 5), date_time(s + 17), t);
+    } else if (len == 24 && s[3] == SP) {
+        // asctime-date: "Sun Nov  6 08:49:37 1994"
+        unsigned int mday = date_2digit(s + 8);
+        if (s[8] == SP) {
+            mday = (unsigned int)s[9] - '0';
+            mday = mday < 10 ? mday : UINT_MAX;
+        }
+        if (date_wday(s) < 0 || s[10] != SP || s[19] != SP) {
+            return HWIRE_EILSEQ;
+        }
+        return date_make(date_4digit(s + 20), date_month(s + 4, SP), mday,
+                         date_time(s + 11), t);
+    } else if (len > 3) {
+        return parse_rfc850_date(s, len, year, t);
+    }
+    return HWIRE_EILSEQ;
+}
+
+#undef DATE_WORD
+
+/** @} */ /* end of HTTP-Date Functions */
+
+/**
+ * @name Multipart Functions
+ * @{
+ */
+
+/**
+ * @brief Find the first occurrence of a delimiter
+ *
+ * Positions where both the first and the last byte of the delimiter match
+ * are found a vector at a time; only those are compared in full. The rest
+ * is scanned with memchr for the first byte.
+ *
+ * @param str String to search
+ * @param len Length of str
+ * @param d Delimiter (at least 3 bytes)
+ * @param dlen Length of d
+ * @return Offset of the delimiter, or len if str does not contain it
+ */
+static size_t mp_find(const unsigned char *str, size_t len,
+                      const unsigned char *d, size_t dlen)
+{
+    size_t cur = 0;
+    size_t end = 0; // candidates are [0, end)
+
+    if (len < dlen) {
+        return len;
+    }
+    end = len - dlen + 1;
+
+#if defined(__AVX2__)
+    {
+        const __m256i first = _mm256_set1_epi8((char)d[0]);
+        const __m256i last  = _mm256_set1_epi8((char)d[dlen - 1]);
+        // two vectors per iteration; candidates are rare in most bodies
+        for (; cur + 64 <= end; cur += 64) {
+            const unsigned char *f = str + cur;
+            const unsigned char *l = str + cur + dlen - 1;
+            __m256i m0             = _mm256_and_si256(
+                _mm256_cmpeq_epi8(
+                    _mm256_loadu_si256((const __m256i *)(const void *)f),
+                    first),
+                _mm256_cmpeq_epi8(
+                    _mm256_loadu_si256((const __m256i *)(const void *)l),
+                    last));
+            __m256i m1 = _mm256_and_si256(
+                _mm256_cmpeq_epi8(
+                    _mm256_loadu_si256((const __m256i *)(const void *)(f + 32)),
+                    first),
+                _mm256_cmpeq_epi8(
+                    _mm256_loadu_si256((const __m256i *)(const void *)(l + 32)),
+                    last));
+            if (_mm256_testz_si256(_mm256_or_si256(m0, m1),
+                                   _mm256_or_si256(m0, m1))) {
+                continue;
+            }
+            for (size_t k = 0; k < 2; k++) {
+                unsigned int m = (unsigned int)_mm256_movemask_epi8(k ? m1 :
+                                                                        m0);
+                while (m) {
+                    size_t i = cur + k * 32 + (size_t)ctz32(m);
+                    if (memcmp(str + i + 1, d + 1, dlen - 2) == 0) {
+                        return i;
+                    }
+                    m &= m - 1;
+                }
+            }
+        }
+    }
+#endif
+#if defined(__SSE2__)
+    {
+        const __m128i first = _mm_set1_epi8((char)d[0]);
+        const __m128i last  = _mm_set1_epi8((char)d[dlen - 1]);
+        // two vectors per iteration, as one 32-bit mask
+        for (; cur + 32 <= end; cur += 32) {
+            const unsigned char *f = str + cur;
+            const unsigned char *l = str + cur + dlen - 1;
+            __m128i m0 = _mm_and_si128(
+                _mm_cmpeq_epi8(
+                    _mm_loadu_si128((const __m128i *)(const void *)f), first),
+                _mm_cmpeq_epi8(
+                    _mm_loadu_si128((const __m128i *)(const void *)l), last));
+            __m128i m1 = _mm_and_si128(
+                _mm_cmpeq_epi8(
+                    _mm_loadu_si128((const __m128i *)(const void *)(f + 16)),
+                    first),
+                _mm_cmpeq_epi8(
+                    _mm_loadu_si128((const __m128i *)(const void *)(l + 16)),
+                    last));
+            unsigned int m = (unsigned int)_mm_movemask_epi8(m0) |
+                             (unsigned int)_mm_movemask_epi8(m1) << 16;
+            while (m) {
+                size_t i = cur + (size_t)ctz32(m);
+                if (memcmp(str + i + 1, d + 1, dlen - 2) == 0) {
+                    return i;
+                }
+                m &= m - 1;
+            }
+        }
+    }
+#elif defined(__aarch64__) || (defined(__arm__) && defined(__ARM_NEON))
+    {
+        const uint8x16_t first = vdupq_n_u8(d[0]);
+        const uint8x16_t last  = vdupq_n_u8(d[dlen - 1]);
+        for (; cur + 16 <= end; cur += 16) {
+            uint8x16_t eq = vandq_u8(vceqq_u8(vld1q_u8(str + cur), first),
+                                     vceqq_u8(vld1q_u8(str + cur + dlen - 1),
+                                              last));
+            uint64x2_t q  = vreinterpretq_u64_u8(eq);
+            for (size_t lane = 0; lane < 2; lane++) {
+                uint64_t m = lane ? vgetq_lane_u64(q, 1) : vgetq_lane_u64(q, 0);
+                while (m) {
+                    size_t k = (size_t)(ctz64(m) >> 3);
+                    size_t i = cur + lane * 8 + k;
+                    if (memcmp(str + i + 1, d + 1, dlen - 2) == 0) {
+                        return i;
+                    }
+                    m &= ~((uint64_t)0xFF << (k * 8));
+                }
+            }
+        }
+    }
+#endif
+
+    while (cur < end) {
+        const unsigned char *p = (const unsigned char *)memchr(
+            str + cur, d[0], end - cur);
+        if (p == NULL) {
+            break;
+        }
+        cur = (size_t)(p - str);
+        if (str[cur + dlen - 1] == d[dlen - 1] &&
+            memcmp(str + cur + 1, d + 1, dlen - 2) == 0) {
+            return cur;
+        }
+        cur++;
+    }
+    return len;
+}
+
+/**
+ * @brief Find a delimiter that may continue in the next fragment
+ *
+ * Called when str[cur..len) does not contain the delimiter, so only the
+ * last dlen - 1 bytes can start one.
+ *
+ * @return Offset of the first byte that starts a prefix of the delimiter
+ * reaching the end of str, or len
+ */
+static size_t mp_partial(const unsigned char *str, size_t len, size_t cur,
+                         const unsigned char *d, size_t dlen)
+{
+    if (len - cur >= dlen) {
+        cur = len - dlen + 1;
+    }
+    for (; cur < len; cur++) {
+        if (str[cur] == d[0] && memcmp(str + cur, d, len - cur) == 0) {
+            return cur;
+        }
+    }
+    return len;
+}
+
+/**
+ * @brief Parse the rest of a delimiter line
+ *
+ *  delimiter = CRLF dash-boundary
+ *  close-delimiter = delimiter "--"
+ *  encapsulation = delimiter transport-padding CRLF body-part
+ *  transport-padding = *LWSP-char
+ *
+ * @param mp Multipart parser
+ * @param ctx Parser context
+ * @param str String to parse
+ * @param len Length of string
+ * @param cur Input: offset after the boundary, Output: offset after the
+ * line or the close-delimiter
+ * @return HWIRE_OK on success
+ * @return HWIRE_EAGAIN if more data needed
+ * @return HWIRE_EILSEQ if the line has an invalid suffix
+ * @return HWIRE_ELEN if transport-padding exceeds mp->maxlen
+ * @return HWIRE_ECALLBACK if part_cb returned non-zero
+ */
+static int mp_delimiter(hwire_multipart_t *mp, hwire_ctx_t *ctx,
+                        const unsigned char *str, size_t len, size_t *cur)
+{
+    size_t i = *cur;
+
+    if (i + 2 > len) {
+        return HWIRE_EAGAIN;
+    } else if (str[i] == '-') {
+        if (str[i + 1] != '-') {
+            return HWIRE_EILSEQ;
+        }
+        *cur      = i + 2;
+        mp->state = HWIRE_MULTIPART_DONE;
+        return HWIRE_OK;
+    }
+
+    while (i < len && (str[i] == SP || str[i] == HT)) {
+        i++;
+    }
+    if (i - *cur > mp->maxlen) {
+        return HWIRE_ELEN;
+    } else if (i + 2 > len) {
+        return HWIRE_EAGAIN;
+    } else if (str[i] != CR || str[i + 1] != LF) {
+        return HWIRE_EILSEQ;
+    }
+    *cur      = i + 2;
+    mp->state = HWIRE_MULTIPART_HEADERS;
+    if (ctx->part_cb != NULL && ctx->part_cb(ctx) != 0) {
+        return HWIRE_ECALLBACK;
+    }
+    return HWIRE_OK;
+}
+
+/**
+ * @brief Initialize a multipart parser
+ */
+int hwire_multipart_init(hwire_multipart_t *mp, const char *boundary,
+                         size_t len, size_t maxlen, uint8_t maxnhdrs)
+{
+    assert(mp != NULL);
+    assert(boundary != NULL);
+    static const char BCHARS[] = "'()+_,-./:=? ";
+
+    if (len == 0 || len > HWIRE_MAX_BOUNDARY) {
+        return HWIRE_ERANGE;
+    }
+    // bchars; the last one must not be a space
+    for (size_t i = 0; i < len; i++) {
+        unsigned char c = (unsigned char)boundary[i];
+        if (!((c >= '0' && c <= '9') || ((c | 0x20) >= 'a' &&
+                                         (c | 0x20) <= 'z') ||
+              (c != '\0' && memchr(BCHARS, c, sizeof(BCHARS) - 1) != NULL))) {
+            return HWIRE_EILSEQ;
+        }
+    }
+    if (boundary[len - 1] == SP) {
+        return HWIRE_EILSEQ;
+    }
+
+    memcpy(mp->delim, "\r\n--", 4);
+    memcpy(mp->delim + 4, boundary, len);
+    mp->dlen     = (uint8_t)(len + 4);
+    mp->maxlen   = maxlen;
+    mp->maxnhdrs = maxnhdrs;
+    mp->state    = HWIRE_MULTIPART_START;
+    return HWIRE_OK;
+}
+
+/**
+ * @brief Parse the next fragment of a multipart body
+ */
+int hwire_multipart_parse(hwire_multipart_t *mp, hwire_ctx_t *ctx,
+                          const char *str, size_t len, size_t *pos)
+{
+    assert(mp != NULL);
+    assert(ctx != NULL);
+    assert(str != NULL || len == 0);
+    assert(pos != NULL);
+    const unsigned char *ustr = (const unsigned char *)str;
+    const unsigned char *d    = (const unsigned char *)mp->delim;
+    size_t dlen               = mp->dlen;
+    size_t cur                = 0;
+    size_t n                  = 0;
+    int rv                    = 0;
+
+    for (;;) {
+        switch (mp->state) {
+        case HWIRE_MULTIPART_START:
+            // dash-boundary at the very start: the preamble is empty
+            n = (len < dlen - 2) ? len : dlen - 2;
+            if (memcmp(ustr, d + 2, n) != 0) {
+                mp->state = HWIRE_MULTIPART_PREAMBLE;
+                break;
+            } else if (n < dlen - 2) {
+                *pos = 0;
+                return HWIRE_EAGAIN;
+            }
+            cur = n;
+            rv  = mp_delimiter(mp, ctx, ustr, len, &cur);
+            if (rv != HWIRE_OK) {
+                *pos = 0;
+                return rv;
+            }
+            break;
+
+        case HWIRE_MULTIPART_PREAMBLE:
+        case HWIRE_MULTIPART_BODY:
+            n = cur + mp_find(ustr + cur, len - cur, d, dlen);
+            if (n == len) {
+                // hold back what may be the start of a delimiter
+                n = mp_partial(ustr, len, cur, d, dlen);
+            }
+            if (n > cur && mp->state == HWIRE_MULTIPART_BODY &&
+                ctx->body_cb != NULL &&
+                ctx->body_cb(ctx, str + cur, n - cur) != 0) {
+                return HWIRE_ECALLBACK;
+            }
+            cur = n;
+            if (n + dlen > len) {
+                *pos = cur;
+                return HWIRE_EAGAIN;
+            }
+            n += dlen;
+            rv = mp_delimiter(mp, ctx, ustr, len, &n);
+            if (rv != HWIRE_OK) {
+                *pos = cur;
+                return rv;
+            }
+            cur = n;
+            break;
+
+        case HWIRE_MULTIPART_HEADERS:
+            n  = 0;
+            rv = hwire_parse_headers(ctx, str + cur, len - cur, &n, mp->maxlen,
+                                     mp->maxnhdrs);
+            if (rv != HWIRE_OK) {
+                *pos = cur;
+                return rv;
+            }
+            cur += n;
+            mp->state = HWIRE_MULTIPART_BODY;
+            break;
+
+        default:
+            *pos = cur;
+            return HWIRE_OK;
+        }
+    }
+}
+
+/** @} */ /* end of Multipart Functions */
+
+/**
+ * @name WebSocket Functions
+ * @{
+ */
+
+#define WS_ROL(x, n) (((x) << (n)) | ((x) >> (32 - (n))))
+
+/**
+ * @brief SHA-1 compression function
+ *
+ * @param h Hash state
+ * @param p 64-byte block
+ * @see RFC 3174 Section 6.1
+ */
+static void ws_sha1_block(uint32_t h[5], const unsigned char *p)
+{
+    uint32_t w[80];
+    uint32_t a = h[0];
+    uint32_t b = h[1];
+    uint32_t c = h[2];
+    uint32_t d = h[3];
+    uint32_t e = h[4];
+
+    for (size_t i = 0; i < 16; i++) {
+        w[i] = (uint32_t)p[i * 4] << 24 | (uint32_t)p[i * 4 + 1] << 16 |
+               (uint32_t)p[i * 4 + 2] << 8 | (uint32_t)p[i * 4 + 3];
+    }
+    for (size_t i = 16; i < 80; i++) {
+        uint32_t x = w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16];
+        w[i]       = WS_ROL(x, 1);
+    }
+    for (size_t i = 0; i < 80; i++) {
+        uint32_t f = 0;
+        uint32_t t = 0;
+        if (i < 20) {
+            f = ((b & c) | (~b & d)) + 0x5A827999u;
+        } else if (i < 40) {
+            f = (b ^ c ^ d) + 0x6ED9EBA1u;
+        } else if (i < 60) {
+            f = ((b & c) | (b & d) | (c & d)) + 0x8F1BBCDCu;
+        } else {
+            f = (b ^ c ^ d) + 0xCA62C1D6u;
+        }
+        t = WS_ROL(a, 5) + f + e + w[i];
+        e = d;
+        d = c;
+        c = WS_ROL(b, 30);
+        b = a;
+        a = t;
+    }
+    h[0] += a;
+    h[1] += b;
+    h[2] += c;
+    h[3] += d;
+    h[4] += e;
+}
+
+#undef WS_ROL
+
+static const char WS_BASE64[] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+#define WS_KEY_LEN 24
+
+/**
+ * @brief Check a Sec-WebSocket-Key value
+ *
+ * 16 bytes encode to 22 base64 characters and "=="; the last character
+ * carries 2 bits of data, so its 4 low bits must be zero.
+ *
+ * @return 1 if key is the base64 encoding of 16 bytes, 0 otherwise
+ */
+static int ws_key_valid(const unsigned char *key, size_t len)
+{
+    if (len != WS_KEY_LEN || key[22] != EQ || key[23] != EQ) {
+        return 0;
+    }
+    for (size_t i = 0; i < 22; i++) {
+        unsigned char c = key[i];
+        if (!((c >= '0' && c <= '9') ||
+              ((c | 0x20) >= 'a' && (c | 0x20) <= 'z') || c == '+' ||
+              c == '/')) {
+            return 0;
+        }
+    }
+    return key[21] == 'A' || key[21] == 'Q' || key[21] == 'g' ||
+           key[21] == 'w';
+}
+
+/**
+ * @brief Compute Sec-WebSocket-Accept from Sec-WebSocket-Key
+ */
+int hwire_ws_accept(const char *key, size_t len, char *accept)
+{
+    assert(key != NULL);
+    assert(accept != NULL);
+    static const char GUID[] = "258EAFA5-E914-47DA-95CA-C5AB0DC85B11";
+    // key and GUID (60 bytes) with SHA-1 padding fill two blocks
+    unsigned char msg[128] = {0};
+    unsigned char md[21]   = {0};
+    uint32_t h[5]          = {0x67452301u, 0xEFCDAB89u, 0x98BADCFEu,
+                              0x10325476u, 0xC3D2E1F0u};
+
+    if (!ws_key_valid((const unsigned char *)key, len)) {
+        return HWIRE_EILSEQ;
+    }
+    memcpy(msg, key, WS_KEY_LEN);
+    memcpy(msg + WS_KEY_LEN, GUID, sizeof(GUID) - 1);
+    msg[60]  = 0x80;
+    msg[126] = (60 * 8) >> 8;
+    msg[127] = (60 * 8) & 0xFF;
+    ws_sha1_block(h, msg);
+    ws_sha1_block(h, msg + 64);
+    for (size_t i = 0; i < 20; i++) {
+        md[i] = (unsigned char)(h[i / 4] >> (24 - (i % 4) * 8));
+    }
+
+    // 20 bytes: six groups of three and a final pair padded with '='
+    for (size_t i = 0; i < 21; i += 3) {
+        uint32_t v = (uint32_t)md[i] << 16 | (uint32_t)md[i + 1] << 8 |
+                     md[i + 2];
+        char *out  = accept + i / 3 * 4;
+        out[0]     = WS_BASE64[v >> 18];
+        out[1]     = WS_BASE64[(v >> 12) & 0x3F];
+        out[2]     = WS_BASE64[(v >> 6) & 0x3F];
+        out[3]     = WS_BASE64[v & 0x3F];
+    }
+    accept[HWIRE_WS_ACCEPT_LEN - 1] = EQ;
+    return HWIRE_OK;
+}
+
+#undef WS_KEY_LEN
+
+/**
+ * @brief Validate a WebSocket opening handshake request
+ */
+int hwire_ws_handshake(const hwire_ctx_t *ctx, char *accept)
+{
+    assert(ctx != NULL);
+    assert(ctx->hdr_index != NULL);
+    assert(ctx->framing != NULL);
+    assert(accept != NULL);
+    const unsigned int upgrade = HWIRE_FRAMING_UPGRADE |
+                                 HWIRE_FRAMING_WEBSOCKET;
+    const hwire_hdr_entry_t *e = NULL;
+
+    if ((ctx->framing->flags & upgrade) != upgrade) {
+        return HWIRE_EHDRVALUE;
+    }
+    e = hwire_hdr_index_get(ctx->hdr_index, "sec-websocket-version", 21);
+    if (e == NULL || e->next != 0 || e->header.value.len != 2 ||
+        memcmp(e->header.value.ptr, "13", 2) != 0) {
+        return HWIRE_EVERSION;
+    }
+    e = hwire_hdr_index_get(ctx->hdr_index, "sec-websocket-key", 17);
+    if (e == NULL || e->next != 0 ||
+        hwire_ws_accept(e->header.value.ptr, e->header.value.len,
+                        accept) != HWIRE_OK) {
+        return HWIRE_EHDRVALUE;
+    }
+    return HWIRE_OK;
+}
+
+/**
+ * @brief Parse a WebSocket frame header
+ */
+int hwire_ws_parse_frame(const char *str, size_t len, size_t *pos,
+                         uint64_t maxlen, hwire_ws_frame_t *frame)
+{
+    assert(str != NULL || len == 0);
+    assert(pos != NULL);
+    assert(frame != NULL);
+    const unsigned char *s = (const unsigned char *)str;
+    size_t hlen            = 2;
+    uint64_t plen          = 0;
+    unsigned int op        = 0;
+
+    if (len < 2) {
+        return HWIRE_EAGAIN;
+    }
+    op   = s[0] & 0x0F;
+    plen = s[1] & 0x7F;
+    // 0x3-0x7 and 0xB-0xF are reserved
+    if ((op > HWIRE_WS_BINARY && op < HWIRE_WS_CLOSE) || op > HWIRE_WS_PONG) {
+        return HWIRE_EILSEQ;
+    }
+    // control frames must not be fragmented and carry at most 125 bytes
+    if ((op & 0x08) && (!(s[0] & HWIRE_WS_FIN) || plen > 125)) {
+        return HWIRE_EILSEQ;
+    }
+
+    // the extended lengths must use the shortest form, and 64 bits at most
+    // 2^63 - 1
+    if (plen == 126) {
+        hlen = 4;
+        if (len < hlen) {
+            return HWIRE_EAGAIN;
+        }
+        plen = (uint64_t)s[2] << 8 | s[3];
+        if (plen < 126) {
+            return HWIRE_EILSEQ;
+        }
+    } else if (plen == 127) {
+        hlen = 10;
+        if (len < hlen) {
+            return HWIRE_EAGAIN;
+        }
+        plen = 0;
+        for (size_t i = 2; i < 10; i++) {
+            plen = plen << 8 | s[i];
+        }
+        if (plen <= 0xFFFF || (plen >> 63) != 0) {
+            return HWIRE_EILSEQ;
+        }
+    }
+    if (plen > maxlen) {
+        return HWIRE_ELEN;
+    }
+
+    frame->flags = (uint8_t)(s[0] & 0xF0);
+    if (s[1] & 0x80) {
+        if (len < hlen + 4) {
+            return HWIRE_EAGAIN;
+        }
+        memcpy(frame->mask, s + hlen, 4);
+        frame->flags |= HWIRE_WS_MASKED;
+        hlen += 4;
+    }
+    frame->len    = plen;
+    frame->opcode = (uint8_t)op;
+    *pos          = hlen;
+    return HWIRE_OK;
+}
+
+/**
+ * @brief Unmask a WebSocket payload in place
+ *
+ * The key is rotated to the phase of data[0] and broadcast to a vector, so
+ * the main loop is a load, an XOR and a store per vector.
+ */
+void hwire_ws_unmask(char *data, size_t len, const uint8_t mask[4],
+                     uint64_t offset)
+{
+    assert(data != NULL || len == 0);
+    assert(mask != NULL);
+    unsigned char *p = (unsigned char *)data;
+    unsigned char key[4];
+    uint32_t k32 = 0;
+    size_t i     = 0;
+
+    for (size_t j = 0; j < 4; j++) {
+        key[j] = mask[(offset + j) & 3];
+    }
+    memcpy(&k32, key, 4);
+
+    // every loop advances i by a multiple of 4, so key[i & 3] stays in phase
+#if defined(__AVX2__)
+    {
+        const __m256i k = _mm256_set1_epi32((int)k32);
+        for (; i + 64 <= len; i += 64) {
+            __m256i *v = (__m256i *)(void *)(p + i);
+            __m256i a  = _mm256_loadu_si256(v);
+            __m256i b  = _mm256_loadu_si256(v + 1);
+            _mm256_storeu_si256(v, _mm256_xor_si256(a, k));
+            _mm256_storeu_si256(v + 1, _mm256_xor_si256(b, k));
+        }
+    }
+#endif
+#if defined(__SSE2__)
+    {
+        const __m128i k = _mm_set1_epi32((int)k32);
+        for (; i + 16 <= len; i += 16) {
+            __m128i *v = (__m128i *)(void *)(p + i);
+            _mm_storeu_si128(v, _mm_xor_si128(_mm_loadu_si128(v), k));
+        }
+    }
+#elif defined(__aarch64__) || (defined(__arm__) && defined(__ARM_NEON))
+    {
+        const uint8x16_t k = vreinterpretq_u8_u32(vdupq_n_u32(k32));
+        for (; i + 16 <= len; i += 16) {
+            vst1q_u8(p + i, veorq_u8(vld1q_u8(p + i), k));
+        }
+    }
+#else
+    {
+        // both halves hold the key, so byte order does not matter
+        const uint64_t k = (uint64_t)k32 << 32 | k32;
+        for (; i + 8 <= len; i += 8) {
+            uint64_t w;
+            memcpy(&w, p + i, 8);
+            w ^= k;
+            memcpy(p + i, &w, 8);
+        }
+    }
+#endif
+    for (; i < len; i++) {
+        p[i] ^= key[i & 3];
+    }
+}
+
+/** @} */ /* end of WebSocket Functions */
+
+/**
+ * @name HPACK Functions
+ * @{
+ */
+
+// size of an entry beyond its name and value (RFC 7541 4.1)
+#define HPACK_ENTRY_OVERHEAD 32
+
+/**
+ * @brief Static table entry (RFC 7541 Appendix A)
+ */
+typedef struct {
+    const char *name;  /**< Field name */
+    const char *value; /**< Field value */
+    uint8_t nlen;      /**< Length of name */
+    uint8_t vlen;      /**< Length of value */
+    uint32_t hash;     /**< CRC32C of name, as in hwire_buf_t.hash */
+} hpack_static_t;
+
+#define HPACK_STATIC(name, value, hash)                                        \
+    {name, value, (uint8_t)(sizeof(name) - 1), (uint8_t)(sizeof(value) - 1),   \
+     hash}
+
+static const hpack_static_t HPACK_STATIC_TABLE[] = {
+    HPACK_STATIC(":authority", "", 0x2CC806FCu),
+    HPACK_STATIC(":method", "GET", 0xF787156Bu),
+    HPACK_STATIC(":method", "POST", 0xF787156Bu),
+    HPACK_STATIC(":path", "/", 0x68F61B6Cu),
+    HPACK_STATIC(":path", "/index.html", 0x68F61B6Cu),
+    HPACK_STATIC(":scheme", "http", 0x1C719372u),
+    HPACK_STATIC(":scheme", "https", 0x1C719372u),
+    HPACK_STATIC(":status", "200", 0x51E9C8F1u),
+    HPACK_STATIC(":status", "204", 0x51E9C8F1u),
+    HPACK_STATIC(":status", "206", 0x51E9C8F1u),
+    HPACK_STATIC(":status", "304", 0x51E9C8F1u),
+    HPACK_STATIC(":status", "400", 0x51E9C8F1u),
+    HPACK_STATIC(":status", "404", 0x51E9C8F1u),
+    HPACK_STATIC(":status", "500", 0x51E9C8F1u),
+    HPACK_STATIC("accept-charset", "", 0x78ABE87Eu),
+    HPACK_STATIC("accept-encoding", "gzip, deflate", 0x66888A1Au),
+    HPACK_STATIC("accept-language", "", 0xA51EFFA5u),
+    HPACK_STATIC("accept-ranges", "", 0x594884D2u),
+    HPACK_STATIC("accept", "", 0x5D64AD91u),
+    HPACK_STATIC("access-control-allow-origin", "", 0xE59024CAu),
+    HPACK_STATIC("age", "", 0x4DC221F4u),
+    HPACK_STATIC("allow", "", 0xE2662116u),
+    HPACK_STATIC("authorization", "", 0xA4F9ECD7u),
+    HPACK_STATIC("cache-control", "", 0xF0A120D0u),
+    HPACK_STATIC("content-disposition", "", 0x687B172Du),
+    HPACK_STATIC("content-encoding", "", 0xC1D0AA48u),
+    HPACK_STATIC("content-language", "", 0x0246DFF7u),
+    HPACK_STATIC("content-length", "", 0x187B63A4u),
+    HPACK_STATIC("content-location", "", 0x75A06782u),
+    HPACK_STATIC("content-range", "", 0x1F4F1B86u),
+    HPACK_STATIC("content-type", "", 0xD71445A8u),
+    HPACK_STATIC("cookie", "", 0x940ACC96u),
+    HPACK_STATIC("date", "", 0x6942EACEu),
+    HPACK_STATIC("etag", "", 0x7CEC7345u),
+    HPACK_STATIC("expect", "", 0x6D83214Cu),
+    HPACK_STATIC("expires", "", 0x480271F2u),
+    HPACK_STATIC("from", "", 0x5046B6D9u),
+    HPACK_STATIC("host", "", 0x959CFD20u),
+    HPACK_STATIC("if-match", "", 0x1D272F69u),
+    HPACK_STATIC("if-modified-since", "", 0x2C75239Fu),
+    HPACK_STATIC("if-none-match", "", 0x60CD2A49u),
+    HPACK_STATIC("if-range", "", 0x092A7722u),
+    HPACK_STATIC("if-unmodified-since", "", 0x60B50CFCu),
+    HPACK_STATIC("last-modified", "", 0xF49696FCu),
+    HPACK_STATIC("link", "", 0x8EBB0A1Du),
+    HPACK_STATIC("location", "", 0xB8217A08u),
+    HPACK_STATIC("max-forwards", "", 0xF7A48F36u),
+    HPACK_STATIC("proxy-authenticate", "", 0x0F22008Fu),
+    HPACK_STATIC("proxy-authorization", "", 0xECA29BE6u),
+    HPACK_STATIC("range", "", 0x564A2EB1u),
+    HPACK_STATIC("referer", "", 0x543B9EBFu),
+    HPACK_STATIC("refresh", "", 0x8DBBC14Fu),
+    HPACK_STATIC("retry-after", "", 0x22A756D5u),
+    HPACK_STATIC("server", "", 0x3C62153Au),
+    HPACK_STATIC("set-cookie", "", 0xCB0CBBE3u),
+    HPACK_STATIC("strict-transport-security", "", 0x1D5F1178u),
+    HPACK_STATIC("transfer-encoding", "", 0x4FF967FBu),
+    HPACK_STATIC("user-agent", "", 0x909D98E3u),
+    HPACK_STATIC("vary", "", 0x0B9321FFu),
+    HPACK_STATIC("via", "", 0x7AD13D82u),
+    HPACK_STATIC("www-authenticate", "", 0xB6E62776u),
+};
+
+#undef HPACK_STATIC
+
+#define HPACK_STATIC_LEN                                                       \
+    (sizeof(HPACK_STATIC_TABLE) / sizeof(HPACK_STATIC_TABLE[0]))
+
+/*
+ * Huffman code (RFC 7541 Appendix B). The code is canonical: codes of the
+ * same length are consecutive and ordered by symbol, so codes longer than
+ * HUFF_FAST_BITS are found by comparing with the first and last code of
+ * each length.
+ */
+
+#define HUFF_FAST_BITS 12
+
+/**
+ * Decoding of the next HUFF_FAST_BITS bits of input: the first symbol in
+ * bits 0-7, the second in bits 8-15, the length of the first code in bits
+ * 16-19, the length of both in bits 20-25 and the number of symbols in
+ * bits 26-27; 0 if the first code is longer than HUFF_FAST_BITS or EOS.
+ * Two symbols are decoded when both codes fit, which is the common case
+ * for lowercase letters and digits of 5 and 6 bits.
+ */
+static const uint32_t HUFF_FAST[4096] = {
+    0x08A53030, 0x08A53030, 0x08A53030, 0x08A53030, 0x08A53130, 0x08A53130,
+    0x08A53130, 0x08A53130, 0x08A53230, 0x08A53230, 0x08A53230, 0x08A53230,
+    0x08A56130, 0x08A56130, 0x08A56130, 0x08A56130, 0x08A56330, 0x08A56330,
+    0x08A56330, 0x08A56330, 0x08A56530, 0x08A56530, 0x08A56530, 0x08A56530,
+    0x08A56930, 0x08A56930, 0x08A56930, 0x08A56930, 0x08A56F30, 0x08A56F30,
+    0x08A56F30, 0x08A56F30, 0x08A57330, 0x08A57330, 0x08A57330, 0x08A57330,
+    0x08A57430, 0x08A57430, 0x08A57430, 0x08A57430, 0x08B52030, 0x08B52030,
+    0x08B52530, 0x08B52530, 0x08B52D30, 0x08B52D30, 0x08B52E30, 0x08B52E30,
+    0x08B52F30, 0x08B52F30, 0x08B53330, 0x08B53330, 0x08B53430, 0x08B53430,
+    0x08B53530, 0x08B53530, 0x08B53630, 0x08B53630, 0x08B53730, 0x08B53730,
+    0x08B53830, 0x08B53830, 0x08B53930, 0x08B53930, 0x08B53D30, 0x08B53D30,
+    0x08B54130, 0x08B54130, 0x08B55F30, 0x08B55F30, 0x08B56230, 0x08B56230,
+    0x08B56430, 0x08B56430, 0x08B56630, 0x08B56630, 0x08B56730, 0x08B56730,
+    0x08B56830, 0x08B56830, 0x08B56C30, 0x08B56C30, 0x08B56D30, 0x08B56D30,
+    0x08B56E30, 0x08B56E30, 0x08B57030, 0x08B57030, 0x08B57230, 0x08B57230,
+    0x08B57530, 0x08B57530, 0x08C53A30, 0x08C54230, 0x08C54330, 0x08C54430,
+    0x08C54530, 0x08C54630, 0x08C54730, 0x08C54830, 0x08C54930, 0x08C54A30,
+    0x08C54B30, 0x08C54C30, 0x08C54D30, 0x08C54E30, 0x08C54F30, 0x08C55030,
+    0x08C55130, 0x08C55230, 0x08C55330, 0x08C55430, 0x08C55530, 0x08C55630,
+    0x08C55730, 0x08C55930, 0x08C56A30, 0x08C56B30, 0x08C57130, 0x08C57630,
+    0x08C57730, 0x08C57830, 0x08C57930, 0x08C57A30, 0x04550030, 0x04550030,
+    0x04550030, 0x04550030, 0x08A53031, 0x08A53031, 0x08A53031, 0x08A53031,
+    0x08A53131, 0x08A53131, 0x08A53131, 0x08A53131, 0x08A53231, 0x08A53231,
+    0x08A53231, 0x08A53231, 0x08A56131, 0x08A56131, 0x08A56131, 0x08A56131,
+    0x08A56331, 0x08A56331, 0x08A56331, 0x08A56331, 0x08A56531, 0x08A56531,
+    0x08A56531, 0x08A56531, 0x08A56931, 0x08A56931, 0x08A56931, 0x08A56931,
+    0x08A56F31, 0x08A56F31, 0x08A56F31, 0x08A56F31, 0x08A57331, 0x08A57331,
+    0x08A57331, 0x08A57331, 0x08A57431, 0x08A57431, 0x08A57431, 0x08A57431,
+    0x08B52031, 0x08B52031, 0x08B52531, 0x08B52531, 0x08B52D31, 0x08B52D31,
+    0x08B52E31, 0x08B52E31, 0x08B52F31, 0x08B52F31, 0x08B53331, 0x08B53331,
+    0x08B53431, 0x08B53431, 0x08B53531, 0x08B53531, 0x08B53631, 0x08B53631,
+    0x08B53731, 0x08B53731, 0x08B53831, 0x08B53831, 0x08B53931, 0x08B53931,
+    0x08B53D31, 0x08B53D31, 0x08B54131, 0x08B54131, 0x08B55F31, 0x08B55F31,
+    0x08B56231, 0x08B56231, 0x08B56431, 0x08B56431, 0x08B56631, 0x08B56631,
+    0x08B56731, 0x08B56731, 0x08B56831, 0x08B56831, 0x08B56C31, 0x08B56C31,
+    0x08B56D31, 0x08B56D31, 0x08B56E31, 0x08B56E31, 0x08B57031, 0x08B57031,
+    0x08B57231, 0x08B57231, 0x08B57531, 0x08B57531, 0x08C53A31, 0x08C54231,
+    0x08C54331, 0x08C54431, 0x08C54531, 0x08C54631, 0x08C54731, 0x08C54831,
+    0x08C54931, 0x08C54A31, 0x08C54B31, 0x08C54C31, 0x08C54D31, 0x08C54E31,
+    0x08C54F31, 0x08C55031, 0x08C55131, 0x08C55231, 0x08C55331, 0x08C55431,
+    0x08C55531, 0x08C55631, 0x08C55731, 0x08C55931, 0x08C56A31, 0x08C56B31,
+    0x08C57131, 0x08C57631, 0x08C57731, 0x08C57831, 0x08C57931, 0x08C57A31,
+    0x04550031, 0x04550031, 0x04550031, 0x04550031, 0x08A53032, 0x08A53032,
+    0x08A53032, 0x08A53032, 0x08A53132, 0x08A53132, 0x08A53132, 0x08A53132,
+    0x08A53232, 0x08A53232, 0x08A53232, 0x08A53232, 0x08A56132, 0x08A56132,
+    0x08A56132, 0x08A56132, 0x08A56332, 0x08A56332, 0x08A56332, 0x08A56332,
+    0x08A56532, 0x08A56532, 0x08A56532, 0x08A56532, 0x08A56932, 0x08A56932,
+    0x08A56932, 0x08A56932, 0x08A56F32, 0x08A56F32, 0x08A56F32, 0x08A56F32,
+    0x08A57332, 0x08A57332, 0x08A57332, 0x08A57332, 0x08A57432, 0x08A57432,
+    0x08A57432, 0x08A57432, 0x08B52032, 0x08B52032, 0x08B52532, 0x08B52532,
+    0x08B52D32, 0x08B52D32, 0x08B52E32, 0x08B52E32, 0x08B52F32, 0x08B52F32,
+    0x08B53332, 0x08B53332, 0x08B53432, 0x08B53432, 0x08B53532, 0x08B53532,
+    0x08B53632, 0x08B53632, 0x08B53732, 0x08B53732, 0x08B53832, 0x08B53832,
+    0x08B53932, 0x08B53932, 0x08B53D32, 0x08B53D32, 0x08B54132, 0x08B54132,
+    0x08B55F32, 0x08B55F32, 0x08B56232, 0x08B56232, 0x08B56432, 0x08B56432,
+    0x08B56632, 0x08B56632, 0x08B56732, 0x08B56732, 0x08B56832, 0x08B56832,
+    0x08B56C32, 0x08B56C32, 0x08B56D32, 0x08B56D32, 0x08B56E32, 0x08B56E32,
+    0x08B57032, 0x08B57032, 0x08B57232, 0x08B57232, 0x08B57532, 0x08B57532,
+    0x08C53A32, 0x08C54232, 0x08C54332, 0x08C54432, 0x08C54532, 0x08C54632,
+    0x08C54732, 0x08C54832, 0x08C54932, 0x08C54A32, 0x08C54B32, 0x08C54C32,
+    0x08C54D32, 0x08C54E32, 0x08C54F32, 0x08C55032, 0x08C55132, 0x08C55232,
+    0x08C55332, 0x08C55432, 0x08C55532, 0x08C55632, 0x08C55732, 0x08C55932,
+    0x08C56A32, 0x08C56B32, 0x08C57132, 0x08C57632, 0x08C57732, 0x08C57832,
+    0x08C57932, 0x08C57A32, 0x04550032, 0x04550032, 0x04550032, 0x04550032,
+    0x08A53061, 0x08A53061, 0x08A53061, 0x08A53061, 0x08A53161, 0x08A53161,
+    0x08A53161, 0x08A53161, 0x08A53261, 0x08A53261, 0x08A53261, 0x08A53261,
+    0x08A56161, 0x08A56161, 0x08A56161, 0x08A56161, 0x08A56361, 0x08A56361,
+    0x08A56361, 0x08A56361, 0x08A56561, 0x08A56561, 0x08A56561, 0x08A56561,
+    0x08A56961, 0x08A56961, 0x08A56961, 0x08A56961, 0x08A56F61, 0x08A56F61,
+    0x08A56F61, 0x08A56F61, 0x08A57361, 0x08A57361, 0x08A57361, 0x08A57361,
+    0x08A57461, 0x08A57461, 0x08A57461, 0x08A57461, 0x08B52061, 0x08B52061,
+    0x08B52561, 0x08B52561, 0x08B52D61, 0x08B52D61, 0x08B52E61, 0x08B52E61,
+    0x08B52F61, 0x08B52F61, 0x08B53361, 0x08B53361, 0x08B53461, 0x08B53461,
+    0x08B53561, 0x08B53561, 0x08B53661, 0x08B53661, 0x08B53761, 0x08B53761,
+    0x08B53861, 0x08B53861, 0x08B53961, 0x08B53961, 0x08B53D61, 0x08B53D61,
+    0x08B54161, 0x08B54161, 0x08B55F61, 0x08B55F61, 0x08B56261, 0x08B56261,
+    0x08B56461, 0x08B56461, 0x08B56661, 0x08B56661, 0x08B56761, 0x08B56761,
+    0x08B56861, 0x08B56861, 0x08B56C61, 0x08B56C61, 0x08B56D61, 0x08B56D61,
+    0x08B56E61, 0x08B56E61, 0x08B57061, 0x08B57061, 0x08B57261, 0x08B57261,
+    0x08B57561, 0x08B57561, 0x08C53A61, 0x08C54261, 0x08C54361, 0x08C54461,
+    0x08C54561, 0x08C54661, 0x08C54761, 0x08C54861, 0x08C54961, 0x08C54A61,
+    0x08C54B61, 0x08C54C61, 0x08C54D61, 0x08C54E61, 0x08C54F61, 0x08C55061,
+    0x08C55161, 0x08C55261, 0x08C55361, 0x08C55461, 0x08C55561, 0x08C55661,
+    0x08C55761, 0x08C55961, 0x08C56A61, 0x08C56B61, 0x08C57161, 0x08C57661,
+    0x08C57761, 0x08C57861, 0x08C57961, 0x08C57A61, 0x04550061, 0x04550061,
+    0x04550061, 0x04550061, 0x08A53063, 0x08A53063, 0x08A53063, 0x08A53063,
+    0x08A53163, 0x08A53163, 0x08A53163, 0x08A53163, 0x08A53263, 0x08A53263,
+    0x08A53263, 0x08A53263, 0x08A56163, 0x08A56163, 0x08A56163, 0x08A56163,
+    0x08A56363, 0x08A56363, 0x08A56363, 0x08A56363, 0x08A56563, 0x08A56563,
+    0x08A56563, 0x08A56563, 0x08A56963, 0x08A56963, 0x08A56963, 0x08A56963,
+    0x08A56F63, 0x08A56F63, 0x08A56F63, 0x08A56F63, 0x08A57363, 0x08A57363,
+    0x08A57363, 0x08A57363, 0x08A57463, 0x08A57463, 0x08A57463, 0x08A57463,
+    0x08B52063, 0x08B52063, 0x08B52563, 0x08B52563, 0x08B52D63, 0x08B52D63,
+    0x08B52E63, 0x08B52E63, 0x08B52F63, 0x08B52F63, 0x08B53363, 0x08B53363,
+    0x08B53463, 0x08B53463, 0x08B53563, 0x08B53563, 0x08B53663, 0x08B53663,
+    0x08B53763, 0x08B53763, 0x08B53863, 0x08B53863, 0x08B53963, 0x08B53963,
+    0x08B53D63, 0x08B53D63, 0x08B54163, 0x08B54163, 0x08B55F63, 0x08B55F63,
+    0x08B56263, 0x08B56263, 0x08B56463, 0x08B56463, 0x08B56663, 0x08B56663,
+    0x08B56763, 0x08B56763, 0x08B56863, 0x08B56863, 0x08B56C63, 0x08B56C63,
+    0x08B56D63, 0x08B56D63, 0x08B56E63, 0x08B56E63, 0x08B57063, 0x08B57063,
+    0x08B57263, 0x08B57263, 0x08B57563, 0x08B57563, 0x08C53A63, 0x08C54263,
+    0x08C54363, 0x08C54463, 0x08C54563, 0x08C54663, 0x08C54763, 0x08C54863,
+    0x08C54963, 0x08C54A63, 0x08C54B63, 0x08C54C63, 0x08C54D63, 0x08C54E63,
+    0x08C54F63, 0x08C55063, 0x08C55163, 0x08C55263, 0x08C55363, 0x08C55463,
+    0x08C55563, 0x08C55663, 0x08C55763, 0x08C55963, 0x08C56A63, 0x08C56B63,
+    0x08C57163, 0x08C57663, 0x08C57763, 0x08C57863, 0x08C57963, 0x08C57A63,
+    0x04550063, 0x04550063, 0x04550063, 0x04550063, 0x08A53065, 0x08A53065,
+    0x08A53065, 0x08A53065, 0x08A53165, 0x08A53165, 0x08A53165, 0x08A53165,
+    0x08A53265, 0x08A53265, 0x08A53265, 0x08A53265, 0x08A56165, 0x08A56165,
+    0x08A56165, 0x08A56165, 0x08A56365, 0x08A56365, 0x08A56365, 0x08A56365,
+    0x08A56565, 0x08A56565, 0x08A56565, 0x08A56565, 0x08A56965, 0x08A56965,
+    0x08A56965, 0x08A56965, 0x08A56F65, 0x08A56F65, 0x08A56F65, 0x08A56F65,
+    0x08A57365, 0x08A57365, 0x08A57365, 0x08A57365, 0x08A57465, 0x08A57465,
+    0x08A57465, 0x08A57465, 0x08B52065, 0x08B52065, 0x08B52565, 0x08B52565,
+    0x08B52D65, 0x08B52D65, 0x08B52E65, 0x08B52E65, 0x08B52F65, 0x08B52F65,
+    0x08B53365, 0x08B53365, 0x08B53465, 0x08B53465, 0x08B53565, 0x08B53565,
+    0x08B53665, 0x08B53665, 0x08B53765, 0x08B53765, 0x08B53865, 0x08B53865,
+    0x08B53965, 0x08B53965, 0x08B53D65, 0x08B53D65, 0x08B54165, 0x08B54165,
+    0x08B55F65, 0x08B55F65, 0x08B56265, 0x08B56265, 0x08B56465, 0x08B56465,
+    0x08B56665, 0x08B56665, 0x08B56765, 0x08B56765, 0x08B56865, 0x08B56865,
+    0x08B56C65, 0x08B56C65, 0x08B56D65, 0x08B56D65, 0x08B56E65, 0x08B56E65,
+    0x08B57065, 0x08B57065, 0x08B57265, 0x08B57265, 0x08B57565, 0x08B57565,
+    0x08C53A65, 0x08C54265, 0x08C54365, 0x08C54465, 0x08C54565, 0x08C54665,
+    0x08C54765, 0x08C54865, 0x08C54965, 0x08C54A65, 0x08C54B65, 0x08C54C65,
+    0x08C54D65, 0x08C54E65, 0x08C54F65, 0x08C55065, 0x08C55165, 0x08C55265,
+    0x08C55365, 0x08C55465, 0x08C55565, 0x08C55665, 0x08C55765, 0x08C55965,
+    0x08C56A65, 0x08C56B65, 0x08C57165, 0x08C57665, 0x08C57765, 0x08C57865,
+    0x08C57965, 0x08C57A65, 0x04550065, 0x04550065, 0x04550065, 0x04550065,
+    0x08A53069, 0x08A53069, 0x08A53069, 0x08A53069, 0x08A53169, 0x08A53169,
+    0x08A53169, 0x08A53169, 0x08A53269, 0x08A53269, 0x08A53269, 0x08A53269,
+    0x08A56169, 0x08A56169, 0x08A56169, 0x08A56169, 0x08A56369, 0x08A56369,
+    0x08A56369, 0x08A56369, 0x08A56569, 0x08A56569, 0x08A56569, 0x08A56569,
+    0x08A56969, 0x08A56969, 0x08A56969, 0x08A56969, 0x08A56F69, 0x08A56F69,
+    0x08A56F69, 0x08A56F69, 0x08A57369, 0x08A57369, 0x08A57369, 0x08A57369,
+    0x08A57469, 0x08A57469, 0x08A57469, 0x08A57469, 0x08B52069, 0x08B52069,
+    0x08B52569, 0x08B52569, 0x08B52D69, 0x08B52D69, 0x08B52E69, 0x08B52E69,
+    0x08B52F69, 0x08B52F69, 0x08B53369, 0x08B53369, 0x08B53469, 0x08B53469,
+    0x08B53569, 0x08B53569, 0x08B53669, 0x08B53669, 0x08B53769, 0x08B53769,
+    0x08B53869, 0x08B53869, 0x08B53969, 0x08B53969, 0x08B53D69, 0x08B53D69,
+    0x08B54169, 0x08B54169, 0x08B55F69, 0x08B55F69, 0x08B56269, 0x08B56269,
+    0x08B56469, 0x08B56469, 0x08B56669, 0x08B56669, 0x08B56769, 0x08B56769,
+    0x08B56869, 0x08B56869, 0x08B56C69, 0x08B56C69, 0x08B56D69, 0x08B56D69,
+    0x08B56E69, 0x08B56E69, 0x08B57069, 0x08B57069, 0x08B57269, 0x08B57269,
+    0x08B57569, 0x08B57569, 0x08C53A69, 0x08C54269, 0x08C54369, 0x08C54469,
+    0x08C54569, 0x08C54669, 0x08C54769, 0x08C54869, 0x08C54969, 0x08C54A69,
+    0x08C54B69, 0x08C54C69, 0x08C54D69, 0x08C54E69, 0x08C54F69, 0x08C55069,
+    0x08C55169, 0x08C55269, 0x08C55369, 0x08C55469, 0x08C55569, 0x08C55669,
+    0x08C55769, 0x08C55969, 0x08C56A69, 0x08C56B69, 0x08C57169, 0x08C57669,
+    0x08C57769, 0x08C57869, 0x08C57969, 0x08C57A69, 0x04550069, 0x04550069,
+    0x04550069, 0x04550069, 0x08A5306F, 0x08A5306F, 0x08A5306F, 0x08A5306F,
+    0x08A5316F, 0x08A5316F, 0x08A5316F, 0x08A5316F, 0x08A5326F, 0x08A5326F,
+    0x08A5326F, 0x08A5326F, 0x08A5616F, 0x08A5616F, 0x08A5616F, 0x08A5616F,
+    0x08A5636F, 0x08A5636F, 0x08A5636F, 0x08A5636F, 0x08A5656F, 0x08A5656F,
+    0x08A5656F, 0x08A5656F, 0x08A5696F, 0x08A5696F, 0x08A5696F, 0x08A5696F,
+    0x08A56F6F, 0x08A56F6F, 0x08A56F6F, 0x08A56F6F, 0x08A5736F, 0x08A5736F,
+    0x08A5736F, 0x08A5736F, 0x08A5746F, 0x08A5746F, 0x08A5746F, 0x08A5746F,
+    0x08B5206F, 0x08B5206F, 0x08B5256F, 0x08B5256F, 0x08B52D6F, 0x08B52D6F,
+    0x08B52E6F, 0x08B52E6F, 0x08B52F6F, 0x08B52F6F, 0x08B5336F, 0x08B5336F,
+    0x08B5346F, 0x08B5346F, 0x08B5356F, 0x08B5356F, 0x08B5366F, 0x08B5366F,
+    0x08B5376F, 0x08B5376F, 0x08B5386F, 0x08B5386F, 0x08B5396F, 0x08B5396F,
+    0x08B53D6F, 0x08B53D6F, 0x08B5416F, 0x08B5416F, 0x08B55F6F, 0x08B55F6F,
+    0x08B5626F, 0x08B5626F, 0x08B5646F, 0x08B5646F, 0x08B5666F, 0x08B5666F,
+    0x08B5676F, 0x08B5676F, 0x08B5686F, 0x08B5686F, 0x08B56C6F, 0x08B56C6F,
+    0x08B56D6F, 0x08B56D6F, 0x08B56E6F, 0x08B56E6F, 0x08B5706F, 0x08B5706F,
+    0x08B5726F, 0x08B5726F, 0x08B5756F, 0x08B5756F, 0x08C53A6F, 0x08C5426F,
+    0x08C5436F, 0x08C5446F, 0x08C5456F, 0x08C5466F, 0x08C5476F, 0x08C5486F,
+    0x08C5496F, 0x08C54A6F, 0x08C54B6F, 0x08C54C6F, 0x08C54D6F, 0x08C54E6F,
+    0x08C54F6F, 0x08C5506F, 0x08C5516F, 0x08C5526F, 0x08C5536F, 0x08C5546F,
+    0x08C5556F, 0x08C5566F, 0x08C5576F, 0x08C5596F, 0x08C56A6F, 0x08C56B6F,
+    0x08C5716F, 0x08C5766F, 0x08C5776F, 0x08C5786F, 0x08C5796F, 0x08C57A6F,
+    0x0455006F, 0x0455006F, 0x0455006F, 0x0455006F, 0x08A53073, 0x08A53073,
+    0x08A53073, 0x08A53073, 0x08A53173, 0x08A53173, 0x08A53173, 0x08A53173,
+    0x08A53273, 0x08A53273, 0x08A53273, 0x08A53273, 0x08A56173, 0x08A56173,
+    0x08A56173, 0x08A56173, 0x08A56373, 0x08A56373, 0x08A56373, 0x08A56373,
+    0x08A56573, 0x08A56573, 0x08A56573, 0x08A56573, 0x08A56973, 0x08A56973,
+    0x08A56973, 0x08A56973, 0x08A56F73, 0x08A56F73, 0x08A56F73, 0x08A56F73,
+    0x08A57373, 0x08A57373, 0x08A57373, 0x08A57373, 0x08A57473, 0x08A57473,
+    0x08A57473, 0x08A57473, 0x08B52073, 0x08B52073, 0x08B52573, 0x08B52573,
+    0x08B52D73, 0x08B52D73, 0x08B52E73, 0x08B52E73, 0x08B52F73, 0x08B52F73,
+    0x08B53373, 0x08B53373, 0x08B53473, 0x08B53473, 0x08B53573, 0x08B53573,
+    0x08B53673, 0x08B53673, 0x08B53773, 0x08B53773, 0x08B53873, 0x08B53873,
+    0x08B53973, 0x08B53973, 0x08B53D73, 0x08B53D73, 0x08B54173, 0x08B54173,
+    0x08B55F73, 0x08B55F73, 0x08B56273, 0x08B56273, 0x08B56473, 0x08B56473,
+    0x08B56673, 0x08B56673, 0x08B56773, 0x08B56773, 0x08B56873, 0x08B56873,
+    0x08B56C73, 0x08B56C73, 0x08B56D73, 0x08B56D73, 0x08B56E73, 0x08B56E73,
+    0x08B57073, 0x08B57073, 0x08B57273, 0x08B57273, 0x08B57573, 0x08B57573,
+    0x08C53A73, 0x08C54273, 0x08C54373, 0x08C54473, 0x08C54573, 0x08C54673,
+    0x08C54773, 0x08C54873, 0x08C54973, 0x08C54A73, 0x08C54B73, 0x08C54C73,
+    0x08C54D73, 0x08C54E73, 0x08C54F73, 0x08C55073, 0x08C55173, 0x08C55273,
+    0x08C55373, 0x08C55473, 0x08C55573, 0x08C55673, 0x08C55773, 0x08C55973,
+    0x08C56A73, 0x08C56B73, 0x08C57173, 0x08C57673, 0x08C57773, 0x08C57873,
+    0x08C57973, 0x08C57A73, 0x04550073, 0x04550073, 0x04550073, 0x04550073,
+    0x08A53074, 0x08A53074, 0x08A53074, 0x08A53074, 0x08A53174, 0x08A53174,
+    0x08A53174, 0x08A53174, 0x08A53274, 0x08A53274, 0x08A53274, 0x08A53274,
+    0x08A56174, 0x08A56174, 0x08A56174, 0x08A56174, 0x08A56374, 0x08A56374,
+    0x08A56374, 0x08A56374, 0x08A56574, 0x08A56574, 0x08A56574, 0x08A56574,
+    0x08A56974, 0x08A56974, 0x08A56974, 0x08A56974, 0x08A56F74, 0x08A56F74,
+    0x08A56F74, 0x08A56F74, 0x08A57374, 0x08A57374, 0x08A57374, 0x08A57374,
+    0x08A57474, 0x08A57474, 0x08A57474, 0x08A57474, 0x08B52074, 0x08B52074,
+    0x08B52574, 0x08B52574, 0x08B52D74, 0x08B52D74, 0x08B52E74, 0x08B52E74,
+    0x08B52F74, 0x08B52F74, 0x08B53374, 0x08B53374, 0x08B53474, 0x08B53474,
+    0x08B53574, 0x08B53574, 0x08B53674, 0x08B53674, 0x08B53774, 0x08B53774,
+    0x08B53874, 0x08B53874, 0x08B53974, 0x08B53974, 0x08B53D74, 0x08B53D74,
+    0x08B54174, 0x08B54174, 0x08B55F74, 0x08B55F74, 0x08B56274, 0x08B56274,
+    0x08B56474, 0x08B56474, 0x08B56674, 0x08B56674, 0x08B56774, 0x08B56774,
+    0x08B56874, 0x08B56874, 0x08B56C74, 0x08B56C74, 0x08B56D74, 0x08B56D74,
+    0x08B56E74, 0x08B56E74, 0x08B57074, 0x08B57074, 0x08B57274, 0x08B57274,
+    0x08B57574, 0x08B57574, 0x08C53A74, 0x08C54274, 0x08C54374, 0x08C54474,
+    0x08C54574, 0x08C54674, 0x08C54774, 0x08C54874, 0x08C54974, 0x08C54A74,
+    0x08C54B74, 0x08C54C74, 0x08C54D74, 0x08C54E74, 0x08C54F74, 0x08C55074,
+    0x08C55174, 0x08C55274, 0x08C55374, 0x08C55474, 0x08C55574, 0x08C55674,
+    0x08C55774, 0x08C55974, 0x08C56A74, 0x08C56B74, 0x08C57174, 0x08C57674,
+    0x08C57774, 0x08C57874, 0x08C57974, 0x08C57A74, 0x04550074, 0x04550074,
+    0x04550074, 0x04550074, 0x08B63020, 0x08B63020, 0x08B63120, 0x08B63120,
+    0x08B63220, 0x08B63220, 0x08B66120, 0x08B66120, 0x08B66320, 0x08B66320,
+    0x08B66520, 0x08B66520, 0x08B66920, 0x08B66920, 0x08B66F20, 0x08B66F20,
+    0x08B67320, 0x08B67320, 0x08B67420, 0x08B67420, 0x08C62020, 0x08C62520,
+    0x08C62D20, 0x08C62E20, 0x08C62F20, 0x08C63320, 0x08C63420, 0x08C63520,
+    0x08C63620, 0x08C63720, 0x08C63820, 0x08C63920, 0x08C63D20, 0x08C64120,
+    0x08C65F20, 0x08C66220, 0x08C66420, 0x08C66620, 0x08C66720, 0x08C66820,
+    0x08C66C20, 0x08C66D20, 0x08C66E20, 0x08C67020, 0x08C67220, 0x08C67520,
+    0x04660020, 0x04660020, 0x04660020, 0x04660020, 0x04660020, 0x04660020,
+    0x04660020, 0x04660020, 0x04660020, 0x04660020, 0x04660020, 0x04660020,
+    0x04660020, 0x04660020, 0x04660020, 0x04660020, 0x04660020, 0x04660020,
+    0x08B63025, 0x08B63025, 0x08B63125, 0x08B63125, 0x08B63225, 0x08B63225,
+    0x08B66125, 0x08B66125, 0x08B66325, 0x08B66325, 0x08B66525, 0x08B66525,
+    0x08B66925, 0x08B66925, 0x08B66F25, 0x08B66F25, 0x08B67325, 0x08B67325,
+    0x08B67425, 0x08B67425, 0x08C62025, 0x08C62525, 0x08C62D25, 0x08C62E25,
+    0x08C62F25, 0x08C63325, 0x08C63425, 0x08C63525, 0x08C63625, 0x08C63725,
+    0x08C63825, 0x08C63925, 0x08C63D25, 0x08C64125, 0x08C65F25, 0x08C66225,
+    0x08C66425, 0x08C66625, 0x08C66725, 0x08C66825, 0x08C66C25, 0x08C66D25,
+    0x08C66E25, 0x08C67025, 0x08C67225, 0x08C67525, 0x04660025, 0x04660025,
+    0x04660025, 0x04660025, 0x04660025, 0x04660025, 0x04660025, 0x04660025,
+    0x04660025, 0x04660025, 0x04660025, 0x04660025, 0x04660025, 0x04660025,
+    0x04660025, 0x04660025, 0x04660025, 0x04660025, 0x08B6302D, 0x08B6302D,
+    0x08B6312D, 0x08B6312D, 0x08B6322D, 0x08B6322D, 0x08B6612D, 0x08B6612D,
+    0x08B6632D, 0x08B6632D, 0x08B6652D, 0x08B6652D, 0x08B6692D, 0x08B6692D,
+    0x08B66F2D, 0x08B66F2D, 0x08B6732D, 0x08B6732D, 0x08B6742D, 0x08B6742D,
+    0x08C6202D, 0x08C6252D, 0x08C62D2D, 0x08C62E2D, 0x08C62F2D, 0x08C6332D,
+    0x08C6342D, 0x08C6352D, 0x08C6362D, 0x08C6372D, 0x08C6382D, 0x08C6392D,
+    0x08C63D2D, 0x08C6412D, 0x08C65F2D, 0x08C6622D, 0x08C6642D, 0x08C6662D,
+    0x08C6672D, 0x08C6682D, 0x08C66C2D, 0x08C66D2D, 0x08C66E2D, 0x08C6702D,
+    0x08C6722D, 0x08C6752D, 0x0466002D, 0x0466002D, 0x0466002D, 0x0466002D,
+    0x0466002D, 0x0466002D, 0x0466002D, 0x0466002D, 0x0466002D, 0x0466002D,
+    0x0466002D, 0x0466002D, 0x0466002D, 0x0466002D, 0x0466002D, 0x0466002D,
+    0x0466002D, 0x0466002D, 0x08B6302E, 0x08B6302E, 0x08B6312E, 0x08B6312E,
+    0x08B6322E, 0x08B6322E, 0x08B6612E, 0x08B6612E, 0x08B6632E, 0x08B6632E,
+    0x08B6652E, 0x08B6652E, 0x08B6692E, 0x08B6692E, 0x08B66F2E, 0x08B66F2E,
+    0x08B6732E, 0x08B6732E, 0x08B6742E, 0x08B6742E, 0x08C6202E, 0x08C6252E,
+    0x08C62D2E, 0x08C62E2E, 0x08C62F2E, 0x08C6332E, 0x08C6342E, 0x08C6352E,
+    0x08C6362E, 0x08C6372E, 0x08C6382E, 0x08C6392E, 0x08C63D2E, 0x08C6412E,
+    0x08C65F2E, 0x08C6622E, 0x08C6642E, 0x08C6662E, 0x08C6672E, 0x08C6682E,
+    0x08C66C2E, 0x08C66D2E, 0x08C66E2E, 0x08C6702E, 0x08C6722E, 0x08C6752E,
+    0x0466002E, 0x0466002E, 0x0466002E, 0x0466002E, 0x0466002E, 0x0466002E,
+    0x0466002E, 0x0466002E, 0x0466002E, 0x0466002E, 0x0466002E, 0x0466002E,
+    0x0466002E, 0x0466002E, 0x0466002E, 0x0466002E, 0x0466002E, 0x0466002E,
+    0x08B6302F, 0x08B6302F, 0x08B6312F, 0x08B6312F, 0x08B6322F, 0x08B6322F,
+    0x08B6612F, 0x08B6612F, 0x08B6632F, 0x08B6632F, 0x08B6652F, 0x08B6652F,
+    0x08B6692F, 0x08B6692F, 0x08B66F2F, 0x08B66F2F, 0x08B6732F, 0x08B6732F,
+    0x08B6742F, 0x08B6742F, 0x08C6202F, 0x08C6252F, 0x08C62D2F, 0x08C62E2F,
+    0x08C62F2F, 0x08C6332F, 0x08C6342F, 0x08C6352F, 0x08C6362F, 0x08C6372F,
+    0x08C6382F, 0x08C6392F, 0x08C63D2F, 0x08C6412F, 0x08C65F2F, 0x08C6622F,
+    0x08C6642F, 0x08C6662F, 0x08C6672F, 0x08C6682F, 0x08C66C2F, 0x08C66D2F,
+    0x08C66E2F, 0x08C6702F, 0x08C6722F, 0x08C6752F, 0x0466002F, 0x0466002F,
+    0x0466002F, 0x0466002F, 0x0466002F, 0x0466002F, 0x0466002F, 0x0466002F,
+    0x0466002F, 0x0466002F, 0x0466002F, 0x0466002F, 0x0466002F, 0x0466002F,
+    0x0466002F, 0x0466002F, 0x0466002F, 0x0466002F, 0x08B63033, 0x08B63033,
+    0x08B63133, 0x08B63133, 0x08B63233, 0x08B63233, 0x08B66133, 0x08B66133,
+    0x08B66333, 0x08B66333, 0x08B66533, 0x08B66533, 0x08B66933, 0x08B66933,
+    0x08B66F33, 0x08B66F33, 0x08B67333, 0x08B67333, 0x08B67433, 0x08B67433,
+    0x08C62033, 0x08C62533, 0x08C62D33, 0x08C62E33, 0x08C62F33, 0x08C63333,
+    0x08C63433, 0x08C63533, 0x08C63633, 0x08C63733, 0x08C63833, 0x08C63933,
+    0x08C63D33, 0x08C64133, 0x08C65F33, 0x08C66233, 0x08C66433, 0x08C66633,
+    0x08C66733, 0x08C66833, 0x08C66C33, 0x08C66D33, 0x08C66E33, 0x08C67033,
+    0x08C67233, 0x08C67533, 0x04660033, 0x04660033, 0x04660033, 0x04660033,
+    0x04660033, 0x04660033, 0x04660033, 0x04660033, 0x04660033, 0x04660033,
+    0x04660033, 0x04660033, 0x04660033, 0x04660033, 0x04660033, 0x04660033,
+    0x04660033, 0x04660033, 0x08B63034, 0x08B63034, 0x08B63134, 0x08B63134,
+    0x08B63234, 0x08B63234, 0x08B66134, 0x08B66134, 0x08B66334, 0x08B66334,
+    0x08B66534, 0x08B66534, 0x08B66934, 0x08B66934, 0x08B66F34, 0x08B66F34,
+    0x08B67334, 0x08B67334, 0x08B67434, 0x08B67434, 0x08C62034, 0x08C62534,
+    0x08C62D34, 0x08C62E34, 0x08C62F34, 0x08C63334, 0x08C63434, 0x08C63534,
+    0x08C63634, 0x08C63734, 0x08C63834, 0x08C63934, 0x08C63D34, 0x08C64134,
+    0x08C65F34, 0x08C66234, 0x08C66434, 0x08C66634, 0x08C66734, 0x08C66834,
+    0x08C66C34, 0x08C66D34, 0x08C66E34, 0x08C67034, 0x08C67234, 0x08C67534,
+    0x04660034, 0x04660034, 0x04660034, 0x04660034, 0x04660034, 0x04660034,
+    0x04660034, 0x04660034, 0x04660034, 0x04660034, 0x04660034, 0x04660034,
+    0x04660034, 0x04660034, 0x04660034, 0x04660034, 0x04660034, 0x04660034,
+    0x08B63035, 0x08B63035, 0x08B63135, 0x08B63135, 0x08B63235, 0x08B63235,
+    0x08B66135, 0x08B66135, 0x08B66335, 0x08B66335, 0x08B66535, 0x08B66535,
+    0x08B66935, 0x08B66935, 0x08B66F35, 0x08B66F35, 0x08B67335, 0x08B67335,
+    0x08B67435, 0x08B67435, 0x08C62035, 0x08C62535, 0x08C62D35, 0x08C62E35,
+    0x08C62F35, 0x08C63335, 0x08C63435, 0x08C63535, 0x08C63635, 0x08C63735,
+    0x08C63835, 0x08C63935, 0x08C63D35, 0x08C64135, 0x08C65F35, 0x08C66235,
+    0x08C66435, 0x08C66635, 0x08C66735, 0x08C66835, 0x08C66C35, 0x08C66D35,
+    0x08C66E35, 0x08C67035, 0x08C67235, 0x08C67535, 0x04660035, 0x04660035,
+    0x04660035, 0x04660035, 0x04660035, 0x04660035, 0x04660035, 0x04660035,
+    0x04660035, 0x04660035, 0x04660035, 0x04660035, 0x04660035, 0x04660035,
+    0x04660035, 0x04660035, 0x04660035, 0x04660035, 0x08B63036, 0x08B63036,
+    0x08B63136, 0x08B63136, 0x08B63236, 0x08B63236, 0x08B66136, 0x08B66136,
+    0x08B66336, 0x08B66336, 0x08B66536, 0x08B66536, 0x08B66936, 0x08B66936,
+    0x08B66F36, 0x08B66F36, 0x08B67336, 0x08B67336, 0x08B67436, 0x08B67436,
+    0x08C62036, 0x08C62536, 0x08C62D36, 0x08C62E36, 0x08C62F36, 0x08C63336,
+    0x08C63436, 0x08C63536, 0x08C63636, 0x08C63736, 0x08C63836, 0x08C63936,
+    0x08C63D36, 0x08C64136, 0x08C65F36, 0x08C66236, 0x08C66436, 0x08C66636,
+    0x08C66736, 0x08C66836, 0x08C66C36, 0x08C66D36, 0x08C66E36, 0x08C67036,
+    0x08C67236, 0x08C67536, 0x04660036, 0x04660036, 0x04660036, 0x04660036,
+    0x04660036, 0x04660036, 0x04660036, 0x04660036, 0x04660036, 0x04660036,
+    0x04660036, 0x04660036, 0x04660036, 0x04660036, 0x04660036, 0x04660036,
+    0x04660036, 0x04660036, 0x08B63037, 0x08B63037, 0x08B63137, 0x08B63137,
+    0x08B63237, 0x08B63237, 0x08B66137, 0x08B66137, 0x08B66337, 0x08B66337,
+    0x08B66537, 0x08B66537, 0x08B66937, 0x08B66937, 0x08B66F37, 0x08B66F37,
+    0x08B67337, 0x08B67337, 0x08B67437, 0x08B67437, 0x08C62037, 0x08C62537,
+    0x08C62D37, 0x08C62E37, 0x08C62F37, 0x08C63337, 0x08C63437, 0x08C63537,
+    0x08C63637, 0x08C63737, 0x08C63837, 0x08C63937, 0x08C63D37, 0x08C64137,
+    0x08C65F37, 0x08C66237, 0x08C66437, 0x08C66637, 0x08C66737, 0x08C66837,
+    0x08C66C37, 0x08C66D37, 0x08C66E37, 0x08C67037, 0x08C67237, 0x08C67537,
+    0x04660037, 0x04660037, 0x04660037, 0x04660037, 0x04660037, 0x04660037,
+    0x04660037, 0x04660037, 0x04660037, 0x04660037, 0x04660037, 0x04660037,
+    0x04660037, 0x04660037, 0x04660037, 0x04660037, 0x04660037, 0x04660037,
+    0x08B63038, 0x08B63038, 0x08B63138, 0x08B63138, 0x08B63238, 0x08B63238,
+    0x08B66138, 0x08B66138, 0x08B66338, 0x08B66338, 0x08B66538, 0x08B66538,
+    0x08B66938, 0x08B66938, 0x08B66F38, 0x08B66F38, 0x08B67338, 0x08B67338,
+    0x08B67438, 0x08B67438, 0x08C62038, 0x08C62538, 0x08C62D38, 0x08C62E38,
+    0x08C62F38, 0x08C63338, 0x08C63438, 0x08C63538, 0x08C63638, 0x08C63738,
+    0x08C63838, 0x08C63938, 0x08C63D38, 0x08C64138, 0x08C65F38, 0x08C66238,
+    0x08C66438, 0x08C66638, 0x08C66738, 0x08C66838, 0x08C66C38, 0x08C66D38,
+    0x08C66E38, 0x08C67038, 0x08C67238, 0x08C67538, 0x04660038, 0x04660038,
+    0x04660038, 0x04660038, 0x04660038, 0x04660038, 0x04660038, 0x04660038,
+    0x04660038, 0x04660038, 0x04660038, 0x04660038, 0x04660038, 0x04660038,
+    0x04660038, 0x04660038, 0x04660038, 0x04660038, 0x08B63039, 0x08B63039,
+    0x08B63139, 0x08B63139, 0x08B63239, 0x08B63239, 0x08B66139, 0x08B66139,
+    0x08B66339, 0x08B66339, 0x08B66539, 0x08B66539, 0x08B66939, 0x08B66939,
+    0x08B66F39, 0x08B66F39, 0x08B67339, 0x08B67339, 0x08B67439, 0x08B67439,
+    0x08C62039, 0x08C62539, 0x08C62D39, 0x08C62E39, 0x08C62F39, 0x08C63339,
+    0x08C63439, 0x08C63539, 0x08C63639, 0x08C63739, 0x08C63839, 0x08C63939,
+    0x08C63D39, 0x08C64139, 0x08C65F39, 0x08C66239, 0x08C66439, 0x08C66639,
+    0x08C66739, 0x08C66839, 0x08C66C39, 0x08C66D39, 0x08C66E39, 0x08C67039,
+    0x08C67239, 0x08C67539, 0x04660039, 0x04660039, 0x04660039, 0x04660039,
+    0x04660039, 0x04660039, 0x04660039, 0x04660039, 0x04660039, 0x04660039,
+    0x04660039, 0x04660039, 0x04660039, 0x04660039, 0x04660039, 0x04660039,
+    0x04660039, 0x04660039, 0x08B6303D, 0x08B6303D, 0x08B6313D, 0x08B6313D,
+    0x08B6323D, 0x08B6323D, 0x08B6613D, 0x08B6613D, 0x08B6633D, 0x08B6633D,
+    0x08B6653D, 0x08B6653D, 0x08B6693D, 0x08B6693D, 0x08B66F3D, 0x08B66F3D,
+    0x08B6733D, 0x08B6733D, 0x08B6743D, 0x08B6743D, 0x08C6203D, 0x08C6253D,
+    0x08C62D3D, 0x08C62E3D, 0x08C62F3D, 0x08C6333D, 0x08C6343D, 0x08C6353D,
+    0x08C6363D, 0x08C6373D, 0x08C6383D, 0x08C6393D, 0x08C63D3D, 0x08C6413D,
+    0x08C65F3D, 0x08C6623D, 0x08C6643D, 0x08C6663D, 0x08C6673D, 0x08C6683D,
+    0x08C66C3D, 0x08C66D3D, 0x08C66E3D, 0x08C6703D, 0x08C6723D, 0x08C6753D,
+    0x0466003D, 0x0466003D, 0x0466003D, 0x0466003D, 0x0466003D, 0x0466003D,
+    0x0466003D, 0x0466003D, 0x0466003D, 0x0466003D, 0x0466003D, 0x0466003D,
+    0x0466003D, 0x0466003D, 0x0466003D, 0x0466003D, 0x0466003D, 0x0466003D,
+    0x08B63041, 0x08B63041, 0x08B63141, 0x08B63141, 0x08B63241, 0x08B63241,
+    0x08B66141, 0x08B66141, 0x08B66341, 0x08B66341, 0x08B66541, 0x08B66541,
+    0x08B66941, 0x08B66941, 0x08B66F41, 0x08B66F41, 0x08B67341, 0x08B67341,
+    0x08B67441, 0x08B67441, 0x08C62041, 0x08C62541, 0x08C62D41, 0x08C62E41,
+    0x08C62F41, 0x08C63341, 0x08C63441, 0x08C63541, 0x08C63641, 0x08C63741,
+    0x08C63841, 0x08C63941, 0x08C63D41, 0x08C64141, 0x08C65F41, 0x08C66241,
+    0x08C66441, 0x08C66641, 0x08C66741, 0x08C66841, 0x08C66C41, 0x08C66D41,
+    0x08C66E41, 0x08C67041, 0x08C67241, 0x08C67541, 0x04660041, 0x04660041,
+    0x04660041, 0x04660041, 0x04660041, 0x04660041, 0x04660041, 0x04660041,
+    0x04660041, 0x04660041, 0x04660041, 0x04660041, 0x04660041, 0x04660041,
+    0x04660041, 0x04660041, 0x04660041, 0x04660041, 0x08B6305F, 0x08B6305F,
+    0x08B6315F, 0x08B6315F, 0x08B6325F, 0x08B6325F, 0x08B6615F, 0x08B6615F,
+    0x08B6635F, 0x08B6635F, 0x08B6655F, 0x08B6655F, 0x08B6695F, 0x08B6695F,
+    0x08B66F5F, 0x08B66F5F, 0x08B6735F, 0x08B6735F, 0x08B6745F, 0x08B6745F,
+    0x08C6205F, 0x08C6255F, 0x08C62D5F, 0x08C62E5F, 0x08C62F5F, 0x08C6335F,
+    0x08C6345F, 0x08C6355F, 0x08C6365F, 0x08C6375F, 0x08C6385F, 0x08C6395F,
+    0x08C63D5F, 0x08C6415F, 0x08C65F5F, 0x08C6625F, 0x08C6645F, 0x08C6665F,
+    0x08C6675F, 0x08C6685F, 0x08C66C5F, 0x08C66D5F, 0x08C66E5F, 0x08C6705F,
+    0x08C6725F, 0x08C6755F, 0x0466005F, 0x0466005F, 0x0466005F, 0x0466005F,
+    0x0466005F, 0x0466005F, 0x0466005F, 0x0466005F, 0x0466005F, 0x0466005F,
+    0x0466005F, 0x0466005F, 0x0466005F, 0x0466005F, 0x0466005F, 0x0466005F,
+    0x0466005F, 0x0466005F, 0x08B63062, 0x08B63062, 0x08B63162, 0x08B63162,
+    0x08B63262, 0x08B63262, 0x08B66162, 0x08B66162, 0x08B66362, 0x08B66362,
+    0x08B66562, 0x08B66562, 0x08B66962, 0x08B66962, 0x08B66F62, 0x08B66F62,
+    0x08B67362, 0x08B67362, 0x08B67462, 0x08B67462, 0x08C62062, 0x08C62562,
+    0x08C62D62, 0x08C62E62, 0x08C62F62, 0x08C63362, 0x08C63462, 0x08C63562,
+    0x08C63662, 0x08C63762, 0x08C63862, 0x08C63962, 0x08C63D62, 0x08C64162,
+    0x08C65F62, 0x08C66262, 0x08C66462, 0x08C66662, 0x08C66762, 0x08C66862,
+    0x08C66C62, 0x08C66D62, 0x08C66E62, 0x08C67062, 0x08C67262, 0x08C67562,
+    0x04660062, 0x04660062, 0x04660062, 0x04660062, 0x04660062, 0x04660062,
+    0x04660062, 0x04660062, 0x04660062, 0x04660062, 0x04660062, 0x04660062,
+    0x04660062, 0x04660062, 0x04660062, 0x04660062, 0x04660062, 0x04660062,
+    0x08B63064, 0x08B63064, 0x08B63164, 0x08B63164, 0x08B63264, 0x08B63264,
+    0x08B66164, 0x08B66164, 0x08B66364, 0x08B66364, 0x08B66564, 0x08B66564,
+    0x08B66964, 0x08B66964, 0x08B66F64, 0x08B66F64, 0x08B67364, 0x08B67364,
+    0x08B67464, 0x08B67464, 0x08C62064, 0x08C62564, 0x08C62D64, 0x08C62E64,
+    0x08C62F64, 0x08C63364, 0x08C63464, 0x08C63564, 0x08C63664, 0x08C63764,
+    0x08C63864, 0x08C63964, 0x08C63D64, 0x08C64164, 0x08C65F64, 0x08C66264,
+    0x08C66464, 0x08C66664, 0x08C66764, 0x08C66864, 0x08C66C64, 0x08C66D64,
+    0x08C66E64, 0x08C67064, 0x08C67264, 0x08C67564, 0x04660064, 0x04660064,
+    0x04660064, 0x04660064, 0x04660064, 0x04660064, 0x04660064, 0x04660064,
+    0x04660064, 0x04660064, 0x04660064, 0x04660064, 0x04660064, 0x04660064,
+    0x04660064, 0x04660064, 0x04660064, 0x04660064, 0x08B63066, 0x08B63066,
+    0x08B63166, 0x08B63166, 0x08B63266, 0x08B63266, 0x08B66166, 0x08B66166,
+    0x08B66366, 0x08B66366, 0x08B66566, 0x08B66566, 0x08B66966, 0x08B66966,
+    0x08B66F66, 0x08B66F66, 0x08B67366, 0x08B67366, 0x08B67466, 0x08B67466,
+    0x08C62066, 0x08C62566, 0x08C62D66, 0x08C62E66, 0x08C62F66, 0x08C63366,
+    0x08C63466, 0x08C63566, 0x08C63666, 0x08C63766, 0x08C63866, 0x08C63966,
+    0x08C63D66, 0x08C64166, 0x08C65F66, 0x08C66266, 0x08C66466, 0x08C66666,
+    0x08C66766, 0x08C66866, 0x08C66C66, 0x08C66D66, 0x08C66E66, 0x08C67066,
+    0x08C67266, 0x08C67566, 0x04660066, 0x04660066, 0x04660066, 0x04660066,
+    0x04660066, 0x04660066, 0x04660066, 0x04660066, 0x04660066, 0x04660066,
+    0x04660066, 0x04660066, 0x04660066, 0x04660066, 0x04660066, 0x04660066,
+    0x04660066, 0x04660066, 0x08B63067, 0x08B63067, 0x08B63167, 0x08B63167,
+    0x08B63267, 0x08B63267, 0x08B66167, 0x08B66167, 0x08B66367, 0x08B66367,
+    0x08B66567, 0x08B66567, 0x08B66967, 0x08B66967, 0x08B66F67, 0x08B66F67,
+    0x08B67367, 0x08B67367, 0x08B67467, 0x08B67467, 0x08C62067, 0x08C62567,
+    0x08C62D67, 0x08C62E67, 0x08C62F67, 0x08C63367, 0x08C63467, 0x08C63567,
+    0x08C63667, 0x08C63767, 0x08C63867, 0x08C63967, 0x08C63D67, 0x08C64167,
+    0x08C65F67, 0x08C66267, 0x08C66467, 0x08C66667, 0x08C66767, 0x08C66867,
+    0x08C66C67, 0x08C66D67, 0x08C66E67, 0x08C67067, 0x08C67267, 0x08C67567,
+    0x04660067, 0x04660067, 0x04660067, 0x04660067, 0x04660067, 0x04660067,
+    0x04660067, 0x04660067, 0x04660067, 0x04660067, 0x04660067, 0x04660067,
+    0x04660067, 0x04660067, 0x04660067, 0x04660067, 0x04660067, 0x04660067,
+    0x08B63068, 0x08B63068, 0x08B63168, 0x08B63168, 0x08B63268, 0x08B63268,
+    0x08B66168, 0x08B66168, 0x08B66368, 0x08B66368, 0x08B66568, 0x08B66568,
+    0x08B66968, 0x08B66968, 0x08B66F68, 0x08B66F68, 0x08B67368, 0x08B67368,
+    0x08B67468, 0x08B67468, 0x08C62068, 0x08C62568, 0x08C62D68, 0x08C62E68,
+    0x08C62F68, 0x08C63368, 0x08C63468, 0x08C63568, 0x08C63668, 0x08C63768,
+    0x08C63868, 0x08C63968, 0x08C63D68, 0x08C64168, 0x08C65F68, 0x08C66268,
+    0x08C66468, 0x08C66668, 0x08C66768, 0x08C66868, 0x08C66C68, 0x08C66D68,
+    0x08C66E68, 0x08C67068, 0x08C67268, 0x08C67568, 0x04660068, 0x04660068,
+    0x04660068, 0x04660068, 0x04660068, 0x04660068, 0x04660068, 0x04660068,
+    0x04660068, 0x04660068, 0x04660068, 0x04660068, 0x04660068, 0x04660068,
+    0x04660068, 0x04660068, 0x04660068, 0x04660068, 0x08B6306C, 0x08B6306C,
+    0x08B6316C, 0x08B6316C, 0x08B6326C, 0x08B6326C, 0x08B6616C, 0x08B6616C,
+    0x08B6636C, 0x08B6636C, 0x08B6656C, 0x08B6656C, 0x08B6696C, 0x08B6696C,
+    0x08B66F6C, 0x08B66F6C, 0x08B6736C, 0x08B6736C, 0x08B6746C, 0x08B6746C,
+    0x08C6206C, 0x08C6256C, 0x08C62D6C, 0x08C62E6C, 0x08C62F6C, 0x08C6336C,
+    0x08C6346C, 0x08C6356C, 0x08C6366C, 0x08C6376C, 0x08C6386C, 0x08C6396C,
+    0x08C63D6C, 0x08C6416C, 0x08C65F6C, 0x08C6626C, 0x08C6646C, 0x08C6666C,
+    0x08C6676C, 0x08C6686C, 0x08C66C6C, 0x08C66D6C, 0x08C66E6C, 0x08C6706C,
+    0x08C6726C, 0x08C6756C, 0x0466006C, 0x0466006C, 0x0466006C, 0x0466006C,
+    0x0466006C, 0x0466006C, 0x0466006C, 0x0466006C, 0x0466006C, 0x0466006C,
+    0x0466006C, 0x0466006C, 0x0466006C, 0x0466006C, 0x0466006C, 0x0466006C,
+    0x0466006C, 0x0466006C, 0x08B6306D, 0x08B6306D, 0x08B6316D, 0x08B6316D,
+    0x08B6326D, 0x08B6326D, 0x08B6616D, 0x08B6616D, 0x08B6636D, 0x08B6636D,
+    0x08B6656D, 0x08B6656D, 0x08B6696D, 0x08B6696D, 0x08B66F6D, 0x08B66F6D,
+    0x08B6736D, 0x08B6736D, 0x08B6746D, 0x08B6746D, 0x08C6206D, 0x08C6256D,
+    0x08C62D6D, 0x08C62E6D, 0x08C62F6D, 0x08C6336D, 0x08C6346D, 0x08C6356D,
+    0x08C6366D, 0x08C6376D, 0x08C6386D, 0x08C6396D, 0x08C63D6D, 0x08C6416D,
+    0x08C65F6D, 0x08C6626D, 0x08C6646D, 0x08C6666D, 0x08C6676D, 0x08C6686D,
+    0x08C66C6D, 0x08C66D6D, 0x08C66E6D, 0x08C6706D, 0x08C6726D, 0x08C6756D,
+    0x0466006D, 0x0466006D, 0x0466006D, 0x0466006D, 0x0466006D, 0x0466006D,
+    0x0466006D, 0x0466006D, 0x0466006D, 0x0466006D, 0x0466006D, 0x0466006D,
+    0x0466006D, 0x0466006D, 0x0466006D, 0x0466006D, 0x0466006D, 0x0466006D,
+    0x08B6306E, 0x08B6306E, 0x08B6316E, 0x08B6316E, 0x08B6326E, 0x08B6326E,
+    0x08B6616E, 0x08B6616E, 0x08B6636E, 0x08B6636E, 0x08B6656E, 0x08B6656E,
+    0x08B6696E, 0x08B6696E, 0x08B66F6E, 0x08B66F6E, 0x08B6736E, 0x08B6736E,
+    0x08B6746E, 0x08B6746E, 0x08C6206E, 0x08C6256E, 0x08C62D6E, 0x08C62E6E,
+    0x08C62F6E, 0x08C6336E, 0x08C6346E, 0x08C6356E, 0x08C6366E, 0x08C6376E,
+    0x08C6386E, 0x08C6396E, 0x08C63D6E, 0x08C6416E, 0x08C65F6E, 0x08C6626E,
+    0x08C6646E, 0x08C6666E, 0x08C6676E, 0x08C6686E, 0x08C66C6E, 0x08C66D6E,
+    0x08C66E6E, 0x08C6706E, 0x08C6726E, 0x08C6756E, 0x0466006E, 0x0466006E,
+    0x0466006E, 0x0466006E, 0x0466006E, 0x0466006E, 0x0466006E, 0x0466006E,
+    0x0466006E, 0x0466006E, 0x0466006E, 0x0466006E, 0x0466006E, 0x0466006E,
+    0x0466006E, 0x0466006E, 0x0466006E, 0x0466006E, 0x08B63070, 0x08B63070,
+    0x08B63170, 0x08B63170, 0x08B63270, 0x08B63270, 0x08B66170, 0x08B66170,
+    0x08B66370, 0x08B66370, 0x08B66570, 0x08B66570, 0x08B66970, 0x08B66970,
+    0x08B66F70, 0x08B66F70, 0x08B67370, 0x08B67370, 0x08B67470, 0x08B67470,
+    0x08C62070, 0x08C62570, 0x08C62D70, 0x08C62E70, 0x08C62F70, 0x08C63370,
+    0x08C63470, 0x08C63570, 0x08C63670, 0x08C63770, 0x08C63870, 0x08C63970,
+    0x08C63D70, 0x08C64170, 0x08C65F70, 0x08C66270, 0x08C66470, 0x08C66670,
+    0x08C66770, 0x08C66870, 0x08C66C70, 0x08C66D70, 0x08C66E70, 0x08C67070,
+    0x08C67270, 0x08C67570, 0x04660070, 0x04660070, 0x04660070, 0x04660070,
+    0x04660070, 0x04660070, 0x04660070, 0x04660070, 0x04660070, 0x04660070,
+    0x04660070, 0x04660070, 0x04660070, 0x04660070, 0x04660070, 0x04660070,
+    0x04660070, 0x04660070, 0x08B63072, 0x08B63072, 0x08B63172, 0x08B63172,
+    0x08B63272, 0x08B63272, 0x08B66172, 0x08B66172, 0x08B66372, 0x08B66372,
+    0x08B66572, 0x08B66572, 0x08B66972, 0x08B66972, 0x08B66F72, 0x08B66F72,
+    0x08B67372, 0x08B67372, 0x08B67472, 0x08B67472, 0x08C62072, 0x08C62572,
+    0x08C62D72, 0x08C62E72, 0x08C62F72, 0x08C63372, 0x08C63472, 0x08C63572,
+    0x08C63672, 0x08C63772, 0x08C63872, 0x08C63972, 0x08C63D72, 0x08C64172,
+    0x08C65F72, 0x08C66272, 0x08C66472, 0x08C66672, 0x08C66772, 0x08C66872,
+    0x08C66C72, 0x08C66D72, 0x08C66E72, 0x08C67072, 0x08C67272, 0x08C67572,
+    0x04660072, 0x04660072, 0x04660072, 0x04660072, 0x04660072, 0x04660072,
+    0x04660072, 0x04660072, 0x04660072, 0x04660072, 0x04660072, 0x04660072,
+    0x04660072, 0x04660072, 0x04660072, 0x04660072, 0x04660072, 0x04660072,
+    0x08B63075, 0x08B63075, 0x08B63175, 0x08B63175, 0x08B63275, 0x08B63275,
+    0x08B66175, 0x08B66175, 0x08B66375, 0x08B66375, 0x08B66575, 0x08B66575,
+    0x08B66975, 0x08B66975, 0x08B66F75, 0x08B66F75, 0x08B67375, 0x08B67375,
+    0x08B67475, 0x08B67475, 0x08C62075, 0x08C62575, 0x08C62D75, 0x08C62E75,
+    0x08C62F75, 0x08C63375, 0x08C63475, 0x08C63575, 0x08C63675, 0x08C63775,
+    0x08C63875, 0x08C63975, 0x08C63D75, 0x08C64175, 0x08C65F75, 0x08C66275,
+    0x08C66475, 0x08C66675, 0x08C66775, 0x08C66875, 0x08C66C75, 0x08C66D75,
+    0x08C66E75, 0x08C67075, 0x08C67275, 0x08C67575, 0x04660075, 0x04660075,
+    0x04660075, 0x04660075, 0x04660075, 0x04660075, 0x04660075, 0x04660075,
+    0x04660075, 0x04660075, 0x04660075, 0x04660075, 0x04660075, 0x04660075,
+    0x04660075, 0x04660075, 0x04660075, 0x04660075, 0x08C7303A, 0x08C7313A,
+    0x08C7323A, 0x08C7613A, 0x08C7633A, 0x08C7653A, 0x08C7693A, 0x08C76F3A,
+    0x08C7733A, 0x08C7743A, 0x0477003A, 0x0477003A, 0x0477003A, 0x0477003A,
+    0x0477003A, 0x0477003A, 0x0477003A, 0x0477003A, 0x0477003A, 0x0477003A,
+    0x0477003A, 0x0477003A, 0x0477003A, 0x0477003A, 0x0477003A, 0x0477003A,
+    0x0477003A, 0x0477003A, 0x0477003A, 0x0477003A, 0x0477003A, 0x0477003A,
+    0x08C73042, 0x08C73142, 0x08C73242, 0x08C76142, 0x08C76342, 0x08C76542,
+    0x08C76942, 0x08C76F42, 0x08C77342, 0x08C77442, 0x04770042, 0x04770042,
+    0x04770042, 0x04770042, 0x04770042, 0x04770042, 0x04770042, 0x04770042,
+    0x04770042, 0x04770042, 0x04770042, 0x04770042, 0x04770042, 0x04770042,
+    0x04770042, 0x04770042, 0x04770042, 0x04770042, 0x04770042, 0x04770042,
+    0x04770042, 0x04770042, 0x08C73043, 0x08C73143, 0x08C73243, 0x08C76143,
+    0x08C76343, 0x08C76543, 0x08C76943, 0x08C76F43, 0x08C77343, 0x08C77443,
+    0x04770043, 0x04770043, 0x04770043, 0x04770043, 0x04770043, 0x04770043,
+    0x04770043, 0x04770043, 0x04770043, 0x04770043, 0x04770043, 0x04770043,
+    0x04770043, 0x04770043, 0x04770043, 0x04770043, 0x04770043, 0x04770043,
+    0x04770043, 0x04770043, 0x04770043, 0x04770043, 0x08C73044, 0x08C73144,
+    0x08C73244, 0x08C76144, 0x08C76344, 0x08C76544, 0x08C76944, 0x08C76F44,
+    0x08C77344, 0x08C77444, 0x04770044, 0x04770044, 0x04770044, 0x04770044,
+    0x04770044, 0x04770044, 0x04770044, 0x04770044, 0x04770044, 0x04770044,
+    0x04770044, 0x04770044, 0x04770044, 0x04770044, 0x04770044, 0x04770044,
+    0x04770044, 0x04770044, 0x04770044, 0x04770044, 0x04770044, 0x04770044,
+    0x08C73045, 0x08C73145, 0x08C73245, 0x08C76145, 0x08C76345, 0x08C76545,
+    0x08C76945, 0x08C76F45, 0x08C77345, 0x08C77445, 0x04770045, 0x04770045,
+    0x04770045, 0x04770045, 0x04770045, 0x04770045, 0x04770045, 0x04770045,
+    0x04770045, 0x04770045, 0x04770045, 0x04770045, 0x04770045, 0x04770045,
+    0x04770045, 0x04770045, 0x04770045, 0x04770045, 0x04770045, 0x04770045,
+    0x04770045, 0x04770045, 0x08C73046, 0x08C73146, 0x08C73246, 0x08C76146,
+    0x08C76346, 0x08C76546, 0x08C76946, 0x08C76F46, 0x08C77346, 0x08C77446,
+    0x04770046, 0x04770046, 0x04770046, 0x04770046, 0x04770046, 0x04770046,
+    0x04770046, 0x04770046, 0x04770046, 0x04770046, 0x04770046, 0x04770046,
+    0x04770046, 0x04770046, 0x04770046, 0x04770046, 0x04770046, 0x04770046,
+    0x04770046, 0x04770046, 0x04770046, 0x04770046, 0x08C73047, 0x08C73147,
+    0x08C73247, 0x08C76147, 0x08C76347, 0x08C76547, 0x08C76947, 0x08C76F47,
+    0x08C77347, 0x08C77447, 0x04770047, 0x04770047, 0x04770047, 0x04770047,
+    0x04770047, 0x04770047, 0x04770047, 0x04770047, 0x04770047, 0x04770047,
+    0x04770047, 0x04770047, 0x04770047, 0x04770047, 0x04770047, 0x04770047,
+    0x04770047, 0x04770047, 0x04770047, 0x04770047, 0x04770047, 0x04770047,
+    0x08C73048, 0x08C73148, 0x08C73248, 0x08C76148, 0x08C76348, 0x08C76548,
+    0x08C76948, 0x08C76F48, 0x08C77348, 0x08C77448, 0x04770048, 0x04770048,
+    0x04770048, 0x04770048, 0x04770048, 0x04770048, 0x04770048, 0x04770048,
+    0x04770048, 0x04770048, 0x04770048, 0x04770048, 0x04770048, 0x04770048,
+    0x04770048, 0x04770048, 0x04770048, 0x04770048, 0x04770048, 0x04770048,
+    0x04770048, 0x04770048, 0x08C73049, 0x08C73149, 0x08C73249, 0x08C76149,
+    0x08C76349, 0x08C76549, 0x08C76949, 0x08C76F49, 0x08C77349, 0x08C77449,
+    0x04770049, 0x04770049, 0x04770049, 0x04770049, 0x04770049, 0x04770049,
+    0x04770049, 0x04770049, 0x04770049, 0x04770049, 0x04770049, 0x04770049,
+    0x04770049, 0x04770049, 0x04770049, 0x04770049, 0x04770049, 0x04770049,
+    0x04770049, 0x04770049, 0x04770049, 0x04770049, 0x08C7304A, 0x08C7314A,
+    0x08C7324A, 0x08C7614A, 0x08C7634A, 0x08C7654A, 0x08C7694A, 0x08C76F4A,
+    0x08C7734A, 0x08C7744A, 0x0477004A, 0x0477004A, 0x0477004A, 0x0477004A,
+    0x0477004A, 0x0477004A, 0x0477004A, 0x0477004A, 0x0477004A, 0x0477004A,
+    0x0477004A, 0x0477004A, 0x0477004A, 0x0477004A, 0x0477004A, 0x0477004A,
+    0x0477004A, 0x0477004A, 0x0477004A, 0x0477004A, 0x0477004A, 0x0477004A,
+    0x08C7304B, 0x08C7314B, 0x08C7324B, 0x08C7614B, 0x08C7634B, 0x08C7654B,
+    0x08C7694B, 0x08C76F4B, 0x08C7734B, 0x08C7744B, 0x0477004B, 0x0477004B,
+    0x0477004B, 0x0477004B, 0x0477004B, 0x0477004B, 0x0477004B, 0x0477004B,
+    0x0477004B, 0x0477004B, 0x0477004B, 0x0477004B, 0x0477004B, 0x0477004B,
+    0x0477004B, 0x0477004B, 0x0477004B, 0x0477004B, 0x0477004B, 0x0477004B,
+    0x0477004B, 0x0477004B, 0x08C7304C, 0x08C7314C, 0x08C7324C, 0x08C7614C,
+    0x08C7634C, 0x08C7654C, 0x08C7694C, 0x08C76F4C, 0x08C7734C, 0x08C7744C,
+    0x0477004C, 0x0477004C, 0x0477004C, 0x0477004C, 0x0477004C, 0x0477004C,
+    0x0477004C, 0x0477004C, 0x0477004C, 0x0477004C, 0x0477004C, 0x0477004C,
+    0x0477004C, 0x0477004C, 0x0477004C, 0x0477004C, 0x0477004C, 0x0477004C,
+    0x0477004C, 0x0477004C, 0x0477004C, 0x0477004C, 0x08C7304D, 0x08C7314D,
+    0x08C7324D, 0x08C7614D, 0x08C7634D, 0x08C7654D, 0x08C7694D, 0x08C76F4D,
+    0x08C7734D, 0x08C7744D, 0x0477004D, 0x0477004D, 0x0477004D, 0x0477004D,
+    0x0477004D, 0x0477004D, 0x0477004D, 0x0477004D, 0x0477004D, 0x0477004D,
+    0x0477004D, 0x0477004D, 0x0477004D, 0x0477004D, 0x0477004D, 0x0477004D,
+    0x0477004D, 0x0477004D, 0x0477004D, 0x0477004D, 0x0477004D, 0x0477004D,
+    0x08C7304E, 0x08C7314E, 0x08C7324E, 0x08C7614E, 0x08C7634E, 0x08C7654E,
+    0x08C7694E, 0x08C76F4E, 0x08C7734E, 0x08C7744E, 0x0477004E, 0x0477004E,
+    0x0477004E, 0x0477004E, 0x0477004E, 0x0477004E, 0x0477004E, 0x0477004E,
+    0x0477004E, 0x0477004E, 0x0477004E, 0x0477004E, 0x0477004E, 0x0477004E,
+    0x0477004E, 0x0477004E, 0x0477004E, 0x0477004E, 0x0477004E, 0x0477004E,
+    0x0477004E, 0x0477004E, 0x08C7304F, 0x08C7314F, 0x08C7324F, 0x08C7614F,
+    0x08C7634F, 0x08C7654F, 0x08C7694F, 0x08C76F4F, 0x08C7734F, 0x08C7744F,
+    0x0477004F, 0x0477004F, 0x0477004F, 0x0477004F, 0x0477004F, 0x0477004F,
+    0x0477004F, 0x0477004F, 0x0477004F, 0x0477004F, 0x0477004F, 0x0477004F,
+    0x0477004F, 0x0477004F, 0x0477004F, 0x0477004F, 0x0477004F, 0x0477004F,
+    0x0477004F, 0x0477004F, 0x0477004F, 0x0477004F, 0x08C73050, 0x08C73150,
+    0x08C73250, 0x08C76150, 0x08C76350, 0x08C76550, 0x08C76950, 0x08C76F50,
+    0x08C77350, 0x08C77450, 0x04770050, 0x04770050, 0x04770050, 0x04770050,
+    0x04770050, 0x04770050, 0x04770050, 0x04770050, 0x04770050, 0x04770050,
+    0x04770050, 0x04770050, 0x04770050, 0x04770050, 0x04770050, 0x04770050,
+    0x04770050, 0x04770050, 0x04770050, 0x04770050, 0x04770050, 0x04770050,
+    0x08C73051, 0x08C73151, 0x08C73251, 0x08C76151, 0x08C76351, 0x08C76551,
+    0x08C76951, 0x08C76F51, 0x08C77351, 0x08C77451, 0x04770051, 0x04770051,
+    0x04770051, 0x04770051, 0x04770051, 0x04770051, 0x04770051, 0x04770051,
+    0x04770051, 0x04770051, 0x04770051, 0x04770051, 0x04770051, 0x04770051,
+    0x04770051, 0x04770051, 0x04770051, 0x04770051, 0x04770051, 0x04770051,
+    0x04770051, 0x04770051, 0x08C73052, 0x08C73152, 0x08C73252, 0x08C76152,
+    0x08C76352, 0x08C76552, 0x08C76952, 0x08C76F52, 0x08C77352, 0x08C77452,
+    0x04770052, 0x04770052, 0x04770052, 0x04770052, 0x04770052, 0x04770052,
+    0x04770052, 0x04770052, 0x04770052, 0x04770052, 0x04770052, 0x04770052,
+    0x04770052, 0x04770052, 0x04770052, 0x04770052, 0x04770052, 0x04770052,
+    0x04770052, 0x04770052, 0x04770052, 0x04770052, 0x08C73053, 0x08C73153,
+    0x08C73253, 0x08C76153, 0x08C76353, 0x08C76553, 0x08C76953, 0x08C76F53,
+    0x08C77353, 0x08C77453, 0x04770053, 0x04770053, 0x04770053, 0x04770053,
+    0x04770053, 0x04770053, 0x04770053, 0x04770053, 0x04770053, 0x04770053,
+    0x04770053, 0x04770053, 0x04770053, 0x04770053, 0x04770053, 0x04770053,
+    0x04770053, 0x04770053, 0x04770053, 0x04770053, 0x04770053, 0x04770053,
+    0x08C73054, 0x08C73154, 0x08C73254, 0x08C76154, 0x08C76354, 0x08C76554,
+    0x08C76954, 0x08C76F54, 0x08C77354, 0x08C77454, 0x04770054, 0x04770054,
+    0x04770054, 0x04770054, 0x04770054, 0x04770054, 0x04770054, 0x04770054,
+    0x04770054, 0x04770054, 0x04770054, 0x04770054, 0x04770054, 0x04770054,
+    0x04770054, 0x04770054, 0x04770054, 0x04770054, 0x04770054, 0x04770054,
+    0x04770054, 0x04770054, 0x08C73055, 0x08C73155, 0x08C73255, 0x08C76155,
+    0x08C76355, 0x08C76555, 0x08C76955, 0x08C76F55, 0x08C77355, 0x08C77455,
+    0x04770055, 0x04770055, 0x04770055, 0x04770055, 0x04770055, 0x04770055,
+    0x04770055, 0x04770055, 0x04770055, 0x04770055, 0x04770055, 0x04770055,
+    0x04770055, 0x04770055, 0x04770055, 0x04770055, 0x04770055, 0x04770055,
+    0x04770055, 0x04770055, 0x04770055, 0x04770055, 0x08C73056, 0x08C73156,
+    0x08C73256, 0x08C76156, 0x08C76356, 0x08C76556, 0x08C76956, 0x08C76F56,
+    0x08C77356, 0x08C77456, 0x04770056, 0x04770056, 0x04770056, 0x04770056,
+    0x04770056, 0x04770056, 0x04770056, 0x04770056, 0x04770056, 0x04770056,
+    0x04770056, 0x04770056, 0x04770056, 0x04770056, 0x04770056, 0x04770056,
+    0x04770056, 0x04770056, 0x04770056, 0x04770056, 0x04770056, 0x04770056,
+    0x08C73057, 0x08C73157, 0x08C73257, 0x08C76157, 0x08C76357, 0x08C76557,
+    0x08C76957, 0x08C76F57, 0x08C77357, 0x08C77457, 0x04770057, 0x04770057,
+    0x04770057, 0x04770057, 0x04770057, 0x04770057, 0x04770057, 0x04770057,
+    0x04770057, 0x04770057, 0x04770057, 0x04770057, 0x04770057, 0x04770057,
+    0x04770057, 0x04770057, 0x04770057, 0x04770057, 0x04770057, 0x04770057,
+    0x04770057, 0x04770057, 0x08C73059, 0x08C73159, 0x08C73259, 0x08C76159,
+    0x08C76359, 0x08C76559, 0x08C76959, 0x08C76F59, 0x08C77359, 0x08C77459,
+    0x04770059, 0x04770059, 0x04770059, 0x04770059, 0x04770059, 0x04770059,
+    0x04770059, 0x04770059, 0x04770059, 0x04770059, 0x04770059, 0x04770059,
+    0x04770059, 0x04770059, 0x04770059, 0x04770059, 0x04770059, 0x04770059,
+    0x04770059, 0x04770059, 0x04770059, 0x04770059, 0x08C7306A, 0x08C7316A,
+    0x08C7326A, 0x08C7616A, 0x08C7636A, 0x08C7656A, 0x08C7696A, 0x08C76F6A,
+    0x08C7736A, 0x08C7746A, 0x0477006A, 0x0477006A, 0x0477006A, 0x0477006A,
+    0x0477006A, 0x0477006A, 0x0477006A, 0x0477006A, 0x0477006A, 0x0477006A,
+    0x0477006A, 0x0477006A, 0x0477006A, 0x0477006A, 0x0477006A, 0x0477006A,
+    0x0477006A, 0x0477006A, 0x0477006A, 0x0477006A, 0x0477006A, 0x0477006A,
+    0x08C7306B, 0x08C7316B, 0x08C7326B, 0x08C7616B, 0x08C7636B, 0x08C7656B,
+    0x08C7696B, 0x08C76F6B, 0x08C7736B, 0x08C7746B, 0x0477006B, 0x0477006B,
+    0x0477006B, 0x0477006B, 0x0477006B, 0x0477006B, 0x0477006B, 0x0477006B,
+    0x0477006B, 0x0477006B, 0x0477006B, 0x0477006B, 0x0477006B, 0x0477006B,
+    0x0477006B, 0x0477006B, 0x0477006B, 0x0477006B, 0x0477006B, 0x0477006B,
+    0x0477006B, 0x0477006B, 0x08C73071, 0x08C73171, 0x08C73271, 0x08C76171,
+    0x08C76371, 0x08C76571, 0x08C76971, 0x08C76F71, 0x08C77371, 0x08C77471,
+    0x04770071, 0x04770071, 0x04770071, 0x04770071, 0x04770071, 0x04770071,
+    0x04770071, 0x04770071, 0x04770071, 0x04770071, 0x04770071, 0x04770071,
+    0x04770071, 0x04770071, 0x04770071, 0x04770071, 0x04770071, 0x04770071,
+    0x04770071, 0x04770071, 0x04770071, 0x04770071, 0x08C73076, 0x08C73176,
+    0x08C73276, 0x08C76176, 0x08C76376, 0x08C76576, 0x08C76976, 0x08C76F76,
+    0x08C77376, 0x08C77476, 0x04770076, 0x04770076, 0x04770076, 0x04770076,
+    0x04770076, 0x04770076, 0x04770076, 0x04770076, 0x04770076, 0x04770076,
+    0x04770076, 0x04770076, 0x04770076, 0x04770076, 0x04770076, 0x04770076,
+    0x04770076, 0x04770076, 0x04770076, 0x04770076, 0x04770076, 0x04770076,
+    0x08C73077, 0x08C73177, 0x08C73277, 0x08C76177, 0x08C76377, 0x08C76577,
+    0x08C76977, 0x08C76F77, 0x08C77377, 0x08C77477, 0x04770077, 0x04770077,
+    0x04770077, 0x04770077, 0x04770077, 0x04770077, 0x04770077, 0x04770077,
+    0x04770077, 0x04770077, 0x04770077, 0x04770077, 0x04770077, 0x04770077,
+    0x04770077, 0x04770077, 0x04770077, 0x04770077, 0x04770077, 0x04770077,
+    0x04770077, 0x04770077, 0x08C73078, 0x08C73178, 0x08C73278, 0x08C76178,
+    0x08C76378, 0x08C76578, 0x08C76978, 0x08C76F78, 0x08C77378, 0x08C77478,
+    0x04770078, 0x04770078, 0x04770078, 0x04770078, 0x04770078, 0x04770078,
+    0x04770078, 0x04770078, 0x04770078, 0x04770078, 0x04770078, 0x04770078,
+    0x04770078, 0x04770078, 0x04770078, 0x04770078, 0x04770078, 0x04770078,
+    0x04770078, 0x04770078, 0x04770078, 0x04770078, 0x08C73079, 0x08C73179,
+    0x08C73279, 0x08C76179, 0x08C76379, 0x08C76579, 0x08C76979, 0x08C76F79,
+    0x08C77379, 0x08C77479, 0x04770079, 0x04770079, 0x04770079, 0x04770079,
+    0x04770079, 0x04770079, 0x04770079, 0x04770079, 0x04770079, 0x04770079,
+    0x04770079, 0x04770079, 0x04770079, 0x04770079, 0x04770079, 0x04770079,
+    0x04770079, 0x04770079, 0x04770079, 0x04770079, 0x04770079, 0x04770079,
+    0x08C7307A, 0x08C7317A, 0x08C7327A, 0x08C7617A, 0x08C7637A, 0x08C7657A,
+    0x08C7697A, 0x08C76F7A, 0x08C7737A, 0x08C7747A, 0x0477007A, 0x0477007A,
+    0x0477007A, 0x0477007A, 0x0477007A, 0x0477007A, 0x0477007A, 0x0477007A,
+    0x0477007A, 0x0477007A, 0x0477007A, 0x0477007A, 0x0477007A, 0x0477007A,
+    0x0477007A, 0x0477007A, 0x0477007A, 0x0477007A, 0x0477007A, 0x0477007A,
+    0x0477007A, 0x0477007A, 0x04880026, 0x04880026, 0x04880026, 0x04880026,
+    0x04880026, 0x04880026, 0x04880026, 0x04880026, 0x04880026, 0x04880026,
+    0x04880026, 0x04880026, 0x04880026, 0x04880026, 0x04880026, 0x04880026,
+    0x0488002A, 0x0488002A, 0x0488002A, 0x0488002A, 0x0488002A, 0x0488002A,
+    0x0488002A, 0x0488002A, 0x0488002A, 0x0488002A, 0x0488002A, 0x0488002A,
+    0x0488002A, 0x0488002A, 0x0488002A, 0x0488002A, 0x0488002C, 0x0488002C,
+    0x0488002C, 0x0488002C, 0x0488002C, 0x0488002C, 0x0488002C, 0x0488002C,
+    0x0488002C, 0x0488002C, 0x0488002C, 0x0488002C, 0x0488002C, 0x0488002C,
+    0x0488002C, 0x0488002C, 0x0488003B, 0x0488003B, 0x0488003B, 0x0488003B,
+    0x0488003B, 0x0488003B, 0x0488003B, 0x0488003B, 0x0488003B, 0x0488003B,
+    0x0488003B, 0x0488003B, 0x0488003B, 0x0488003B, 0x0488003B, 0x0488003B,
+    0x04880058, 0x04880058, 0x04880058, 0x04880058, 0x04880058, 0x04880058,
+    0x04880058, 0x04880058, 0x04880058, 0x04880058, 0x04880058, 0x04880058,
+    0x04880058, 0x04880058, 0x04880058, 0x04880058, 0x0488005A, 0x0488005A,
+    0x0488005A, 0x0488005A, 0x0488005A, 0x0488005A, 0x0488005A, 0x0488005A,
+    0x0488005A, 0x0488005A, 0x0488005A, 0x0488005A, 0x0488005A, 0x0488005A,
+    0x0488005A, 0x0488005A, 0x04AA0021, 0x04AA0021, 0x04AA0021, 0x04AA0021,
+    0x04AA0022, 0x04AA0022, 0x04AA0022, 0x04AA0022, 0x04AA0028, 0x04AA0028,
+    0x04AA0028, 0x04AA0028, 0x04AA0029, 0x04AA0029, 0x04AA0029, 0x04AA0029,
+    0x04AA003F, 0x04AA003F, 0x04AA003F, 0x04AA003F, 0x04BB0027, 0x04BB0027,
+    0x04BB002B, 0x04BB002B, 0x04BB007C, 0x04BB007C, 0x04CC0023, 0x04CC003E,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000,
+};
+
+/**
+ * Codes of 13 to 30 bits by length, left-aligned to 32 bits: the first
+ * code, the last code with the bits below its length set, the length and
+ * the index of the first symbol in HUFF_LONG_SYM. EOS is the last 30-bit
+ * code.
+ */
+static const struct {
+    uint32_t first;
+    uint32_t last;
+    uint8_t len;
+    uint8_t base;
+} HUFF_LONG[] = {
+    {0xFFC00000u, 0xFFEFFFFFu, 13, 0},
+    {0xFFF00000u, 0xFFF7FFFFu, 14, 6},
+    {0xFFF80000u, 0xFFFDFFFFu, 15, 8},
+    {0xFFFE0000u, 0xFFFE5FFFu, 19, 11},
+    {0xFFFE6000u, 0xFFFEDFFFu, 20, 14},
+    {0xFFFEE000u, 0xFFFF47FFu, 21, 22},
+    {0xFFFF4800u, 0xFFFFAFFFu, 22, 35},
+    {0xFFFFB000u, 0xFFFFE9FFu, 23, 61},
+    {0xFFFFEA00u, 0xFFFFF5FFu, 24, 90},
+    {0xFFFFF600u, 0xFFFFF7FFu, 25, 102},
+    {0xFFFFF800u, 0xFFFFFBBFu, 26, 106},
+    {0xFFFFFBC0u, 0xFFFFFE1Fu, 27, 121},
+    {0xFFFFFE20u, 0xFFFFFFEFu, 28, 140},
+    {0xFFFFFFF0u, 0xFFFFFFFFu, 30, 169},
+};
+
+/** Symbols of codes of 13 to 30 bits in code order, without EOS */
+static const uint8_t HUFF_LONG_SYM[] = {
+    0, 36, 64, 91, 93, 126, 94, 125, 60, 96, 123, 92,
+    195, 208, 128, 130, 131, 162, 184, 194, 224, 226, 153, 161,
+    167, 172, 176, 177, 179, 209, 216, 217, 227, 229, 230, 129,
+    132, 133, 134, 136, 146, 154, 156, 160, 163, 164, 169, 170,
+    173, 178, 181, 185, 186, 187, 189, 190, 196, 198, 228, 232,
+    233, 1, 135, 137, 138, 139, 140, 141, 143, 147, 149, 150,
+    151, 152, 155, 157, 158, 165, 166, 168, 174, 175, 180, 182,
+    183, 188, 191, 197, 231, 239, 9, 142, 144, 145, 148, 159,
+    171, 206, 215, 225, 236, 237, 199, 207, 234, 235, 192, 193,
+    200, 201, 202, 205, 210, 213, 218, 219, 238, 240, 242, 243,
+    255, 203, 204, 211, 212, 214, 221, 222, 223, 241, 244, 245,
+    246, 247, 248, 250, 251, 252, 253, 254, 2, 3, 4, 5,
+    6, 7, 8, 11, 12, 14, 15, 16, 17, 18, 19, 20,
+    21, 23, 24, 25, 26, 27, 28, 29, 30, 31, 127, 220,
+    249, 10, 13, 22,
+};
+
+// EOS left-aligned to 32 bits; no other code is greater or equal
+#define HUFF_EOS 0xFFFFFFFCu
+
+/**
+ * @brief Decode an integer with an N-bit prefix (RFC 7541 5.1)
+ *
+ * @return HWIRE_OK on success
+ * @return HWIRE_EILSEQ if truncated or greater than UINT32_MAX
+ */
+static int hpack_int(const unsigned char *str, size_t len, size_t *cur,
+                     unsigned int prefix, uint32_t *v)
+{
+    const uint32_t max = (1u << prefix) - 1;
+    size_t i           = *cur;
+    uint64_t n         = str[i++] & max;
+
+    if (n == max) {
+        unsigned int shift = 0;
+        unsigned char c;
+        do {
+            // five continuation bytes hold more than 32 bits
+            if (i == len || shift > 28) {
+                return HWIRE_EILSEQ;
+            }
+            c = str[i++];
+            n += (uint64_t)(c & 0x7F) << shift;
+            shift += 7;
+        } while (c & 0x80);
+        if (n > UINT32_MAX) {
+            return HWIRE_EILSEQ;
+        }
+    }
+    *cur = i;
+    *v   = (uint32_t)n;
+    return HWIRE_OK;
+}
+
+/**
+ * @brief Load 8 bytes in network byte order
+ */
+static inline uint64_t load_be64(const unsigned char *p)
+{
+    return (uint64_t)p[0] << 56 | (uint64_t)p[1] << 48 | (uint64_t)p[2] << 40 |
+           (uint64_t)p[3] << 32 | (uint64_t)p[4] << 24 | (uint64_t)p[5] << 16 |
+           (uint64_t)p[6] << 8 | (uint64_t)p[7];
+}
+
+/**
+ * @brief Decode a Huffman-coded string and append it to out
+ *
+ * Input is kept left-aligned in a 64-bit register. It is refilled with a
+ * single load once fewer than 32 bits remain, which keeps the load off the
+ * dependency chain of most lookups; each HUFF_FAST lookup then yields one
+ * or two symbols.
+ *
+ * @return HWIRE_OK on success
+ * @return HWIRE_EILSEQ for EOS, or padding longer than 7 bits or not
+ * matching the high bits of EOS
+ * @return HWIRE_ENOBUFS if out is full
+ */
+static int hpack_huffman(const unsigned char *str, size_t len,
+                         hwire_buf_t *out)
+{
+    const unsigned char *end = str + len;
+    unsigned char *dst       = (unsigned char *)out->buf + out->len;
+    unsigned char *dend      = (unsigned char *)out->buf + out->size;
+    uint64_t bits            = 0; // left-aligned
+    unsigned int n           = 0; // number of valid bits
+
+    for (;;) {
+        uint32_t e;
+        unsigned int clen, sym;
+
+        if (n < 32) {
+            if (end - str >= 8) {
+                // whole bytes only; the partial byte below is loaded again
+                bits |= load_be64(str) >> n;
+                str += (63 - n) >> 3;
+                n |= 56;
+            } else {
+                while (n <= 56 && str < end) {
+                    bits |= (uint64_t)*str++ << (56 - n);
+                    n += 8;
+                }
+            }
+        }
+        e    = HUFF_FAST[bits >> (64 - HUFF_FAST_BITS)];
+        clen = (e >> 20) & 0x3F;
+        if (likely(clen - 1 < n && dend - dst >= 2)) {
+            // with one symbol, the second byte is overwritten next
+            dst[0] = (unsigned char)e;
+            dst[1] = (unsigned char)(e >> 8);
+            dst += e >> 26;
+            bits <<= clen;
+            n -= clen;
+            continue;
+        }
+        if (e != 0) {
+            // near the end of input or output: the first symbol only
+            clen = (e >> 16) & 0x0F;
+            sym  = e & 0xFF;
+            if (clen > n) {
+                break;
+            }
+        } else {
+            const uint32_t code = (uint32_t)(bits >> 32);
+            size_t k            = 0;
+            while (code > HUFF_LONG[k].last) {
+                k++;
+            }
+            clen = HUFF_LONG[k].len;
+            if (clen > n) {
+                break;
+            }
+            if (code >= HUFF_EOS) {
+                return HWIRE_EILSEQ;
+            }
+            sym = HUFF_LONG_SYM[HUFF_LONG[k].base +
+                                ((code - HUFF_LONG[k].first) >> (32 - clen))];
+        }
+        if (unlikely(dst == dend)) {
+            return HWIRE_ENOBUFS;
+        }
+        *dst++ = (unsigned char)sym;
+        bits <<= clen;
+        n -= clen;
+    }
+
+    if (n > 7 || (n > 0 && (bits >> (64 - n)) != (1u << n) - 1)) {
+        return HWIRE_EILSEQ;
+    }
+    out->len = (size_t)(dst - (unsigned char *)out->buf);
+    return HWIRE_OK;
+}
+
+/**
+ * @brief Decode a string literal (RFC 7541 5.2)
+ *
+ * A plain literal is returned as a slice of str, a Huffman-coded one is
+ * appended to hp->scratch.
+ *
+ * @return HWIRE_OK on success
+ * @return HWIRE_EILSEQ if truncated or the Huffman code is invalid
+ * @return HWIRE_EHDRLEN if longer than maxlen
+ * @return HWIRE_ENOBUFS if scratch is full
+ */
+static int hpack_string(hwire_hpack_t *hp, const unsigned char *str,
+                        size_t len, size_t *cur, size_t maxlen,
+                        hwire_str_t *out)
+{
+    size_t i = *cur;
+    uint32_t slen;
+    int rv;
+
+    if (i == len) {
+        return HWIRE_EILSEQ;
+    }
+    if ((rv = hpack_int(str, len, &i, 7, &slen)) != HWIRE_OK) {
+        return rv;
+    }
+    if (slen > len - i) {
+        return HWIRE_EILSEQ;
+    }
+    if (slen > maxlen) {
+        return HWIRE_EHDRLEN;
+    }
+
+    if (str[*cur] & 0x80) {
+        const size_t start = hp->scratch.len;
+        rv = hpack_huffman(str + i, slen, &hp->scratch);
+        if (rv != HWIRE_OK) {
+            return rv;
+        }
+        out->ptr = hp->scratch.buf + start;
+        out->len = hp->scratch.len - start;
+    } else {
+        out->ptr = (const char *)str + i;
+        out->len = slen;
+    }
+    *cur = i + slen;
+    return HWIRE_OK;
+}
+
+/**
+ * @brief Look up a field in the static and dynamic tables (RFC 7541 2.3.3)
+ *
+ * @return HWIRE_OK on success
+ * @return HWIRE_EILSEQ if index is 0 or beyond the dynamic table
+ */
+static int hpack_lookup(const hwire_hpack_t *hp, uint32_t index,
+                        hwire_header_t *header)
+{
+    if (index == 0) {
+        return HWIRE_EILSEQ;
+    }
+    if (index <= HPACK_STATIC_LEN) {
+        const hpack_static_t *s = &HPACK_STATIC_TABLE[index - 1];
+        header->key.ptr         = s->name;
+        header->key.len         = s->nlen;
+        header->value.ptr       = s->value;
+        header->value.len       = s->vlen;
+        header->hash            = s->hash;
+        return HWIRE_OK;
+    }
+
+    // the newest entry has the lowest index
+    index -= (uint32_t)HPACK_STATIC_LEN + 1;
+    if (index >= hp->count) {
+        return HWIRE_EILSEQ;
+    }
+    {
+        const hwire_hpack_entry_t *e =
+            &hp->entries[(hp->head + hp->nentries - index) % hp->nentries];
+        header->key.ptr   = hp->table.buf + e->off;
+        header->key.len   = e->nlen;
+        header->value.ptr = hp->table.buf + e->off + e->nlen;
+        header->value.len = e->vlen;
+        header->hash      = e->hash;
+    }
+    return HWIRE_OK;
+}
+
+/**
+ * @brief Evict the oldest entries until need more bytes fit the table
+ */
+static void hpack_evict(hwire_hpack_t *hp, size_t need)
+{
+    while (hp->count > 0 && hp->size + need > hp->cap) {
+        const hwire_hpack_entry_t *e =
+            &hp->entries[(hp->head + hp->nentries - hp->count + 1) %
+                         hp->nentries];
+        hp->size -= (size_t)e->nlen + e->vlen + HPACK_ENTRY_OVERHEAD;
+        hp->count--;
+    }
+}
+
+/**
+ * @brief Add a field to the dynamic table (RFC 7541 4.4)
+ *
+ * The name and value are stored after those of the newest entry, or at
+ * the start of the ring if they do not fit before its end. With a ring of
+ * twice the maximum table size, that space has always been released by
+ * the eviction. header is updated to reference the copy.
+ */
+static void hpack_insert(hwire_hpack_t *hp, hwire_header_t *header)
+{
+    const size_t nlen = header->key.len;
+    const size_t vlen = header->value.len;
+    const size_t need = nlen + vlen + HPACK_ENTRY_OVERHEAD;
+    size_t off        = 0;
+    hwire_hpack_entry_t *e;
+    char *dst;
+
+    hpack_evict(hp, need);
+    // a field larger than the table empties it and is not added
+    if (need > hp->cap) {
+        return;
+    }
+    if (hp->count > 0) {
+        e   = &hp->entries[hp->head];
+        off = (size_t)e->off + e->nlen + e->vlen;
+        if (off + nlen + vlen > hp->table.size) {
+            off = 0;
+        }
+    }
+
+    hp->head = (hp->head + 1) % hp->nentries;
+    hp->count++;
+    hp->size += need;
+    e       = &hp->entries[hp->head];
+    e->off  = (uint32_t)off;
+    e->nlen = (uint32_t)nlen;
+    e->vlen = (uint32_t)vlen;
+    e->hash = header->hash;
+
+    // an indexed name may lie in space just released by the eviction
+    dst = hp->table.buf + off;
+    memmove(dst, header->key.ptr, nlen);
+    memcpy(dst + nlen, header->value.ptr, vlen);
+    header->key.ptr   = dst;
+    header->value.ptr = dst + nlen;
+}
+
+/**
+ * @brief Validate a literal field name and compute its hash
+ *
+ * Field names must be lowercase tokens (RFC 9113 8.2.1); pseudo-header
+ * fields are prefixed by ':'.
+ */
+static int hpack_name(const hwire_str_t *name, uint32_t *hash)
+{
+    const unsigned char *s = (const unsigned char *)name->ptr;
+    size_t i               = (name->len > 0 && s[0] == COLON) ? 1 : 0;
+
+    if (i == name->len) {
+        return HWIRE_EHDRNAME;
+    }
+    for (; i < name->len; i++) {
+        if (!is_tchar(s[i]) || (s[i] >= 'A' && s[i] <= 'Z')) {
+            return HWIRE_EHDRNAME;
+        }
+    }
+    *hash = ~crc32c(UINT32_MAX, s, name->len);
+    return HWIRE_OK;
+}
+
+/**
+ * @brief Validate a literal field value (RFC 9113 8.2.1)
+ */
+static int hpack_value(const hwire_str_t *value)
+{
+    const unsigned char *s = (const unsigned char *)value->ptr;
+    const size_t len       = value->len;
+    unsigned char endc     = 0;
+
+    if (len > 0 && (s[0] == SP || s[0] == HT || s[len - 1] == SP ||
+                    s[len - 1] == HT)) {
+        return HWIRE_EHDRVALUE;
+    }
+    if (strfcchar(s, len, &endc) != len) {
+        return HWIRE_EHDRVALUE;
+    }
+    return HWIRE_OK;
+}
+
+int hwire_hpack_init(hwire_hpack_t *hp, size_t max_size)
+{
+    assert(hp != NULL);
+    assert(hp->entries != NULL || hp->nentries == 0);
+    assert(hp->table.buf != NULL || hp->table.size == 0);
+
+    if (max_size > UINT32_MAX ||
+        hp->nentries < max_size / HPACK_ENTRY_OVERHEAD ||
+        hp->table.size / 2 < max_size) {
+        return HWIRE_ERANGE;
+    }
+    hp->max_size = max_size;
+    hp->cap      = max_size;
+    hp->size     = 0;
+    hp->head     = 0;
+    hp->count    = 0;
+    return HWIRE_OK;
+}
+
+/**
+ * @brief Decode an HPACK header block
+ *
+ * A single-byte indexed field line of the static table, the most frequent
+ * representation in request headers, is emitted without further decoding.
+ */
+int hwire_hpack_decode(hwire_hpack_t *hp, hwire_ctx_t *ctx, const char *str,
+                       size_t len, size_t maxlen, uint8_t maxnhdrs)
+{
+    assert(hp != NULL);
+    assert(ctx != NULL);
+    assert(ctx->header_cb != NULL);
+    assert(str != NULL || len == 0);
+    const unsigned char *s = (const unsigned char *)str;
+    size_t cur             = 0;
+    uint8_t nhdr           = 0;
+    uint32_t index         = 0;
+    hwire_header_t header;
+    int rv;
+
+    while (cur < len) {
+        const unsigned char c = s[cur];
+
+        if (c & 0x80) {
+            // indexed field line (6.1)
+            if (likely(c > 0x80 && c <= 0x80 + HPACK_STATIC_LEN)) {
+                const hpack_static_t *e = &HPACK_STATIC_TABLE[c - 0x81];
+                header.key.ptr          = e->name;
+                header.key.len          = e->nlen;
+                header.value.ptr        = e->value;
+                header.value.len        = e->vlen;
+                header.hash             = e->hash;
+                cur++;
+            } else if ((rv = hpack_int(s, len, &cur, 7, &index)) != HWIRE_OK ||
+                       (rv = hpack_lookup(hp, index, &header)) != HWIRE_OK) {
+                return rv;
+            }
+        } else if ((c & 0xE0) == 0x20) {
+            // dynamic table size update (6.3), only before the first field
+            // line
+            if ((rv = hpack_int(s, len, &cur, 5, &index)) != HWIRE_OK) {
+                return rv;
+            }
+            if (nhdr > 0 || index > hp->max_size) {
+                return HWIRE_EILSEQ;
+            }
+            hp->cap = index;
+            hpack_evict(hp, 0);
+            continue;
+        } else {
+            // literal field line (6.2) with incremental indexing (01),
+            // without indexing (0000) or never indexed (0001)
+            const int indexing = (c & 0xC0) == 0x40;
+
+            hp->scratch.len = 0;
+            rv = hpack_int(s, len, &cur, indexing ? 6 : 4, &index);
+            if (rv != HWIRE_OK) {
+                return rv;
+            }
+            if (index == 0) {
+                rv = hpack_string(hp, s, len, &cur, maxlen, &header.key);
+                if (rv != HWIRE_OK ||
+                    (rv = hpack_name(&header.key, &header.hash)) != HWIRE_OK) {
+                    return rv;
+                }
+            } else if ((rv = hpack_lookup(hp, index, &header)) != HWIRE_OK) {
+                return rv;
+            }
+            rv = hpack_string(hp, s, len, &cur, maxlen, &header.value);
+            if (rv != HWIRE_OK) {
+                return rv;
+            }
+            if (header.key.len + header.value.len > maxlen) {
+                return HWIRE_EHDRLEN;
+            }
+            if ((rv = hpack_value(&header.value)) != HWIRE_OK) {
+                return rv;
+            }
+            if (indexing) {
+                hpack_insert(hp, &header);
+            }
+        }
+
+        if (nhdr == maxnhdrs) {
+            return HWIRE_ENOBUFS;
+        }
+        nhdr++;
+        if (ctx->key_lc.size > 0) {
+            if (header.key.len > ctx->key_lc.size) {
+                return HWIRE_EKEYLEN;
+            }
+            memcpy(ctx->key_lc.buf, header.key.ptr, header.key.len);
+            ctx->key_lc.len  = header.key.len;
+            ctx->key_lc.hash = header.hash;
+        } else {
+            header.hash = 0;
+        }
+        if (ctx->header_cb(ctx, &header) != 0) {
+            return HWIRE_ECALLBACK;
+        }
+    }
+    return HWIRE_OK;
+}
+
+#undef HUFF_EOS
+#undef HUFF_FAST_BITS
+#undef HPACK_STATIC_LEN
+#undef HPACK_ENTRY_OVERHEAD
+
+/** @} */ /* end of HPACK Functions */
+
+/**
+ * @name HTTP/2 Functions
+ * @{
+ */
+
+#define H2_STREAM 0x01 // stream identifier must not be 0
+#define H2_CONN   0x02 // stream identifier must be 0
+#define H2_PAD    0x04 // PADDED flag is defined
+
+#define H2_SETTING_LEN 6
+
+/**
+ * Stream identifier rules and fixed payload lengths of the frame types
+ * defined by RFC 9113 Section 6, indexed by type.
+ */
+static const struct {
+    uint8_t rules;
+    uint8_t len; // 0: any length
+} H2_FRAME_RULES[HWIRE_H2_CONTINUATION + 1] = {
+    [HWIRE_H2_DATA]          = {H2_STREAM | H2_PAD, 0},
+    [HWIRE_H2_HEADERS]       = {H2_STREAM | H2_PAD, 0},
+    [HWIRE_H2_PRIORITY]      = {H2_STREAM, 5},
+    [HWIRE_H2_RST_STREAM]    = {H2_STREAM, 4},
+    [HWIRE_H2_SETTINGS]      = {H2_CONN, 0},
+    [HWIRE_H2_PUSH_PROMISE]  = {H2_STREAM | H2_PAD, 0},
+    [HWIRE_H2_PING]          = {H2_CONN, 8},
+    [HWIRE_H2_GOAWAY]        = {H2_CONN, 0},
+    [HWIRE_H2_WINDOW_UPDATE] = {0, 4},
+    [HWIRE_H2_CONTINUATION]  = {H2_STREAM, 0},
+};
+
+static inline uint32_t h2_load32(const unsigned char *p)
+{
+    return (uint32_t)p[0] << 24 | (uint32_t)p[1] << 16 | (uint32_t)p[2] << 8 |
+           p[3];
+}
+
+/**
+ * @brief Set the initial values of HTTP/2 settings
+ */
+void hwire_h2_settings_init(hwire_h2_settings_t *settings)
+{
+    assert(settings != NULL);
+    settings->header_table_size      = 4096;
+    settings->enable_push            = 1;
+    settings->max_concurrent_streams = UINT32_MAX;
+    settings->initial_window_size    = 65535;
+    settings->max_frame_size         = HWIRE_H2_MIN_FRAME_SIZE;
+    settings->max_header_list_size   = UINT32_MAX;
+}
+
+/**
+ * @brief Parse an HTTP/2 frame
+ */
+int hwire_h2_parse_frame(const char *str, size_t len, size_t *pos,
+                         uint32_t maxlen, hwire_h2_frame_t *frame)
+{
+    assert(str != NULL || len == 0);
+    assert(pos != NULL);
+    assert(frame != NULL);
+    const unsigned char *s = (const unsigned char *)str;
+    const unsigned char *p = s + HWIRE_H2_FRAME_HEADER_LEN;
+    uint32_t plen          = 0;
+    uint32_t rlen          = 0; // payload length after Pad Length
+    uint32_t dlen          = 0;
+    unsigned int type      = 0;
+    unsigned int flags     = 0;
+    uint32_t sid           = 0;
+
+    if (len < HWIRE_H2_FRAME_HEADER_LEN) {
+        return HWIRE_EAGAIN;
+    }
+    // reject an oversized frame before waiting for its payload
+    plen = (uint32_t)s[0] << 16 | (uint32_t)s[1] << 8 | s[2];
+    if (plen > maxlen) {
+        return HWIRE_ELEN;
+    }
+    if (len - HWIRE_H2_FRAME_HEADER_LEN < plen) {
+        return HWIRE_EAGAIN;
+    }
+    type  = s[3];
+    flags = s[4];
+    sid   = h2_load32(s + 5) & 0x7FFFFFFFu;
+    rlen  = plen;
+    dlen  = plen;
+
+    // frames of unknown types are returned as they are
+    if (likely(type <= HWIRE_H2_CONTINUATION)) {
+        const unsigned int rules = H2_FRAME_RULES[type].rules;
+
+        if (((rules & H2_STREAM) && sid == 0) ||
+            ((rules & H2_CONN) && sid != 0)) {
+            return HWIRE_EILSEQ;
+        }
+        if (H2_FRAME_RULES[type].len != 0 &&
+            plen != H2_FRAME_RULES[type].len) {
+            return HWIRE_ELEN;
+        }
+        // Pad Length counts toward the payload and the padding must leave
+        // room for it
+        if ((rules & H2_PAD) && (flags & HWIRE_H2_FLAG_PADDED)) {
+            if (plen == 0) {
+                return HWIRE_ELEN;
+            } else if (p[0] >= plen) {
+                return HWIRE_EILSEQ;
+            }
+            rlen = plen - 1;
+            dlen = rlen - p[0];
+            p++;
+        }
+        // a frame too short for its fixed fields has a wrong length, while
+        // one whose padding eats into them is malformed
+        switch (type) {
+        case HWIRE_H2_HEADERS:
+            // Exclusive, Stream Dependency and Weight
+            if (flags & HWIRE_H2_FLAG_PRIORITY) {
+                if (rlen < 5) {
+                    return HWIRE_ELEN;
+                } else if (dlen < 5) {
+                    return HWIRE_EILSEQ;
+                }
+                p += 5;
+                dlen -= 5;
+            }
+            break;
+
+        case HWIRE_H2_SETTINGS:
+            if (plen % H2_SETTING_LEN != 0 ||
+                ((flags & HWIRE_H2_FLAG_ACK) && plen != 0)) {
+                return HWIRE_ELEN;
+            }
+            break;
+
+        case HWIRE_H2_PUSH_PROMISE:
+            // Promised Stream ID
+            if (rlen < 4) {
+                return HWIRE_ELEN;
+            } else if (dlen < 4) {
+                return HWIRE_EILSEQ;
+            }
+            break;
+
+        case HWIRE_H2_GOAWAY:
+            // Last-Stream-ID and Error Code
+            if (plen < 8) {
+                return HWIRE_ELEN;
+            }
+            break;
+        }
+    }
+
+    frame->payload.ptr = (const char *)p;
+    frame->payload.len = dlen;
+    frame->len         = plen;
+    frame->stream_id   = sid;
+    frame->type        = (uint8_t)type;
+    frame->flags       = (uint8_t)flags;
+    *pos               = HWIRE_H2_FRAME_HEADER_LEN + (size_t)plen;
+    return HWIRE_OK;
+}
+
+/**
+ * @brief Parse the complete HTTP/2 frames in a buffer
+ */
+int hwire_h2_parse_frames(const char *str, size_t len, size_t *pos,
+                          uint32_t maxlen, hwire_h2_frame_t *frames,
+                          size_t *nframes)
+{
+    assert(str != NULL || len == 0);
+    assert(pos != NULL);
+    assert(frames != NULL);
+    assert(nframes != NULL);
+    size_t cur = 0;
+    size_t n   = 0;
+    int rv     = HWIRE_EAGAIN;
+
+    while (n < *nframes && len - cur >= HWIRE_H2_FRAME_HEADER_LEN) {
+        size_t flen = 0;
+        rv = hwire_h2_parse_frame(str + cur, len - cur, &flen, maxlen,
+                                  frames + n);
+        if (rv != HWIRE_OK) {
+            break;
+        }
+        cur += flen;
+        n++;
+    }
+    *nframes = n;
+    if (n == 0) {
+        return rv;
+    }
+    *pos = cur;
+    return HWIRE_OK;
+}
+
+/**
+ * @brief Apply a SETTINGS parameter
+ *
+ * @return HWIRE_OK, HWIRE_EILSEQ or HWIRE_ERANGE as for
+ * hwire_h2_parse_settings
+ */
+static int h2_setting(hwire_h2_settings_t *settings, const unsigned char *p)
+{
+    const unsigned int id = (unsigned int)p[0] << 8 | p[1];
+    const uint32_t value  = h2_load32(p + 2);
+
+    switch (id) {
+    case 0x1: // SETTINGS_HEADER_TABLE_SIZE
+        settings->header_table_size = value;
+        break;
+
+    case 0x2: // SETTINGS_ENABLE_PUSH
+        if (value > 1) {
+            return HWIRE_EILSEQ;
+        }
+        settings->enable_push = value;
+        break;
+
+    case 0x3: // SETTINGS_MAX_CONCURRENT_STREAMS
+        settings->max_concurrent_streams = value;
+        break;
+
+    case 0x4: // SETTINGS_INITIAL_WINDOW_SIZE
+        if (value > HWIRE_H2_MAX_WINDOW_SIZE) {
+            return HWIRE_ERANGE;
+        }
+        settings->initial_window_size = value;
+        break;
+
+    case 0x5: // SETTINGS_MAX_FRAME_SIZE
+        if (value < HWIRE_H2_MIN_FRAME_SIZE ||
+            value > HWIRE_H2_MAX_FRAME_SIZE) {
+            return HWIRE_EILSEQ;
+        }
+        settings->max_frame_size = value;
+        break;
+
+    case 0x6: // SETTINGS_MAX_HEADER_LIST_SIZE
+        settings->max_header_list_size = value;
+        break;
+    }
+    // unknown settings must be ignored
+    return HWIRE_OK;
+}
+
+/**
+ * @brief Apply the parameters of a SETTINGS frame
+ */
+int hwire_h2_parse_settings(const hwire_h2_frame_t *frame,
+                            hwire_h2_settings_t *settings)
+{
+    assert(frame != NULL);
+    assert(settings != NULL);
+    const unsigned char *p = (const unsigned char *)frame->payload.ptr;
+    hwire_h2_settings_t s  = *settings;
+
+    if (frame->payload.len % H2_SETTING_LEN != 0 ||
+        ((frame->flags & HWIRE_H2_FLAG_ACK) && frame->payload.len != 0)) {
+        return HWIRE_ELEN;
+    }
+    for (size_t i = 0; i < frame->payload.len; i += H2_SETTING_LEN) {
+        int rv = h2_setting(&s, p + i);
+        if (rv != HWIRE_OK) {
+            return rv;
+        }
+    }
+    *settings = s;
+    return HWIRE_OK;
+}
+
+/**
+ * @brief Parse a WINDOW_UPDATE frame
+ */
+int hwire_h2_parse_window_update(const hwire_h2_frame_t *frame,
+                                 uint32_t *increment)
+{
+    assert(frame != NULL);
+    assert(increment != NULL);
+    uint32_t v = 0;
+
+    if (frame->payload.len != 4) {
+        return HWIRE_ELEN;
+    }
+    v = h2_load32((const unsigned char *)frame->payload.ptr) & 0x7FFFFFFFu;
+    if (v == 0) {
+        return HWIRE_EILSEQ;
+    }
+    *increment = v;
+    return HWIRE_OK;
+}
+
+/**
+ * @brief Decode a base64url character
+ *
+ * @return 0 to 63, or -1 if c is not in the base64url alphabet
+ */
+static inline int h2_base64url(unsigned char c)
+{
+    if (c >= 'A' && c <= 'Z') {
+        return c - 'A';
+    } else if (c >= 'a' && c <= 'z') {
+        return c - 'a' + 26;
+    } else if (c >= '0' && c <= '9') {
+        return c - '0' + 52;
+    } else if (c == '-') {
+        return 62;
+    } else if (c == '_') {
+        return 63;
+    }
+    return -1;
+}
+
+/**
+ * @brief Validate an HTTP/1.1 upgrade request to h2c
+ */
+int hwire_h2_upgrade(const hwire_ctx_t *ctx, hwire_h2_settings_t *settings)
+{
+    assert(ctx != NULL);
+    assert(ctx->hdr_index != NULL);
+    assert(ctx->framing != NULL);
+    assert(settings != NULL);
+    const unsigned int upgrade = HWIRE_FRAMING_UPGRADE | HWIRE_FRAMING_H2C;
+    const hwire_hdr_entry_t *e = NULL;
+    const unsigned char *v     = NULL;
+    hwire_h2_settings_t s      = *settings;
+    hwire_str_t elem           = {0};
+    int listed                 = 0;
+
+    if ((ctx->framing->flags & upgrade) != upgrade) {
+        return HWIRE_EHDRVALUE;
+    }
+    // RFC 7540 3.2.1: HTTP2-Settings is a connection-specific header field
+    // and must be listed in Connection
+    for (e = hwire_hdr_index_get(ctx->hdr_index, "connection", 10);
+         e != NULL && !listed; e = hwire_hdr_index_next(ctx->hdr_index, e)) {
+        size_t cur = 0;
+        v          = (const unsigned char *)e->header.value.ptr;
+        while (!listed &&
+               next_list_elem(v, e->header.value.len, &cur, &elem)) {
+            listed = token_eq((const unsigned char *)elem.ptr, elem.len,
+                              "http2-settings", 14);
+        }
+    }
+    if (!listed) {
+        return HWIRE_EILSEQ;
+    }
+    e = hwire_hdr_index_get(ctx->hdr_index, "http2-settings", 14);
+    // 8 characters encode the 6 bytes of a setting, so there is no padding
+    if (e == NULL || e->next != 0 || e->header.value.len % 8 != 0) {
+        return HWIRE_EHDRVALUE;
+    }
+    v = (const unsigned char *)e->header.value.ptr;
+    for (size_t i = 0; i < e->header.value.len; i += 8) {
+        unsigned char p[H2_SETTING_LEN];
+        uint64_t bits = 0;
+        int rv        = 0;
+
+        for (size_t j = 0; j < 8; j++) {
+            int d = h2_base64url(v[i + j]);
+            if (d < 0) {
+                return HWIRE_EHDRVALUE;
+            }
+            bits = bits << 6 | (uint64_t)d;
+        }
+        for (size_t j = 0; j < H2_SETTING_LEN; j++) {
+            p[j] = (unsigned char)(bits >> (40 - 8 * j));
+        }
+        if ((rv = h2_setting(&s, p)) != HWIRE_OK) {
+            return rv;
+        }
+    }
+    *settings = s;
+    return HWIRE_OK;
+}
+
+#undef H2_SETTING_LEN
+#undef H2_PAD
+#undef H2_CONN
+#undef H2_STREAM
+
+/** @} */ /* end of HTTP/2 Functions */
+
+#if defined(HWIRE_RING)
+/**
+ * @name Ring Buffer Functions
+ * @{
+ */
+
+# if !defined(MAP_ANONYMOUS)
+#  define MAP_ANONYMOUS MAP_ANON
+# endif
+
+/**
+ * @brief Create an anonymous shared memory object of size bytes
+ *
+ * @return File descriptor, or -1 with errno set
+ */
+static int ring_shm(const hwire_ring_t *ring, size_t size)
+{
+    int fd  = -1;
+    int err = 0;
+
+# if defined(__linux__)
+    (void)ring;
+    fd = memfd_create("hwire-ring", MFD_CLOEXEC);
+# elif defined(__FreeBSD__)
+    (void)ring;
+    fd = shm_open(SHM_ANON, O_RDWR | O_CREAT, 0600);
+# else
+    // no anonymous objects: use a name unique to this process and ring,
+    // and unlink it at once
+    static const char HEX[] = "0123456789abcdef";
+    char name[]             = "/hwire-0000000000000000";
+    uintptr_t id = (uintptr_t)ring ^ ((uintptr_t)getpid() << 20);
+    for (size_t i = sizeof(name) - 2; name[i] == '0'; i--, id >>= 4) {
+        name[i] = HEX[id & 0xF];
+    }
+    fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0600);
+    if (fd != -1) {
+        shm_unlink(name);
+    }
+# endif
+    if (fd != -1 && ftruncate(fd, (off_t)size) != 0) {
+        err = errno;
+        close(fd);
+        errno = err;
+        fd    = -1;
+    }
+    return fd;
+}
+
+/**
+ * @brief Create a mirrored ring buffer
+ *
+ * Address space for both copies is reserved first, so the two fixed
+ * mappings cannot collide with other mappings of the process.
+ */
+int hwire_ring_init(hwire_ring_t *ring, size_t size)
+{
+    assert(ring != NULL);
+    long page  = sysconf(_SC_PAGESIZE);
+    size_t pgs = (page > 0) ? (size_t)page : 4096;
+    char *base = NULL;
+    int fd     = -1;
+    int err    = 0;
+
+    if (size == 0 || size > SIZE_MAX / 2 - pgs) {
+        return HWIRE_ERANGE;
+    }
+    size = (size + pgs - 1) / pgs * pgs;
+
+    fd = ring_shm(ring, size);
+    if (fd == -1) {
+        return HWIRE_ENOBUFS;
+    }
+    base = (char *)mmap(NULL, size * 2, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS,
+                        -1, 0);
+    if (base == (char *)MAP_FAILED) {
+        err = errno;
+        close(fd);
+        errno = err;
+        return HWIRE_ENOBUFS;
+    }
+    if (mmap(base, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd,
+             0) == MAP_FAILED ||
+        mmap(base + size, size, PROT_READ | PROT_WRITE,
+             MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED) {
+        err = errno;
+        munmap(base, size * 2);
+        close(fd);
+        errno = err;
+        return HWIRE_ENOBUFS;
+    }
+    // the mappings keep the memory alive
+    close(fd);
+
+    *ring = (hwire_ring_t){.buf = base, .size = size};
+    return HWIRE_OK;
+}
+
+/**
+ * @brief Release a ring buffer
+ */
+void hwire_ring_free(hwire_ring_t *ring)
+{
+    assert(ring != NULL);
+    if (ring->buf != NULL) {
+        munmap(ring->buf, ring->size * 2);
+    }
+    *ring = (hwire_ring_t){0};
+}
+
+/**
+ * @brief Get the free space of a ring buffer
+ */
+char *hwire_ring_wbuf(hwire_ring_t *ring, size_t *avail)
+{
+    assert(ring != NULL);
+    assert(avail != NULL);
+    *avail = ring->size - ring->len;
+    return ring->buf + ring->head + ring->len;
+}
+
+/**
+ * @brief Append written bytes to the unread data
+ */
+void hwire_ring_commit(hwire_ring_t *ring, size_t n)
+{
+    assert(ring != NULL);
+    assert(n <= ring->size - ring->len);
+    ring->len += n;
+}
+
+/**
+ * @brief Get the unread data of a ring buffer
+ */
+const char *hwire_ring_rbuf(const hwire_ring_t *ring, size_t *len)
+{
+    assert(ring != NULL);
+    assert(len != NULL);
+    *len = ring->len;
+    return ring->buf + ring->head;
+}
+
+/**
+ * @brief Discard bytes from the start of the unread data
+ */
+void hwire_ring_consume(hwire_ring_t *ring, size_t n)
+{
+    assert(ring != NULL);
+    assert(n <= ring->len);
+    ring->len -= n;
+    if (ring->len == 0) {
+        // restart at the front to keep touching the same pages
+        ring->head = 0;
+    } else {
+        ring->head += n;
+        if (ring->head >= ring->size) {
+            ring->head -= ring->size;
+        }
+    }
+}
+
+/**
+ * @brief Feed the unread data of a ring buffer to a message parser
+ */
+int hwire_ring_msg_parse(hwire_ring_t *ring, hwire_msg_parser_t *msg,
+                         hwire_ctx_t *ctx)
+{
+    assert(ring != NULL);
+    size_t pos = 0;
+    int rv =
+        hwire_msg_parse(msg, ctx, ring->buf + ring->head, ring->len, &pos);
+
+    if (rv == HWIRE_OK || rv == HWIRE_EAGAIN) {
+        if (rv == HWIRE_EAGAIN && pos == 0 && ring->len == ring->size) {
+            // nothing can be consumed and no more data fits
+            return HWIRE_ENOBUFS;
+        }
+        hwire_ring_consume(ring, pos);
+    }
+    return rv;
+}
+
+/** @} */ /* end of Ring Buffer Functions */
+#endif
+
+/**
+ * @name URI Functions
+ * @{
+ */
+
+/**
+ * @brief Find the first byte that needs decoding
+ *
+ * Returns the offset of the first '%' (or '+' when plus is non-zero) in
+ * str, or len if there is none.  AVX2/SSE2/NEON compare 32/16 bytes per
+ * step so that clean runs are skipped without a per-byte branch.
+ */
+static inline size_t pct_span(const unsigned char *str, size_t len, int plus)
+{
+    size_t pos = 0;
+
+#if defined(__AVX2__)
+    // with plus == 0 the second compare looks for '%' again
+    const __m256i pct256  = _mm256_set1_epi8('%');
+    const __m256i plus256 = _mm256_set1_epi8(plus ? '+' : '%');
+    while (pos + 32 <= len) {
+        __m256i data =
+            _mm256_loadu_si256((const __m256i *)(const void *)(str + pos));
+        unsigned int mask = (unsigned int)_mm256_movemask_epi8(
+            _mm256_or_si256(_mm256_cmpeq_epi8(data, pct256),
+                            _mm256_cmpeq_epi8(data, plus256)));
+        if (mask) {
+            return pos + (size_t)ctz32(mask);
+        }
+        pos += 32;
+    }
+#endif
+#if defined(__SSE2__)
+    const __m128i pct128  = _mm_set1_epi8('%');
+    const __m128i plus128 = _mm_set1_epi8(plus ? '+' : '%');
+    while (pos + 16 <= len) {
+        __m128i data =
+            _mm_loadu_si128((const __m128i *)(const void *)(str + pos));
+        unsigned int mask = (unsigned int)_mm_movemask_epi8(_mm_or_si128(
+            _mm_cmpeq_epi8(data, pct128), _mm_cmpeq_epi8(data, plus128)));
+        if (mask) {
+            return pos + (size_t)ctz32(mask);
+        }
+        pos += 16;
+    }
+#elif defined(__aarch64__) || (defined(__arm__) && defined(__ARM_NEON))
+    const uint8x16_t pct128  = vdupq_n_u8('%');
+    const uint8x16_t plus128 = vdupq_n_u8(plus ? '+' : '%');
+    while (pos + 16 <= len) {
+        uint8x16_t data = vld1q_u8(str + pos);
+        uint64x2_t hit  = vreinterpretq_u64_u8(
+            vorrq_u8(vceqq_u8(data, pct128), vceqq_u8(data, plus128)));
+        uint64_t lo = vgetq_lane_u64(hit, 0);
+        uint64_t hi = vgetq_lane_u64(hit, 1);
+        if (lo) {
+            return pos + (size_t)(ctz64(lo) >> 3);
+        } else if (hi) {
+            return pos + 8 + (size_t)(ctz64(hi) >> 3);
+        }
+        pos += 16;
+    }
+#endif
+    while (pos < len && str[pos] != '%' && !(plus && str[pos] == '+')) {
+        pos++;
+    }
+    return pos;
+}
+
+/**
+ * @brief Percent-decode str into dst
+ *
+ * Body of hwire_pct_decode and hwire_pct_decode_inplace.  dst may equal
+ * str since the output never gets ahead of the input; runs without escapes
+ * are then only moved once an escape has shifted the output.
+ */
+static int pct_decode(const unsigned char *str, size_t len, unsigned char *dst,
+                      size_t size, unsigned int flags, size_t *outlen)
+{
+    const int plus = (flags & HWIRE_PCT_PLUS) != 0;
+    size_t cur     = 0;
+    size_t out     = 0;
+
+    for (;;) {
+        size_t run = pct_span(str + cur, len - cur, plus);
+        if (run > 0) {
+            if (unlikely(run > size - out)) {
+                return HWIRE_ENOBUFS;
+            } else if (dst + out != str + cur) {
+                memmove(dst + out, str + cur, run);
+            }
+            cur += run;
+            out += run;
+        }
+        if (cur == len) {
+            *outlen = out;
+            return HWIRE_OK;
+        } else if (unlikely(out == size)) {
+            return HWIRE_ENOBUFS;
+        }
+
+        if (str[cur] == '+') {
+            dst[out++] = SP;
+            cur++;
+            continue;
+        }
+        // pct-encoded = "%" HEXDIG HEXDIG
+        // RFC 3986 2.1: Percent-Encoding
+        if (unlikely(len - cur < 3)) {
+            return HWIRE_EILSEQ;
+        }
+        unsigned int hi = HEXDIGIT[str[cur + 1]];
+        unsigned int lo = HEXDIGIT[str[cur + 2]];
+        if (unlikely(hi == 0 || lo == 0)) {
+            return HWIRE_EILSEQ;
+        }
+        unsigned char c = (unsigned char)(((hi - 1) << 4) | (lo - 1));
+        if (unlikely((c == 0 && (flags & HWIRE_PCT_REJECT_NUL)) ||
+                     (c == '/' && (flags & HWIRE_PCT_REJECT_SLASH)))) {
+            return HWIRE_EILSEQ;
+        }
+        dst[out++] = c;
+        cur += 3;
+    }
+}
+
+/**
+ * @brief Percent-decode a string into a caller buffer
+ */
+int hwire_pct_decode(const char *str, size_t len, hwire_buf_t *dst,
+                     unsigned int flags)
+{
+    assert(str != NULL || len == 0);
+    assert(dst != NULL);
+    size_t out = 0;
+    int rv     = pct_decode((const unsigned char *)str, len,
+                            (unsigned char *)dst->buf, dst->size, flags, &out);
+    if (rv == HWIRE_OK) {
+        dst->len = out;
+    }
+    return rv;
+}
+
+/**
+ * @brief Percent-decode a caller-owned slice in place
+ */
+int hwire_pct_decode_inplace(hwire_str_t *str, unsigned int flags)
+{
+    assert(str != NULL);
+    assert(str->ptr != NULL || str->len == 0);
+    // the caller owns the bytes behind str->ptr
+    unsigned char *buf = (unsigned char *)(uintptr_t)str->ptr;
+    size_t out         = 0;
+    int rv = pct_decode(buf, str->len, buf, str->len, flags, &out);
+    if (rv == HWIRE_OK) {
+        str->len = out;
+    }
+    return rv;
+}
+
+/**
+ * @brief Check for an RFC 3986 unreserved character
+ *
+ * unreserved = ALPHA / DIGIT / "-" / "." / "_" / "~"
+ */
+static inline int is_unreserved(unsigned char c)
+{
+    return ((c | 0x20) >= 'a' && (c | 0x20) <= 'z') ||
+           (c >= '0' && c <= '9') || c == '-' || c == '.' || c == '_' ||
+           c == '~';
+}
+
+/**
+ * @brief Normalize an absolute path in place
+ *
+ * One forward pass: the read position r never falls behind the write
+ * position w, and ".." only moves w back over output already written, so
+ * the work is linear in the input length.  Dot-segments are recognized
+ * after unreserved escapes are decoded, so "%2e%2E" is removed like "..".
+ */
+int hwire_path_normalize(hwire_str_t *path)
+{
+    assert(path != NULL);
+    assert(path->ptr != NULL || path->len == 0);
+    // the caller owns the bytes behind path->ptr
+    unsigned char *buf = (unsigned char *)(uintptr_t)path->ptr;
+    size_t len         = path->len;
+    size_t r           = 0;
+    size_t w           = 0;
+
+    if (unlikely(len == 0 || buf[0] != '/')) {
+        return HWIRE_EILSEQ;
+    }
+
+    while (r < len) {
+        size_t seg = 0;
+
+        // collapse "//" runs into a single slash; after a removed
+        // dot-segment the output already ends in one
+        while (r < len && buf[r] == '/') {
+            r++;
+        }
+        if (w == 0 || buf[w - 1] != '/') {
+            buf[w++] = '/';
+        }
+        seg = w;
+
+        // copy one segment, decoding unreserved escapes
+        while (r < len && buf[r] != '/') {
+            unsigned char c = buf[r];
+            if (c == '%') {
+                if (unlikely(len - r < 3)) {
+                    return HWIRE_EILSEQ;
+                }
+                unsigned int hi = HEXDIGIT[buf[r + 1]];
+                unsigned int lo = HEXDIGIT[buf[r + 2]];
+                if (unlikely(hi == 0 || lo == 0)) {
+                    return HWIRE_EILSEQ;
+                }
+                c = (unsigned char)(((hi - 1) << 4) | (lo - 1));
+                if (!is_unreserved(c)) {
+                    // RFC 3986 6.2.2.1: keep the escape, uppercase its digits
+                    buf[w++] = '%';
+                    buf[w++] = (unsigned char)"0123456789ABCDEF"[hi - 1];
+                    buf[w++] = (unsigned char)"0123456789ABCDEF"[lo - 1];
+                    r += 3;
+                    continue;
+                }
+                r += 3;
+            } else {
+                r++;
+            }
+            buf[w++] = c;
+        }
+
+        // RFC 3986 5.2.4: Remove Dot Segments
+        if (w - seg == 1 && buf[seg] == '.') {
+            w = seg;
+        } else if (w - seg == 2 && buf[seg] == '.' && buf[seg + 1] == '.') {
+            if (unlikely(seg == 1)) {
+                // ".." above the root
+                return HWIRE_ERANGE;
+            }
+            // drop the previous segment, keep its leading slash
+            w = seg - 1;
+            while (buf[w - 1] != '/') {
+                w--;
+            }
+        }
+    }
+
+    path->len = w;
+    return HWIRE_OK;
+}
+
+/**
+ * @brief Classify a block of a query string
+ *
+ * Sets bit i of *amp, *eq and *enc if str[i] is '&', '=' or one of '%'
+ * and '+' respectively.
+ */
+#if defined(__AVX2__)
+# define QUERY_BLOCK 32
+static inline void query_block_masks(const unsigned char *str, uint32_t *amp,
+                                     uint32_t *eq, uint32_t *enc)
+{
+    __m256i data = _mm256_loadu_si256((const __m256i *)(const void *)str);
+    *amp         = (uint32_t)_mm256_movemask_epi8(
+        _mm256_cmpeq_epi8(data, _mm256_set1_epi8('&')));
+    *eq = (uint32_t)_mm256_movemask_epi8(
+        _mm256_cmpeq_epi8(data, _mm256_set1_epi8('=')));
+    *enc = (uint32_t)_mm256_movemask_epi8(
+        _mm256_or_si256(_mm256_cmpeq_epi8(data, _mm256_set1_epi8('%')),
+                        _mm256_cmpeq_epi8(data, _mm256_set1_epi8('+'))));
+}
+#elif defined(__SSE2__)
+# define QUERY_BLOCK 16
+static inline void query_block_masks(const unsigned char *str, uint32_t *amp,
+                                     uint32_t *eq, uint32_t *enc)
+{
+    __m128i data = _mm_loadu_si128((const __m128i *)(const void *)str);
+    *amp =
+        (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(data, _mm_set1_epi8('&')));
+    *eq =
+        (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(data, _mm_set1_epi8('=')));
+    *enc = (uint32_t)_mm_movemask_epi8(
+        _mm_or_si128(_mm_cmpeq_epi8(data, _mm_set1_epi8('%')),
+                     _mm_cmpeq_epi8(data, _mm_set1_epi8('+'))));
+}
+#endif
+
+/**
+ * @brief Get the next parameter of a query string
+ *
+ * Each step classifies a whole block; the pair ends at the first '&', the
+ * key at the first '=' before it, and the '%' / '+' bits on either side of
+ * that '=' give the encoded flags.
+ */
+int hwire_query_next(const char *str, size_t len, size_t *pos,
+                     hwire_query_param_t *param)
+{
+    assert(str != NULL || len == 0);
+    assert(pos != NULL);
+    assert(param != NULL);
+    const unsigned char *ustr = (const unsigned char *)str;
+    size_t cur                = *pos;
+    size_t start              = 0;
+    size_t eq                 = SIZE_MAX; // first '=' of the pair
+    unsigned int flags        = 0;
+
+    // skip empty pairs
+    while (cur < len && ustr[cur] == '&') {
+        cur++;
+    }
+    if (cur >= len) {
+        *pos = len;
+        return 0;
+    }
+    start = cur;
+
+#if defined(QUERY_BLOCK)
+    while (cur + QUERY_BLOCK <= len) {
+        uint32_t amp, eqm, enc;
+
+        query_block_masks(ustr + cur, &amp, &eqm, &enc);
+        if (amp) {
+            // only bytes before the '&' belong to this pair
+            uint32_t keep = ((uint32_t)1 << ctz32(amp)) - 1;
+            eqm &= keep;
+            enc &= keep;
+        }
+        if (eq == SIZE_MAX && eqm) {
+            uint32_t before = ((uint32_t)1 << ctz32(eqm)) - 1;
+            eq              = cur + (size_t)ctz32(eqm);
+            if (enc & before) {
+                flags |= HWIRE_QUERY_KEY_ENCODED;
+            }
+            if (enc & ~before & ~((uint32_t)1 << ctz32(eqm))) {
+                flags |= HWIRE_QUERY_VALUE_ENCODED;
+            }
+        } else if (enc) {
+            flags |= (eq == SIZE_MAX) ? HWIRE_QUERY_KEY_ENCODED :
+                                        HWIRE_QUERY_VALUE_ENCODED;
+        }
+        if (amp) {
+            cur += (size_t)ctz32(amp);
+            goto FOUND;
+        }
+        cur += QUERY_BLOCK;
+    }
+#endif
+    for (; cur < len && ustr[cur] != '&'; cur++) {
+        unsigned char c = ustr[cur];
+        if (c == '=' && eq == SIZE_MAX) {
+            eq = cur;
+        } else if (c == '%' || c == '+') {
+            flags |= (eq == SIZE_MAX) ? HWIRE_QUERY_KEY_ENCODED :
+                                        HWIRE_QUERY_VALUE_ENCODED;
+        }
+    }
+
+#if defined(QUERY_BLOCK)
+FOUND:
+#endif
+    param->key.ptr = str + start;
+    if (eq != SIZE_MAX) {
+        param->key.len   = eq - start;
+        param->value.ptr = str + eq + 1;
+        param->value.len = cur - eq - 1;
+        flags |= HWIRE_QUERY_HAS_VALUE;
+    } else {
+        param->key.len   = cur - start;
+        param->value.ptr = str + cur;
+        param->value.len = 0;
+    }
+    param->flags = (uint8_t)flags;
+    *pos         = cur;
+    return 1;
+}
+
+#if defined(QUERY_BLOCK)
+# undef QUERY_BLOCK
+#endif
+
+/** @} */ /* end of URI Functions */
+
 // EOF
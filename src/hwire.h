@@ -30,6 +30,16 @@
 #include <stddef.h>
 #include <stdint.h>
 
+/**
+ * HWIRE_RING is defined when the mirrored ring buffer (hwire_ring_*) is
+ * available, i.e. on POSIX systems with mmap and shared memory objects.
+ * Define HWIRE_NO_RING to leave it out.
+ */
+#if !defined(HWIRE_NO_RING) && !defined(HWIRE_RING) &&                        \
+    (defined(__linux__) || defined(__APPLE__) || defined(__FreeBSD__))
+# define HWIRE_RING
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -67,7 +77,13 @@ typedef enum {
     HWIRE_ENOBUFS   = -14, /**< Buffer overflow (e.g., max_exts exceeded) */
     HWIRE_EKEYLEN   = -15, /**< Key length exceeds buffer size */
     HWIRE_ECALLBACK = -16, /**< Callback returned non-zero */
-    HWIRE_EURI      = -17  /**< Invalid URI character */
+    HWIRE_EURI      = -17, /**< Invalid URI character */
+    HWIRE_ECLTE     = -18, /**< Both Content-Length and Transfer-Encoding */
+    HWIRE_ECLDUP    = -19, /**< Differing Content-Length values */
+    HWIRE_EHDRWS    = -20, /**< Whitespace between field name and colon */
+    HWIRE_EOBSFOLD  = -21, /**< Obsolete line folding (obs-fold) */
+    HWIRE_ETRAILER  = -22, /**< Field not allowed in a trailer section */
+    HWIRE_EPREFACE  = -23  /**< HTTP/2 connection preface received */
 } hwire_code_t;
 
 /** @} */ /* end of Error Codes */
@@ -78,9 +94,120 @@ typedef enum {
  */
 
 #define HWIRE_MAX_CHUNKSIZE UINT32_MAX
+#define HWIRE_MAX_BOUNDARY  70 /**< Multipart boundary (RFC 2046 5.1.1) */
 
 /** @} */ /* end of Maximum Values */
 
+/**
+ * @name Framing Flags
+ *
+ * Bits of hwire_framing_t.flags.
+ * @{
+ */
+
+#define HWIRE_FRAMING_CONTENT_LENGTH    0x01 /**< Content-Length present */
+#define HWIRE_FRAMING_TRANSFER_ENCODING 0x02 /**< Transfer-Encoding present */
+#define HWIRE_FRAMING_CHUNKED           0x04 /**< Final coding is chunked */
+#define HWIRE_FRAMING_CLOSE             0x08 /**< Connection: close */
+#define HWIRE_FRAMING_KEEP_ALIVE        0x10 /**< Connection: keep-alive */
+#define HWIRE_FRAMING_UPGRADE           0x20 /**< Connection: upgrade */
+#define HWIRE_FRAMING_WEBSOCKET         0x40 /**< Upgrade: websocket */
+#define HWIRE_FRAMING_H2C               0x80 /**< Upgrade: h2c */
+#define HWIRE_FRAMING_CONTINUE          0x100 /**< Expect: 100-continue */
+
+/** @} */ /* end of Framing Flags */
+
+/**
+ * @name Scan Flags
+ *
+ * Flags for hwire_scan_message.
+ * @{
+ */
+
+#define HWIRE_SCAN_RESPONSE 0x01 /**< Scan a response instead of a request */
+#define HWIRE_SCAN_HEAD     0x02 /**< Response to a HEAD request */
+#define HWIRE_SCAN_CONNECT  0x04 /**< Response to a CONNECT request */
+#define HWIRE_SCAN_HARDENED 0x08 /**< Same as HWIRE_OPT_HARDENED */
+
+/** @} */ /* end of Scan Flags */
+
+/**
+ * @name Parser Options
+ *
+ * Bits of hwire_ctx_t.options.
+ * @{
+ */
+
+/**
+ * Reject request-smuggling vectors inline (RFC 9112 5.1, 5.2 and 6.3):
+ * Content-Length together with Transfer-Encoding (HWIRE_ECLTE), whitespace
+ * between a field name and its colon (HWIRE_EHDRWS) and obs-fold
+ * (HWIRE_EOBSFOLD).  Differing Content-Length values (HWIRE_ECLDUP) are
+ * always rejected once framing fields are collected, which this option
+ * implies.  Trailer fields that are otherwise dropped fail with
+ * HWIRE_ETRAILER.
+ */
+#define HWIRE_OPT_HARDENED 0x01
+
+/** @} */ /* end of Parser Options */
+
+/**
+ * @name Percent-Decoding Flags
+ *
+ * Flags for hwire_pct_decode and hwire_pct_decode_inplace.
+ * @{
+ */
+
+#define HWIRE_PCT_PLUS         0x01 /**< Decode '+' as SP (form data) */
+#define HWIRE_PCT_REJECT_NUL   0x02 /**< Reject "%00" */
+#define HWIRE_PCT_REJECT_SLASH 0x04 /**< Reject "%2F" (path segments) */
+
+/** @} */ /* end of Percent-Decoding Flags */
+
+/**
+ * @name Query Parameter Flags
+ *
+ * Bits of hwire_query_param_t.flags.
+ * @{
+ */
+
+#define HWIRE_QUERY_KEY_ENCODED   0x01 /**< Key contains '%' or '+' */
+#define HWIRE_QUERY_VALUE_ENCODED 0x02 /**< Value contains '%' or '+' */
+#define HWIRE_QUERY_HAS_VALUE     0x04 /**< Key is followed by '=' */
+
+/** @} */ /* end of Query Parameter Flags */
+
+/**
+ * @name WebSocket Frame Flags
+ *
+ * Bits of hwire_ws_frame_t.flags. FIN and RSV1-3 keep their position in
+ * the first byte of the frame.
+ * @{
+ */
+
+#define HWIRE_WS_FIN    0x80 /**< Final fragment of a message */
+#define HWIRE_WS_RSV1   0x40 /**< Reserved for extensions */
+#define HWIRE_WS_RSV2   0x20 /**< Reserved for extensions */
+#define HWIRE_WS_RSV3   0x10 /**< Reserved for extensions */
+#define HWIRE_WS_MASKED 0x01 /**< Payload is masked (hwire_ws_frame_t.mask) */
+
+/** @} */ /* end of WebSocket Frame Flags */
+
+/**
+ * @name HTTP/2 Frame Flags
+ *
+ * Bits of hwire_h2_frame_t.flags (RFC 9113 Section 6).
+ * @{
+ */
+
+#define HWIRE_H2_FLAG_END_STREAM  0x01 /**< DATA, HEADERS: end of stream */
+#define HWIRE_H2_FLAG_ACK         0x01 /**< SETTINGS, PING: acknowledgment */
+#define HWIRE_H2_FLAG_END_HEADERS 0x04 /**< End of a field block */
+#define HWIRE_H2_FLAG_PADDED      0x08 /**< Pad Length and Padding present */
+#define HWIRE_H2_FLAG_PRIORITY    0x20 /**< HEADERS: priority fields present */
+
+/** @} */ /* end of HTTP/2 Frame Flags */
+
 /**
  * @name Data Structures
  * @{
@@ -103,9 +230,10 @@ typedef struct {
  * User-allocated buffer for storing lowercase-converted keys.
  */
 typedef struct {
-    size_t size; /**< Buffer capacity */
-    size_t len;  /**< Used length (set by function) */
-    char *buf;   /**< User-allocated buffer */
+    size_t size;   /**< Buffer capacity */
+    size_t len;    /**< Used length (set by function) */
+    char *buf;     /**< User-allocated buffer */
+    uint32_t hash; /**< CRC32C of buf[0..len) (set by function) */
 } hwire_buf_t;
 
 /**
@@ -116,25 +244,165 @@ typedef struct {
     hwire_str_t value; /**< Value */
 } hwire_kv_pair_t;
 
+/**
+ * @brief Query string parameter
+ *
+ * Returned by hwire_query_next. key and value reference the query string
+ * and are still percent-encoded; decode them with hwire_pct_decode and
+ * HWIRE_PCT_PLUS only when the corresponding HWIRE_QUERY_*_ENCODED flag is
+ * set.
+ */
+typedef struct {
+    hwire_str_t key;   /**< Key (references input buffer) */
+    hwire_str_t value; /**< Value (references input buffer, empty if none) */
+    uint8_t flags;     /**< HWIRE_QUERY_* bits */
+} hwire_query_param_t;
+
+/**
+ * @brief Element of a comma-separated list
+ *
+ * Returned by hwire_list_next. value references the field value and does
+ * not include the element's parameters.
+ */
+typedef struct {
+    hwire_str_t value; /**< Element (references input buffer) */
+    uint16_t q;        /**< Weight in thousandths (0-1000, 1000 if absent) */
+} hwire_list_elem_t;
+
+/**
+ * @brief Well-known media types
+ *
+ * Identified by hwire_parse_media_type; type and subtype are compared
+ * case-insensitively.
+ */
+typedef enum {
+    HWIRE_MEDIA_OTHER                  = 0,  /**< Any other media type */
+    HWIRE_MEDIA_APPLICATION_JSON       = 1,  /**< application/json */
+    HWIRE_MEDIA_APPLICATION_FORM       = 2,  /**< application/x-www-form-
+                                                urlencoded */
+    HWIRE_MEDIA_APPLICATION_OCTET      = 3,  /**< application/octet-stream */
+    HWIRE_MEDIA_APPLICATION_XML        = 4,  /**< application/xml */
+    HWIRE_MEDIA_APPLICATION_JAVASCRIPT = 5,  /**< application/javascript */
+    HWIRE_MEDIA_APPLICATION_PDF        = 6,  /**< application/pdf */
+    HWIRE_MEDIA_APPLICATION_GRPC       = 7,  /**< application/grpc */
+    HWIRE_MEDIA_APPLICATION_PROBLEM    = 8,  /**< application/problem+json */
+    HWIRE_MEDIA_MULTIPART_FORM_DATA    = 9,  /**< multipart/form-data */
+    HWIRE_MEDIA_MULTIPART_MIXED        = 10, /**< multipart/mixed */
+    HWIRE_MEDIA_MULTIPART_BYTERANGES   = 11, /**< multipart/byteranges */
+    HWIRE_MEDIA_TEXT_PLAIN             = 12, /**< text/plain */
+    HWIRE_MEDIA_TEXT_HTML              = 13, /**< text/html */
+    HWIRE_MEDIA_TEXT_CSS               = 14, /**< text/css */
+    HWIRE_MEDIA_TEXT_JAVASCRIPT        = 15, /**< text/javascript */
+    HWIRE_MEDIA_TEXT_CSV               = 16, /**< text/csv */
+    HWIRE_MEDIA_TEXT_XML               = 17, /**< text/xml */
+    HWIRE_MEDIA_TEXT_EVENT_STREAM      = 18, /**< text/event-stream */
+    HWIRE_MEDIA_IMAGE_PNG              = 19, /**< image/png */
+    HWIRE_MEDIA_IMAGE_JPEG             = 20, /**< image/jpeg */
+    HWIRE_MEDIA_IMAGE_GIF              = 21, /**< image/gif */
+    HWIRE_MEDIA_IMAGE_WEBP             = 22, /**< image/webp */
+    HWIRE_MEDIA_IMAGE_SVG              = 23  /**< image/svg+xml */
+} hwire_media_id_t;
+
+/**
+ * @brief Media type of a Content-Type field value
+ *
+ * Returned by hwire_parse_media_type. type and subtype reference the field
+ * value as sent; id identifies well-known types regardless of case.
+ */
+typedef struct {
+    hwire_str_t type;    /**< Type (references input buffer) */
+    hwire_str_t subtype; /**< Subtype (references input buffer) */
+    hwire_media_id_t id; /**< Well-known type, or HWIRE_MEDIA_OTHER */
+} hwire_media_type_t;
+
 /**
  * @brief Generic key-value array
  *
- * Can be used for parameters, headers, extensions, etc.
+ * Can be used for parameters, extensions, etc.
  */
 typedef struct {
     hwire_kv_pair_t *items; /**< Array (allocated by caller) */
     uint8_t count;          /**< Number of items in the array */
 } hwire_kv_array_t;
 
+/**
+ * @brief Buffer segment
+ *
+ * Output of the serializer and input of the scatter/gather parsers. Same
+ * layout as struct iovec on POSIX systems, so an array of segments can be
+ * passed to writev(2) or taken from readv(2) with a cast.
+ */
+typedef struct {
+    const void *base; /**< Start of the segment */
+    size_t len;       /**< Length of the segment */
+} hwire_iov_t;
+
+/**
+ * @brief Segment array filled by the hwire_serialize_* functions
+ */
+typedef struct {
+    hwire_iov_t *items; /**< Array (allocated by caller) */
+    size_t size;        /**< Capacity of items */
+    size_t count;       /**< Number of segments in use */
+    size_t len;         /**< Total length of all segments */
+} hwire_iov_array_t;
+
 /**
  * @brief Parameter (key-value pair alias)
  */
 typedef hwire_kv_pair_t hwire_param_t;
 
 /**
- * @brief Header field (key-value pair alias)
+ * @brief Header field
+ *
+ * Same layout as hwire_kv_pair_t followed by the hash of the field name.
+ */
+typedef struct {
+    hwire_str_t key;   /**< Field name (references input buffer) */
+    hwire_str_t value; /**< Field value (references input buffer) */
+    uint32_t hash;     /**< CRC32C of the lowercased field name, equal to
+                          hwire_hash_key(key.ptr, key.len); 0 when
+                          ctx->key_lc is not allocated */
+} hwire_header_t;
+
+/**
+ * @brief Header index entry
+ *
+ * One entry per parsed header field, stored in arrival order.
+ */
+typedef struct {
+    hwire_header_t header; /**< Parsed header (key/value reference input) */
+    hwire_str_t name;      /**< Lowercased field name (references
+                              hwire_hdr_index_t.names) */
+    uint8_t next; /**< 1-based index of the next entry with the same name
+                     (0 = last) */
+    uint8_t last; /**< 1-based index of the last entry with the same name
+                     (maintained on the first entry of a name only) */
+} hwire_hdr_entry_t;
+
+/**
+ * @brief Header index built by hwire_parse_headers
+ *
+ * Open-addressing hash table over the parsed header fields. All memory is
+ * supplied by the caller:
+ *   - entries/nentries: one slot per header field
+ *   - buckets/nbuckets: hash slots holding 1-based entry indexes; nbuckets
+ *     must be a power of two greater than nentries
+ *   - names: storage for the lowercased field names
+ *
+ * Fields with the same name (e.g. Set-Cookie) are chained through
+ * hwire_hdr_entry_t.next in arrival order. count and names.len are set by
+ * the parser; the index is reset at the start of every hwire_parse_headers
+ * call.
  */
-typedef hwire_kv_pair_t hwire_header_t;
+typedef struct {
+    hwire_hdr_entry_t *entries; /**< Entry array (allocated by caller) */
+    uint8_t *buckets;           /**< Bucket array (allocated by caller) */
+    hwire_buf_t names;          /**< Lowercased name storage */
+    uint16_t nbuckets;          /**< Number of buckets (power of two) */
+    uint8_t nentries;           /**< Capacity of entries */
+    uint8_t count;              /**< Number of entries (set by function) */
+} hwire_hdr_index_t;
 
 /**
  * @brief Chunk extension (key-value pair alias)
@@ -149,13 +417,32 @@ typedef enum {
     HWIRE_HTTP_V11 = 0x0101  /**< HTTP/1.1 */
 } hwire_http_version_t;
 
+/**
+ * @brief Request-target form (RFC 9112 3.2)
+ */
+typedef enum {
+    HWIRE_TARGET_ORIGIN    = 0, /**< absolute-path [ "?" query ] */
+    HWIRE_TARGET_ABSOLUTE  = 1, /**< absolute-URI (requests to proxies) */
+    HWIRE_TARGET_AUTHORITY = 2, /**< host:port (CONNECT) */
+    HWIRE_TARGET_ASTERISK  = 3  /**< "*" (server-wide OPTIONS) */
+} hwire_target_form_t;
+
 /**
  * @brief HTTP request structure
+ *
+ * path and query are sub-slices of uri located while the request-target is
+ * validated. path is the part of uri before the first '?' (for absolute-form
+ * it still includes scheme and authority); query follows the '?' and has a
+ * NULL ptr when uri contains no '?'. Request-targets never carry a fragment
+ * because '#' is rejected with HWIRE_EURI.
  */
 typedef struct {
     hwire_str_t method;           /**< Method (references input buffer) */
     hwire_str_t uri;              /**< URI (references input buffer) */
     hwire_http_version_t version; /**< HTTP version */
+    hwire_str_t path;             /**< uri before '?' */
+    hwire_str_t query;            /**< uri after '?' (ptr NULL if none) */
+    hwire_target_form_t form;     /**< Form of the request-target */
 } hwire_request_t;
 
 /**
@@ -167,6 +454,45 @@ typedef struct {
     hwire_str_t reason; /**< Reason phrase (references input buffer) */
 } hwire_response_t;
 
+/**
+ * @brief Message body framing
+ *
+ * How the message body is delimited (RFC 9112 6.3).
+ */
+typedef enum {
+    HWIRE_BODY_NONE    = 0, /**< No message body */
+    HWIRE_BODY_LENGTH  = 1, /**< Fixed length (framing.content_length) */
+    HWIRE_BODY_CHUNKED = 2, /**< Chunked transfer coding */
+    HWIRE_BODY_CLOSE   = 3  /**< Delimited by closing the connection */
+} hwire_body_t;
+
+/**
+ * @brief Framing-related header fields
+ *
+ * Content-Length, Transfer-Encoding and the connection semantics of
+ * Connection, Proxy-Connection, Upgrade and Expect as seen in the header
+ * block. Tokens are matched case-insensitively.
+ */
+typedef struct {
+    uint64_t content_length; /**< Content-Length value (valid if
+                                HWIRE_FRAMING_CONTENT_LENGTH is set) */
+    uint16_t flags;          /**< HWIRE_FRAMING_* bits */
+} hwire_framing_t;
+
+/**
+ * @brief Message summary produced by hwire_scan_message
+ */
+typedef struct {
+    hwire_http_version_t version; /**< HTTP version */
+    uint16_t status;              /**< Status code (0 for requests) */
+    hwire_str_t method;     /**< Method (references input buffer; empty for
+                               responses) */
+    hwire_body_t body;      /**< Body framing */
+    int keep_alive;         /**< Non-zero if the connection stays open after
+                               this message (RFC 9112 9.3) */
+    hwire_framing_t framing; /**< Framing-related header fields */
+} hwire_msginfo_t;
+
 /**
  * @brief Parser context
  *
@@ -178,6 +504,11 @@ typedef struct hwire_ctx_st {
     void *uctx;         /**< User context pointer (not used by the library) */
     hwire_buf_t key_lc; /**< Lowercase key buffer; caller must allocate
                            key_lc.buf and set key_lc.size before parsing */
+    hwire_hdr_index_t *hdr_index; /**< Optional header index filled by
+                                     hwire_parse_headers (NULL = disabled) */
+    hwire_framing_t *framing;     /**< Optional framing fields filled by
+                                     hwire_parse_headers (NULL = disabled) */
+    unsigned int options;         /**< HWIRE_OPT_* bits */
 
     /**
      * Called for each parameter parsed by hwire_parse_parameters.
@@ -197,6 +528,7 @@ typedef struct hwire_ctx_st {
 
     /**
      * Called for each chunk extension parsed by hwire_parse_chunksize.
+     * Optional (NULL = extensions are validated and skipped).
      * @param ctx Parser context
      * @param ext Parsed extension (key and value reference input buffer)
      * @return 0 to continue, non-zero to stop (HWIRE_ECALLBACK)
@@ -206,6 +538,7 @@ typedef struct hwire_ctx_st {
 
     /**
      * Called for each header field parsed by hwire_parse_headers.
+     * Optional when hdr_index or framing is set.
      * @param ctx    Parser context (key_lc.buf contains lowercase field name)
      * @param header Parsed header (key.ptr references input buffer)
      * @return 0 to continue, non-zero to stop (HWIRE_ECALLBACK)
@@ -228,8 +561,209 @@ typedef struct hwire_ctx_st {
      * @return 0 to continue, non-zero to stop (HWIRE_ECALLBACK)
      */
     int (*response_cb)(struct hwire_ctx_st *ctx, hwire_response_t *rsp);
+
+    /**
+     * Called by hwire_msg_parse for each slice of the message body.
+     * Optional (NULL = body is skipped). For chunked messages the slices
+     * contain chunk-data only.
+     * @param ctx  Parser context
+     * @param data Body bytes (references input buffer)
+     * @param len  Number of bytes (never 0)
+     * @return 0 to continue, non-zero to stop (HWIRE_ECALLBACK)
+     */
+    int (*body_cb)(struct hwire_ctx_st *ctx, const char *data, size_t len);
+
+    /**
+     * Called by hwire_multipart_parse at the start of each body part,
+     * before the header_cb calls for its header section.
+     * Optional (NULL = not called).
+     * @param ctx Parser context
+     * @return 0 to continue, non-zero to stop (HWIRE_ECALLBACK)
+     */
+    int (*part_cb)(struct hwire_ctx_st *ctx);
 } hwire_ctx_t;
 
+/**
+ * @brief Message parser state
+ */
+typedef enum {
+    HWIRE_MSG_HEAD       = 0, /**< Start line and header section */
+    HWIRE_MSG_BODY       = 1, /**< Content-Length body */
+    HWIRE_MSG_CHUNK_SIZE = 2, /**< chunk-size line */
+    HWIRE_MSG_CHUNK_DATA = 3, /**< chunk-data */
+    HWIRE_MSG_CHUNK_EOL  = 4, /**< CRLF after chunk-data */
+    HWIRE_MSG_TRAILER    = 5, /**< Trailer section */
+    HWIRE_MSG_CLOSE_BODY = 6, /**< Close-delimited body */
+    HWIRE_MSG_DONE       = 7  /**< Message complete */
+} hwire_msg_state_t;
+
+/**
+ * @brief HTTP/1.x message parser
+ *
+ * Incremental parser for one complete message (head and body) on top of
+ * the hwire_parse_* functions. Initialize with hwire_msg_init before each
+ * message; all fields except the limits are managed by hwire_msg_parse.
+ */
+typedef struct {
+    hwire_msginfo_t info; /**< Message summary (valid after the head) */
+    uint64_t remaining;   /**< Bytes left in the current body or chunk */
+    size_t maxlen;        /**< Maximum line / header length */
+    uint8_t maxnhdrs;     /**< Maximum number of headers and trailers */
+    uint8_t maxexts;      /**< Maximum number of chunk extensions */
+    uint8_t ntrailers;    /**< Trailer fields parsed so far */
+    uint8_t flags;        /**< HWIRE_SCAN_* flags */
+    uint8_t state;        /**< hwire_msg_state_t */
+} hwire_msg_parser_t;
+
+/**
+ * @brief Multipart parser state
+ */
+typedef enum {
+    HWIRE_MULTIPART_START    = 0, /**< Start of the body */
+    HWIRE_MULTIPART_PREAMBLE = 1, /**< Preamble before the first delimiter */
+    HWIRE_MULTIPART_HEADERS  = 2, /**< Header section of a body part */
+    HWIRE_MULTIPART_BODY     = 3, /**< Body of a body part */
+    HWIRE_MULTIPART_DONE     = 4  /**< After the close-delimiter */
+} hwire_multipart_state_t;
+
+/**
+ * @brief Streaming multipart body parser
+ *
+ * Initialize with hwire_multipart_init; the boundary is copied, so it need
+ * not outlive the header section it was taken from.
+ */
+typedef struct {
+    char delim[HWIRE_MAX_BOUNDARY + 4]; /**< CRLF "--" boundary */
+    size_t maxlen;                      /**< Maximum header length */
+    uint8_t dlen;                       /**< Length of delim */
+    uint8_t maxnhdrs;                   /**< Maximum headers per part */
+    uint8_t state;                      /**< hwire_multipart_state_t */
+} hwire_multipart_t;
+
+/**
+ * @brief WebSocket opcode (RFC 6455 5.2)
+ */
+typedef enum {
+    HWIRE_WS_CONTINUATION = 0x0, /**< Continuation of a fragmented message */
+    HWIRE_WS_TEXT         = 0x1, /**< Text (UTF-8) data */
+    HWIRE_WS_BINARY       = 0x2, /**< Binary data */
+    HWIRE_WS_CLOSE        = 0x8, /**< Connection close */
+    HWIRE_WS_PING         = 0x9, /**< Ping */
+    HWIRE_WS_PONG         = 0xA  /**< Pong */
+} hwire_ws_opcode_t;
+
+/**
+ * @brief WebSocket frame header
+ *
+ * Filled by hwire_ws_parse_frame. The payload follows the header in the
+ * input and is not copied.
+ */
+typedef struct {
+    uint64_t len;    /**< Payload length */
+    uint8_t mask[4]; /**< Masking key (valid if HWIRE_WS_MASKED is set) */
+    uint8_t flags;   /**< HWIRE_WS_* frame flags */
+    uint8_t opcode;  /**< hwire_ws_opcode_t */
+} hwire_ws_frame_t;
+
+/**
+ * @brief HPACK dynamic table entry
+ */
+typedef struct {
+    uint32_t off;  /**< Offset of the name in hwire_hpack_t.table */
+    uint32_t nlen; /**< Name length; the value follows the name */
+    uint32_t vlen; /**< Value length */
+    uint32_t hash; /**< CRC32C of the name */
+} hwire_hpack_entry_t;
+
+/**
+ * @brief HPACK decoder
+ *
+ * Decoding context for the header blocks of one HTTP/2 connection
+ * direction. All memory is supplied by the caller:
+ *   - entries/nentries: ring of dynamic table entries; at least
+ *     max_size / 32 slots
+ *   - table: ring holding the names and values of the dynamic table; at
+ *     least 2 * max_size bytes, so an entry never wraps around its end
+ *   - scratch: output of Huffman decoding for one field line
+ *
+ * Set these fields, then call hwire_hpack_init. The other fields are
+ * managed by the decoder.
+ */
+typedef struct {
+    hwire_hpack_entry_t *entries; /**< Entry ring (allocated by caller) */
+    hwire_buf_t table;            /**< Name/value ring (allocated by
+                                     caller) */
+    hwire_buf_t scratch;          /**< Huffman output (allocated by caller) */
+    size_t max_size;              /**< SETTINGS_HEADER_TABLE_SIZE */
+    size_t cap;                   /**< Current maximum table size */
+    size_t size;                  /**< Current table size (RFC 7541 4.1) */
+    uint32_t nentries;            /**< Capacity of entries */
+    uint32_t head;                /**< Slot of the newest entry */
+    uint32_t count;               /**< Number of entries */
+} hwire_hpack_t;
+
+/**
+ * @brief HTTP/2 frame types (RFC 9113 Section 6)
+ */
+typedef enum {
+    HWIRE_H2_DATA          = 0x0, /**< DATA */
+    HWIRE_H2_HEADERS       = 0x1, /**< HEADERS */
+    HWIRE_H2_PRIORITY      = 0x2, /**< PRIORITY (deprecated) */
+    HWIRE_H2_RST_STREAM    = 0x3, /**< RST_STREAM */
+    HWIRE_H2_SETTINGS      = 0x4, /**< SETTINGS */
+    HWIRE_H2_PUSH_PROMISE  = 0x5, /**< PUSH_PROMISE */
+    HWIRE_H2_PING          = 0x6, /**< PING */
+    HWIRE_H2_GOAWAY        = 0x7, /**< GOAWAY */
+    HWIRE_H2_WINDOW_UPDATE = 0x8, /**< WINDOW_UPDATE */
+    HWIRE_H2_CONTINUATION  = 0x9  /**< CONTINUATION */
+} hwire_h2_frame_type_t;
+
+/**
+ * @brief HTTP/2 frame
+ *
+ * Filled by hwire_h2_parse_frame. payload references the input and
+ * excludes the Pad Length, the Padding and the priority fields of HEADERS;
+ * flow control counts len.
+ */
+typedef struct {
+    hwire_str_t payload; /**< Frame payload (references input buffer) */
+    uint32_t len;        /**< Length field of the frame header */
+    uint32_t stream_id;  /**< Stream identifier (reserved bit cleared) */
+    uint8_t type;        /**< hwire_h2_frame_type_t or an extension type */
+    uint8_t flags;       /**< HWIRE_H2_FLAG_* frame flags */
+} hwire_h2_frame_t;
+
+/**
+ * @brief HTTP/2 settings (RFC 9113 Section 6.5.2)
+ *
+ * hwire_h2_settings_init sets the initial values.
+ */
+typedef struct {
+    uint32_t header_table_size;      /**< SETTINGS_HEADER_TABLE_SIZE */
+    uint32_t enable_push;            /**< SETTINGS_ENABLE_PUSH */
+    uint32_t max_concurrent_streams; /**< SETTINGS_MAX_CONCURRENT_STREAMS */
+    uint32_t initial_window_size;    /**< SETTINGS_INITIAL_WINDOW_SIZE */
+    uint32_t max_frame_size;         /**< SETTINGS_MAX_FRAME_SIZE */
+    uint32_t max_header_list_size;   /**< SETTINGS_MAX_HEADER_LIST_SIZE */
+} hwire_h2_settings_t;
+
+#if defined(HWIRE_RING)
+/**
+ * @brief Mirrored ring buffer
+ *
+ * The same size bytes of memory are mapped twice, back to back, so
+ * buf[i] and buf[i + size] are the same byte. Unread data is therefore
+ * always contiguous at buf + head, even when it wraps around the end of
+ * the ring, and can be parsed without compaction.
+ */
+typedef struct {
+    char *buf;   /**< Mapping of 2 * size bytes */
+    size_t size; /**< Capacity, a multiple of the page size */
+    size_t head; /**< Offset of the first unread byte (< size) */
+    size_t len;  /**< Number of unread bytes */
+} hwire_ring_t;
+#endif
+
 /** @} */ /* end of Data Structures */
 
 /**
@@ -287,6 +821,20 @@ size_t hwire_parse_tchar(const char *str, size_t len, size_t *pos);
  */
 size_t hwire_parse_vchar(const char *str, size_t len, size_t *pos);
 
+/**
+ * @brief Hash a header field name
+ *
+ * Computes the CRC32C (Castagnoli) of the ASCII-lowercased bytes of str.
+ * The result equals hwire_header_t.hash for the same field name, so callers
+ * can probe tables populated from parsed headers with literal names in any
+ * letter case.
+ *
+ * @param str String to hash (must not be NULL unless len is 0)
+ * @param len Length of string
+ * @return 32-bit hash value
+ */
+uint32_t hwire_hash_key(const char *str, size_t len);
+
 /** @} */ /* end of Character Validation Functions */
 
 /**
@@ -339,6 +887,93 @@ int hwire_parse_parameters(hwire_ctx_t *ctx, const char *str, size_t len,
                            size_t *pos, size_t maxlen, uint8_t maxnparams,
                            int skip_leading_semicolon);
 
+/**
+ * @brief Parse a Cookie header field value
+ *
+ * Splits a cookie-string into name/value pairs:
+ *   cookie-string = cookie-pair *( ";" SP cookie-pair )
+ *   cookie-pair = cookie-name "=" cookie-value
+ *
+ * Parsing is lenient as recommended for servers: OWS around ';' and '=' is
+ * ignored, empty pairs are skipped, and a pair without '=' is reported with
+ * an empty name. Names are compared case-sensitively. Values are returned
+ * as sent, including any surrounding DQUOTEs. Keys and values reference str.
+ *
+ * If name is not NULL, only the first cookie with that name is stored in
+ * items[0] and parsing stops there; bytes after it are not examined.
+ * cookies->count is then 1 if the cookie was found and 0 otherwise.
+ *
+ * @param str Cookie header field value (must not be NULL unless len is 0)
+ * @param len Length of str
+ * @param cookies Output: items must hold maxcookies entries; count is set
+ * @param maxcookies Maximum number of pairs to store
+ * @param name Cookie name to look up, or NULL to store all pairs
+ * @return HWIRE_OK on success (also when name was not found)
+ * @return HWIRE_EILSEQ if a pair contains a control character other than HT
+ * @return HWIRE_ENOBUFS if more than maxcookies pairs are present
+ * @see RFC 6265 Section 4.2.1 Cookie Syntax
+ * @see RFC 6265 Section 5.4 The Cookie Header
+ */
+int hwire_parse_cookie(const char *str, size_t len, hwire_kv_array_t *cookies,
+                       uint8_t maxcookies, const hwire_str_t *name);
+
+/**
+ * @brief Get the next element of a comma-separated list
+ *
+ * Iterates a field value using the list grammar:
+ *   #element = [ element ] *( OWS "," OWS [ element ] )
+ *   element = value *( OWS ";" OWS [ parameter ] )
+ *
+ * Empty elements are skipped and OWS around each element is removed. Commas
+ * inside quoted-strings do not split elements. A "q" parameter (any letter
+ * case) is parsed as a weight into elem->q; every other parameter is passed
+ * to ctx->param_cb, with the lowercased name in ctx->key_lc when it is
+ * allocated. ctx may be NULL, or have no param_cb, to ignore them.
+ *
+ * @param ctx Parser context, or NULL
+ * @param str Field value (must not be NULL unless len is 0)
+ * @param len Length of str
+ * @param pos Input: start offset, Output: end offset (must not be NULL; 0
+ * to start)
+ * @param elem Output: next element (must not be NULL)
+ * @return 1 if an element was stored, 0 at the end of the list
+ * @return HWIRE_EILSEQ for invalid byte sequence or qvalue
+ * @return HWIRE_EKEYLEN if key length exceeds ctx->key_lc.size
+ * @return HWIRE_ECALLBACK if callback returned non-zero
+ * @see RFC 9110 Section 5.6.1 Lists
+ * @see RFC 9110 Section 12.4.2 Quality Values
+ */
+int hwire_list_next(hwire_ctx_t *ctx, const char *str, size_t len,
+                    size_t *pos, hwire_list_elem_t *elem);
+
+/**
+ * @brief Parse a media type, e.g. a Content-Type field value
+ *
+ *   media-type = type "/" subtype parameters
+ *   type = token
+ *   subtype = token
+ *
+ * type and subtype are lowercased while they are validated and looked up
+ * in a table of well-known media types. The parameters are then parsed with
+ * hwire_parse_parameters and passed to ctx->param_cb, with the lowercased
+ * name in ctx->key_lc when it is allocated. str must be the whole field
+ * value with OWS already removed (e.g. as reported by header_cb).
+ *
+ * @param ctx Parser context with param_cb set (must not be NULL)
+ * @param str Field value (must not be NULL unless len is 0)
+ * @param len Length of str
+ * @param mt Output: type, subtype and id (must not be NULL)
+ * @param maxnparams Maximum number of parameters
+ * @return HWIRE_OK on success
+ * @return HWIRE_EILSEQ if str is not a valid media type
+ * @return HWIRE_EKEYLEN if a parameter name exceeds ctx->key_lc.size
+ * @return HWIRE_ECALLBACK if callback returned non-zero
+ * @return HWIRE_ENOBUFS if number of parameters exceeds maxnparams
+ * @see RFC 9110 Section 8.3.1 Media Type
+ */
+int hwire_parse_media_type(hwire_ctx_t *ctx, const char *str, size_t len,
+                           hwire_media_type_t *mt, uint8_t maxnparams);
+
 /** @} */ /* end of String Parsing Functions */
 
 /**
@@ -375,7 +1010,21 @@ int hwire_parse_chunksize(hwire_ctx_t *ctx, const char *str, size_t len,
  * @brief Parse HTTP headers
  *
  * Parses headers according to RFC 7230 until empty line (CRLF) is encountered.
- * Calls header_cb for each parsed header.
+ * Calls header_cb for each parsed header. When ctx->key_lc is allocated,
+ * header->hash holds the CRC32C of the lowercased name computed while it was
+ * copied into key_lc. When ctx->hdr_index is set, each header is also added
+ * to the index before header_cb is called.
+ *
+ * When ctx->framing is set it is reset and filled while the headers are
+ * parsed: Content-Length is converted to a 64-bit integer (repeated fields
+ * must agree), the final Transfer-Encoding coding is checked for "chunked",
+ * and the close / keep-alive / upgrade options of Connection (or
+ * Proxy-Connection), the websocket / h2c protocols of Upgrade and
+ * Expect: 100-continue are recorded as HWIRE_FRAMING_* bits.
+ *
+ * With HWIRE_OPT_HARDENED in ctx->options the framing fields are collected
+ * even without ctx->framing, and the request-smuggling checks described for
+ * that option are applied in the same pass.
  *
  * @param str String to parse (must not be NULL)
  * @param len Maximum length of string
@@ -383,21 +1032,75 @@ int hwire_parse_chunksize(hwire_ctx_t *ctx, const char *str, size_t len,
  * be NULL)
  * @param maxlen Maximum individual header length
  * @param maxnhdrs Maximum number of headers
- * @param ctx Parser context (key_lc must be allocated, header_cb must not be
- * NULL)
+ * @param ctx Parser context (key_lc must be allocated; header_cb must not be
+ * NULL unless hdr_index or framing is set)
  * @return HWIRE_OK on success, empty line consumed
  * @return HWIRE_EAGAIN if more data needed
  * @return HWIRE_EHDRNAME for invalid header name
- * @return HWIRE_EHDRVALUE for invalid header value
+ * @return HWIRE_EHDRVALUE for invalid header value, or an invalid
+ * Content-Length when framing fields are collected
  * @return HWIRE_EHDRLEN if header length exceeds maxlen
  * @return HWIRE_EEOL if end-of-line in header value is invalid (CR without LF)
- * @return HWIRE_ENOBUFS if header count exceeds maxnhdrs
+ * @return HWIRE_ENOBUFS if header count exceeds maxnhdrs, or ctx->hdr_index
+ * has no room for another entry or name
+ * @return HWIRE_ERANGE if Content-Length exceeds 64 bits when framing fields
+ * are collected
+ * @return HWIRE_ECLDUP for differing Content-Length values when framing
+ * fields are collected
+ * @return HWIRE_ECLTE, HWIRE_EHDRWS or HWIRE_EOBSFOLD with HWIRE_OPT_HARDENED
  * @return HWIRE_EKEYLEN if key length exceeds ctx->key_lc.size
  * @return HWIRE_ECALLBACK if callback returned non-zero
  */
 int hwire_parse_headers(hwire_ctx_t *ctx, const char *str, size_t len,
                         size_t *pos, size_t maxlen, uint8_t maxnhdrs);
 
+/**
+ * @brief Parse a chunked trailer section
+ *
+ * Parses the field lines that follow the last chunk, up to and including
+ * the empty line, with the field-line rules of hwire_parse_headers:
+ *   trailer-section = *( field-line CRLF )
+ *
+ * Each field is passed to header_cb (if not NULL). Fields that RFC 9110
+ * 6.5.1 forbids in trailers (framing, routing, request modifiers,
+ * authentication, response control data, content processing and
+ * connection-specific fields such as Content-Length, Host, Authorization,
+ * Cache-Control, Content-Type or Connection) are dropped without a
+ * callback; with HWIRE_OPT_HARDENED in ctx->options they fail with
+ * HWIRE_ETRAILER instead. Callers that only accept specific trailers
+ * (e.g. grpc-status) can filter further in header_cb.
+ *
+ * Parsing resumes across fragments: on HWIRE_EAGAIN, *pos is the end of the
+ * last complete field line and those fields have already been reported.
+ * Call again with the remaining bytes followed by new data and the same
+ * *nfields; completed lines are neither rescanned nor reported twice.
+ *
+ * @param ctx Parser context (must not be NULL; header_cb is optional)
+ * @param str String to parse (must not be NULL unless len is 0)
+ * @param len Length of string
+ * @param pos Output: bytes consumed from str[0] (must not be NULL)
+ * @param maxlen Maximum length of each field line
+ * @param maxnfields Maximum number of trailer fields
+ * @param nfields Input/Output: fields parsed by earlier calls for this
+ * section (must not be NULL; 0 at the start of the section)
+ * @return HWIRE_OK on success, *pos is after the empty line
+ * @return HWIRE_EAGAIN if more data needed
+ * @return HWIRE_EHDRNAME for invalid field name
+ * @return HWIRE_EHDRVALUE for invalid field value
+ * @return HWIRE_EHDRLEN if a field line exceeds maxlen
+ * @return HWIRE_EEOL if end-of-line in a field value is invalid
+ * @return HWIRE_ENOBUFS if the number of fields exceeds maxnfields
+ * @return HWIRE_ETRAILER, HWIRE_EHDRWS or HWIRE_EOBSFOLD with
+ * HWIRE_OPT_HARDENED
+ * @return HWIRE_EKEYLEN if key length exceeds ctx->key_lc.size
+ * @return HWIRE_ECALLBACK if callback returned non-zero
+ * @see RFC 9110 Section 6.5 Trailer Fields
+ * @see RFC 9112 Section 7.1.2 Chunked Trailer Section
+ */
+int hwire_parse_trailers(hwire_ctx_t *ctx, const char *str, size_t len,
+                         size_t *pos, size_t maxlen, uint8_t maxnfields,
+                         uint8_t *nfields);
+
 /**
  * @brief Parse HTTP request
  *
@@ -409,7 +1112,8 @@ int hwire_parse_headers(hwire_ctx_t *ctx, const char *str, size_t len,
  * @param pos Output: bytes consumed from str[0] (must not be NULL)
  * @param maxlen Maximum message length
  * @param maxnhdrs Maximum number of headers
- * @param ctx Parser context (request_cb and header_cb must not be NULL)
+ * @param ctx Parser context (request_cb must not be NULL; header_cb must not be
+ * NULL unless hdr_index or framing is set)
  * @return HWIRE_OK on success
  * @return HWIRE_EAGAIN if more data needed
  * @return HWIRE_EMETHOD for invalid method (not tchar or missing SP)
@@ -423,6 +1127,11 @@ int hwire_parse_headers(hwire_ctx_t *ctx, const char *str, size_t len,
  * @return HWIRE_EKEYLEN if key length exceeds ctx->key_lc.size
  * @return HWIRE_ECALLBACK if callback returned non-zero
  * @return HWIRE_ENOBUFS if header count exceeds maxnhdrs
+ * @return HWIRE_ERANGE if Content-Length exceeds 64 bits (ctx->framing set)
+ * @return HWIRE_ECLDUP, HWIRE_ECLTE, HWIRE_EHDRWS or HWIRE_EOBSFOLD as for
+ * hwire_parse_headers
+ * @return HWIRE_EPREFACE if str starts with the HTTP/2 connection preface
+ * (HWIRE_H2_PREFACE); pos is set past it and request_cb is not called
  */
 int hwire_parse_request(hwire_ctx_t *ctx, const char *str, size_t len,
                         size_t *pos, size_t maxlen, uint8_t maxnhdrs);
@@ -438,7 +1147,8 @@ int hwire_parse_request(hwire_ctx_t *ctx, const char *str, size_t len,
  * @param pos Output: bytes consumed from str[0] (must not be NULL)
  * @param maxlen Maximum message length
  * @param maxnhdrs Maximum number of headers
- * @param ctx Parser context (response_cb and header_cb must not be NULL)
+ * @param ctx Parser context (response_cb must not be NULL; header_cb must not
+ * be NULL unless hdr_index or framing is set)
  * @return HWIRE_OK on success
  * @return HWIRE_EAGAIN if more data needed
  * @return HWIRE_ESTATUS for invalid status code
@@ -452,12 +1162,975 @@ int hwire_parse_request(hwire_ctx_t *ctx, const char *str, size_t len,
  * @return HWIRE_EKEYLEN if key length exceeds ctx->key_lc.size
  * @return HWIRE_ECALLBACK if callback returned non-zero
  * @return HWIRE_ENOBUFS if header count exceeds maxnhdrs
+ * @return HWIRE_ERANGE if Content-Length exceeds 64 bits (ctx->framing set)
+ * @return HWIRE_ECLDUP, HWIRE_ECLTE, HWIRE_EHDRWS or HWIRE_EOBSFOLD as for
+ * hwire_parse_headers
  */
 int hwire_parse_response(hwire_ctx_t *ctx, const char *str, size_t len,
                          size_t *pos, size_t maxlen, uint8_t maxnhdrs);
 
+/**
+ * @brief Scan an HTTP message head without callbacks
+ *
+ * Validates the start line and the header block exactly like
+ * hwire_parse_request / hwire_parse_response, but produces no per-header
+ * output. Only Content-Length, Transfer-Encoding and Connection are
+ * examined, and the body framing and persistence of the connection are
+ * resolved according to RFC 9112 6.3 and 9.3:
+ *   - responses to HEAD, 1xx, 204 and 304 have no body
+ *   - 2xx responses to CONNECT have no body and end the HTTP exchange
+ *   - a final "chunked" transfer coding selects HWIRE_BODY_CHUNKED and takes
+ *     precedence over Content-Length; a request with both is not persistent
+ *   - an HTTP/1.0 message with Transfer-Encoding is not persistent, even
+ *     with "Connection: keep-alive" (RFC 9112 6.1)
+ *   - any other transfer coding makes a response close-delimited and a
+ *     request invalid
+ *   - otherwise Content-Length gives the body length; without it a request
+ *     has no body and a response is close-delimited
+ *
+ * HWIRE_SCAN_HARDENED applies the checks of HWIRE_OPT_HARDENED; a message
+ * with both Content-Length and Transfer-Encoding is then rejected.
+ *
+ * On success *pos is the length of the message head including the empty
+ * line, i.e. the offset of the first body byte.
+ *
+ * @param str String to parse (must not be NULL)
+ * @param len Length of string
+ * @param pos Output: bytes consumed from str[0] (must not be NULL)
+ * @param maxlen Maximum length of the request-target, reason-phrase and of
+ * each header
+ * @param maxnhdrs Maximum number of headers
+ * @param flags HWIRE_SCAN_* flags
+ * @param info Output: message summary (must not be NULL)
+ * @return HWIRE_OK on success
+ * @return HWIRE_EAGAIN if more data needed
+ * @return HWIRE_EHDRVALUE for an invalid Content-Length, or a request whose
+ * final transfer coding is not chunked
+ * @return HWIRE_ERANGE if Content-Length does not fit in 64 bits
+ * @return HWIRE_ECLDUP for differing Content-Length values
+ * @return HWIRE_ECLTE, HWIRE_EHDRWS or HWIRE_EOBSFOLD with
+ * HWIRE_SCAN_HARDENED
+ * @return Any other error returned by hwire_parse_request or
+ * hwire_parse_response, except HWIRE_EKEYLEN and HWIRE_ECALLBACK
+ */
+int hwire_scan_message(const char *str, size_t len, size_t *pos,
+                       size_t maxlen, uint8_t maxnhdrs, unsigned int flags,
+                       hwire_msginfo_t *info);
+
 /** @} */ /* end of HTTP Parsing Functions */
 
+/**
+ * @name Scatter/Gather Parsing Functions
+ * @{
+ *
+ * Variants of the HTTP parsers that take the input as a sequence of
+ * segments (e.g. the struct iovec array of a readv() call, cast to
+ * hwire_iov_t, or a ring buffer that wraps) instead of one contiguous
+ * string. Lines are parsed in place in their
+ * segment; only a line that crosses a segment boundary is copied into the
+ * caller's stitch buffer, and the strings reported for that line point into
+ * stitch. Each boundary splits at most one line, so a stitch of
+ * (iovcnt - 1) times the longest line of the head is always large enough.
+ *
+ * Strings passed to callbacks stay valid while both the segments and stitch
+ * do. On HWIRE_EAGAIN call again with all segments, including the new data;
+ * as with the contiguous parsers the head is parsed again from the start.
+ */
+
+/**
+ * @brief Parse HTTP headers from a sequence of segments
+ *
+ * Same as hwire_parse_headers with the input given as iov[0..iovcnt).
+ * Empty segments are allowed.
+ *
+ * @param ctx Parser context (as for hwire_parse_headers)
+ * @param iov Input segments (must not be NULL unless iovcnt is 0)
+ * @param iovcnt Number of segments
+ * @param pos Output: bytes consumed from all segments after the empty line
+ * (must not be NULL)
+ * @param maxlen Maximum individual header length
+ * @param maxnhdrs Maximum number of headers
+ * @param stitch Buffer for lines that cross segments (must not be NULL;
+ * stitch->len is reset on entry). Such a line is copied whole, from its
+ * start in one segment to its LF, once per call; with many boundaries in
+ * long lines the copies can cost as much as the parsing.
+ * @return HWIRE_ENOBUFS if a line that crosses segments does not fit in
+ * stitch
+ * @return Any other value returned by hwire_parse_headers
+ */
+int hwire_parse_headers_iov(hwire_ctx_t *ctx, const hwire_iov_t *iov,
+                            size_t iovcnt, size_t *pos, size_t maxlen,
+                            uint8_t maxnhdrs, hwire_buf_t *stitch);
+
+/**
+ * @brief Parse HTTP request from a sequence of segments
+ *
+ * Same as hwire_parse_request with the input given as iov[0..iovcnt).
+ *
+ * @return HWIRE_ENOBUFS if a line that crosses segments does not fit in
+ * stitch
+ * @return Any other value returned by hwire_parse_request
+ * @see hwire_parse_headers_iov
+ */
+int hwire_parse_request_iov(hwire_ctx_t *ctx, const hwire_iov_t *iov,
+                            size_t iovcnt, size_t *pos, size_t maxlen,
+                            uint8_t maxnhdrs, hwire_buf_t *stitch);
+
+/**
+ * @brief Parse HTTP response from a sequence of segments
+ *
+ * Same as hwire_parse_response with the input given as iov[0..iovcnt).
+ *
+ * @return HWIRE_ENOBUFS if a line that crosses segments does not fit in
+ * stitch
+ * @return Any other value returned by hwire_parse_response
+ * @see hwire_parse_headers_iov
+ */
+int hwire_parse_response_iov(hwire_ctx_t *ctx, const hwire_iov_t *iov,
+                             size_t iovcnt, size_t *pos, size_t maxlen,
+                             uint8_t maxnhdrs, hwire_buf_t *stitch);
+
+/** @} */ /* end of Scatter/Gather Parsing Functions */
+
+/**
+ * @name HTTP Message Functions
+ * @{
+ */
+
+/**
+ * @brief Initialize a message parser
+ *
+ * @param msg Message parser (must not be NULL)
+ * @param flags HWIRE_SCAN_* flags (request or response, and the request
+ * method for responses)
+ * @param maxlen Maximum length of the request-target, reason-phrase, each
+ * header and each chunk-size line
+ * @param maxnhdrs Maximum number of headers, and of trailer fields
+ * @param maxexts Maximum number of extensions per chunk
+ */
+void hwire_msg_init(hwire_msg_parser_t *msg, unsigned int flags,
+                    size_t maxlen, uint8_t maxnhdrs, uint8_t maxexts);
+
+/**
+ * @brief Parse the next fragment of an HTTP message
+ *
+ * Feeds input to the message parser. The head (start line and header
+ * section) is parsed with the same rules and callbacks as
+ * hwire_parse_request / hwire_parse_response; the body framing is then
+ * resolved as described for hwire_scan_message and the body is handed to
+ * body_cb as zero-copy slices of str.
+ *
+ * On HWIRE_EAGAIN, *pos bytes have been consumed. The caller must keep the
+ * remaining bytes and call again with them followed by new data. The head
+ * and each chunk-size line must be complete within one call; until then
+ * nothing of them is consumed and their callbacks may be invoked again on
+ * the next call. Body data is consumed as it arrives, and the trailer
+ * section one field line at a time as described for hwire_parse_trailers.
+ *
+ * On HWIRE_OK the message is complete and *pos is the offset of the next
+ * message (pipelining); call hwire_msg_init before parsing it. Trailer
+ * fields are passed to header_cb (if not NULL) and not added to hdr_index;
+ * fields forbidden in trailers are dropped (or rejected when hardened).
+ *
+ * HWIRE_OPT_HARDENED in ctx->options has the same effect as
+ * HWIRE_SCAN_HARDENED in the flags and also covers the trailer section.
+ *
+ * @param msg Message parser (must not be NULL)
+ * @param ctx Parser context (request_cb or response_cb must not be NULL;
+ * header_cb must not be NULL unless hdr_index is set; body_cb,
+ * chunksize_cb and chunksize_ext_cb are optional)
+ * @param str Input (must not be NULL)
+ * @param len Length of input
+ * @param pos Output: bytes consumed from str[0] (must not be NULL)
+ * @return HWIRE_OK when the message is complete
+ * @return HWIRE_EAGAIN if more data needed
+ * @return HWIRE_EEOL if chunk-data is not followed by CRLF
+ * @return HWIRE_ECALLBACK if a callback returned non-zero
+ * @return Any error of hwire_scan_message, hwire_parse_chunksize or
+ * hwire_parse_trailers
+ */
+int hwire_msg_parse(hwire_msg_parser_t *msg, hwire_ctx_t *ctx,
+                    const char *str, size_t len, size_t *pos);
+
+/**
+ * @brief Signal the end of input to a message parser
+ *
+ * Completes a close-delimited body.
+ *
+ * @param msg Message parser (must not be NULL)
+ * @return HWIRE_OK if the message is complete
+ * @return HWIRE_EAGAIN if the message was truncated
+ */
+int hwire_msg_eof(hwire_msg_parser_t *msg);
+
+/** @} */ /* end of HTTP Message Functions */
+
+/**
+ * @name Serialization Functions
+ * @{
+ *
+ * Assemble an HTTP/1.x message head as a list of segments for writev(2)
+ * without copying: names, values, methods and targets are referenced where
+ * they are (e.g. the slices of a parsed hwire_header_t list), and only the
+ * separators, version strings and status lines come from static storage.
+ * Segments that are adjacent in memory are merged, so a field line that is
+ * re-emitted unchanged from the parsed input takes two segments.
+ *
+ * Slices are not validated; they must be valid tokens, field values and
+ * request-targets (e.g. strings accepted by the parser). Each function
+ * appends to out->items and either succeeds or leaves out unchanged.
+ */
+
+/**
+ * @brief Append a request line
+ *
+ * request-line = method SP request-target SP HTTP-version CRLF
+ *
+ * @param out Segment array (must not be NULL)
+ * @param method Method (must not be NULL)
+ * @param target Request-target (must not be NULL)
+ * @param version HTTP version
+ * @return HWIRE_OK on success
+ * @return HWIRE_EVERSION for an unknown version
+ * @return HWIRE_ENOBUFS if out has no room for the segments
+ */
+int hwire_serialize_request_line(hwire_iov_array_t *out,
+                                 const hwire_str_t *method,
+                                 const hwire_str_t *target,
+                                 hwire_http_version_t version);
+
+/**
+ * @brief Append a status line
+ *
+ * status-line = HTTP-version SP status-code SP [ reason-phrase ] CRLF
+ *
+ * Without reason the phrase registered for the status (RFC 9110 15) is
+ * used, or none for other codes. HTTP/1.1 lines with the registered phrase
+ * are preformatted and take a single segment.
+ *
+ * @param out Segment array (must not be NULL)
+ * @param version HTTP version
+ * @param status Status code (100-599)
+ * @param reason Reason phrase, or NULL for the registered one
+ * @return HWIRE_OK on success
+ * @return HWIRE_EVERSION for an unknown version
+ * @return HWIRE_ESTATUS if status is out of range
+ * @return HWIRE_ENOBUFS if out has no room for the segments
+ */
+int hwire_serialize_status_line(hwire_iov_array_t *out,
+                                hwire_http_version_t version, uint16_t status,
+                                const hwire_str_t *reason);
+
+/**
+ * @brief Append a field line
+ *
+ * field-line = field-name ": " field-value CRLF
+ *
+ * @param out Segment array (must not be NULL)
+ * @param name Field name (must not be NULL)
+ * @param value Field value (must not be NULL)
+ * @return HWIRE_OK on success
+ * @return HWIRE_ENOBUFS if out has no room for the segments
+ */
+int hwire_serialize_header(hwire_iov_array_t *out, const hwire_str_t *name,
+                           const hwire_str_t *value);
+
+/**
+ * @brief Append a list of field lines
+ *
+ * @param out Segment array (must not be NULL)
+ * @param headers Fields, e.g. as reported by header_cb (must not be NULL
+ * unless n is 0)
+ * @param n Number of fields
+ * @return HWIRE_OK on success
+ * @return HWIRE_ENOBUFS if out has no room for all fields
+ */
+int hwire_serialize_headers(hwire_iov_array_t *out,
+                            const hwire_header_t *headers, size_t n);
+
+/**
+ * @brief Append the empty line that ends the head
+ *
+ * @param out Segment array (must not be NULL)
+ * @return HWIRE_OK on success
+ * @return HWIRE_ENOBUFS if out has no room for the segment
+ */
+int hwire_serialize_end(hwire_iov_array_t *out);
+
+/** @} */ /* end of Serialization Functions */
+
+/**
+ * @name HTTP-Date Functions
+ * @{
+ *
+ * HTTP-date (RFC 9110 5.6.7) without strftime(3) or strptime(3). Times are
+ * seconds since 1970-01-01T00:00:00Z; leap seconds are not counted.
+ */
+
+/** Length of an IMF-fixdate, e.g. "Sun, 06 Nov 1994 08:49:37 GMT" */
+#define HWIRE_DATE_LEN 29
+
+/**
+ * @brief Format a time as an IMF-fixdate
+ *
+ * @param t Seconds since the epoch
+ * @param buf Output buffer of at least HWIRE_DATE_LEN bytes (must not be
+ * NULL); not NUL-terminated
+ * @return HWIRE_OK on success
+ * @return HWIRE_ERANGE if t is not within the years 1 to 9999
+ */
+int hwire_format_date(int64_t t, char *buf);
+
+/**
+ * @brief Get the current time as an IMF-fixdate, e.g. for a Date field
+ *
+ * The string is formatted once per second and shared by all threads; the
+ * cache is a sequence lock, so readers never block. Without GCC-style
+ * atomic builtins the date is formatted on every call.
+ *
+ * @param buf Output buffer of at least HWIRE_DATE_LEN bytes (must not be
+ * NULL); not NUL-terminated
+ */
+void hwire_date_now(char *buf);
+
+/**
+ * @brief Parse an HTTP-date
+ *
+ * Accepts the IMF-fixdate form and the obsolete rfc850-date and
+ * asctime-date forms. A two-digit rfc850 year that would be more than 50
+ * years in the future is taken to be in the previous century. The day name
+ * is checked but not matched against the date.
+ *
+ * @param str Field value, e.g. of If-Modified-Since (must not be NULL
+ * unless len is 0)
+ * @param len Length of str
+ * @param t Output: seconds since the epoch (must not be NULL)
+ * @return HWIRE_OK on success
+ * @return HWIRE_EILSEQ if str is not a valid HTTP-date, or its year is
+ * outside 1 to 9999 (the range of hwire_format_date)
+ */
+int hwire_parse_date(const char *str, size_t len, int64_t *t);
+
+/**
+ * @brief Parse an HTTP-date against a given current year
+ *
+ * Same as hwire_parse_date, with two-digit rfc850 years resolved against
+ * year instead of the system clock: "31-Dec-99" is in 2099 for a year of
+ * 2049 to 2099, and in 1999 for 2000 to 2048.
+ *
+ * @param str Field value (must not be NULL unless len is 0)
+ * @param len Length of str
+ * @param year Current year, or 0 to use the system clock
+ * @param t Output: seconds since the epoch (must not be NULL)
+ * @return As for hwire_parse_date
+ */
+int hwire_parse_date_at(const char *str, size_t len, unsigned int year,
+                        int64_t *t);
+
+/** @} */ /* end of HTTP-Date Functions */
+
+/**
+ * @name Multipart Functions
+ * @{
+ *
+ * Streaming parser for multipart bodies such as multipart/form-data
+ * (RFC 2046 5.1, RFC 7578). Body parts are handed to body_cb as zero-copy
+ * slices of the input; the delimiter is located with a SIMD filter on its
+ * first and last byte and confirmed with memcmp.
+ */
+
+/**
+ * @brief Initialize a multipart parser
+ *
+ * @param mp Multipart parser (must not be NULL)
+ * @param boundary Boundary, e.g. the boundary parameter of Content-Type
+ * without quotes (must not be NULL)
+ * @param len Length of boundary
+ * @param maxlen Maximum length of each header of a body part
+ * @param maxnhdrs Maximum number of headers of a body part
+ * @return HWIRE_OK on success
+ * @return HWIRE_ERANGE if len is 0 or exceeds HWIRE_MAX_BOUNDARY
+ * @return HWIRE_EILSEQ if boundary contains a byte other than bchars or
+ * ends with a space
+ * @see RFC 2046 Section 5.1.1 Common Syntax
+ */
+int hwire_multipart_init(hwire_multipart_t *mp, const char *boundary,
+                         size_t len, size_t maxlen, uint8_t maxnhdrs);
+
+/**
+ * @brief Parse the next fragment of a multipart body
+ *
+ * The preamble is skipped. For each body part, part_cb is called when its
+ * delimiter line has been read, the header section is parsed with
+ * hwire_parse_headers (so header_cb, hdr_index and framing see the fields
+ * of the part) and the content is passed to body_cb. The CRLF before each
+ * delimiter belongs to the delimiter and is not passed to body_cb.
+ *
+ * On HWIRE_EAGAIN, *pos bytes have been consumed. The caller must keep the
+ * remaining bytes and call again with them followed by new data. Up to
+ * the length of the delimiter minus one bytes at the end of the input are
+ * held back when they may start a delimiter, so a delimiter split across
+ * fragments is found. A header section must be complete within one call;
+ * until then nothing of it is consumed and header_cb may be called again
+ * for its fields on the next call.
+ *
+ * On HWIRE_OK the close-delimiter has been read and *pos is the offset of
+ * the epilogue, which should be discarded.
+ *
+ * @param mp Multipart parser (must not be NULL)
+ * @param ctx Parser context (header_cb must not be NULL unless hdr_index
+ * or framing is set; body_cb and part_cb are optional)
+ * @param str Input (must not be NULL unless len is 0)
+ * @param len Length of input
+ * @param pos Output: bytes consumed from str[0] (must not be NULL)
+ * @return HWIRE_OK when the close-delimiter has been read
+ * @return HWIRE_EAGAIN if more data needed
+ * @return HWIRE_EILSEQ if a delimiter is followed by anything but
+ * transport-padding and CRLF or "--"
+ * @return HWIRE_ELEN if transport-padding exceeds maxlen
+ * @return HWIRE_ECALLBACK if a callback returned non-zero
+ * @return Any error of hwire_parse_headers
+ */
+int hwire_multipart_parse(hwire_multipart_t *mp, hwire_ctx_t *ctx,
+                          const char *str, size_t len, size_t *pos);
+
+/** @} */ /* end of Multipart Functions */
+
+/**
+ * @name WebSocket Functions
+ * @{
+ *
+ * Server side of the WebSocket opening handshake and the framing layer
+ * (RFC 6455). Frames are parsed in place; payloads are unmasked in place
+ * with SIMD where available.
+ */
+
+/** Length of a Sec-WebSocket-Accept value */
+#define HWIRE_WS_ACCEPT_LEN 28
+
+/**
+ * @brief Compute Sec-WebSocket-Accept from Sec-WebSocket-Key
+ *
+ * The key must be the base64 encoding of 16 bytes (24 characters ending
+ * in "=="). The accept value is the base64-encoded SHA-1 of the key
+ * followed by the GUID "258EAFA5-E914-47DA-95CA-C5AB0DC85B11".
+ *
+ * @param key Sec-WebSocket-Key value (must not be NULL)
+ * @param len Length of key
+ * @param accept Output buffer of at least HWIRE_WS_ACCEPT_LEN bytes (must
+ * not be NULL); not NUL-terminated
+ * @return HWIRE_OK on success
+ * @return HWIRE_EILSEQ if key is not a base64-encoded 16-byte value
+ * @see RFC 6455 Section 4.2.2 Sending the Server's Opening Handshake
+ */
+int hwire_ws_accept(const char *key, size_t len, char *accept);
+
+/**
+ * @brief Validate a WebSocket opening handshake request
+ *
+ * Checks the header fields of a request parsed with both ctx->hdr_index
+ * and ctx->framing set:
+ *   - Upgrade contains "websocket" and Connection contains "upgrade"
+ *   - Sec-WebSocket-Version is "13"
+ *   - Sec-WebSocket-Key appears once and is valid for hwire_ws_accept
+ *
+ * The method (GET) and the HTTP version (1.1 or later) are checked by the
+ * caller. On success accept holds the Sec-WebSocket-Accept value for the
+ * 101 (Switching Protocols) response.
+ *
+ * @param ctx Parser context used for the request (hdr_index and framing
+ * must not be NULL)
+ * @param accept Output buffer of at least HWIRE_WS_ACCEPT_LEN bytes (must
+ * not be NULL); not NUL-terminated
+ * @return HWIRE_OK on success
+ * @return HWIRE_EVERSION if Sec-WebSocket-Version is missing or not 13;
+ * the response should be 426 (Upgrade Required) with
+ * "Sec-WebSocket-Version: 13"
+ * @return HWIRE_EHDRVALUE if Upgrade or Connection lacks the token, or
+ * Sec-WebSocket-Key is missing, repeated or invalid
+ * @see RFC 6455 Section 4.2.1 Reading the Client's Opening Handshake
+ */
+int hwire_ws_handshake(const hwire_ctx_t *ctx, char *accept);
+
+/**
+ * @brief Parse a WebSocket frame header
+ *
+ *  0                   1                   2                   3
+ *  0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0 1
+ * +-+-+-+-+-------+-+-------------+-------------------------------+
+ * |F|R|R|R| opcode|M| Payload len |    Extended payload length    |
+ * |I|S|S|S|  (4)  |A|     (7)     |             (16/64)           |
+ * |N|V|V|V|       |S|             |   (if payload len==126/127)   |
+ * | |1|2|3|       |K|             |                               |
+ * +-+-+-+-+-------+-+-------------+ - - - - - - - - - - - - - - - +
+ * |     Extended payload length continued, if payload len == 127  |
+ * + - - - - - - - - - - - - - - - +-------------------------------+
+ * |                               |Masking-key, if MASK set to 1  |
+ * +-------------------------------+-------------------------------+
+ *
+ * Only the header is parsed; the payload starts at str + *pos. The RSV
+ * bits and the MASK bit are reported, not checked: the caller must fail
+ * the connection for RSV bits of no negotiated extension, and a server
+ * for unmasked frames.
+ *
+ * @param str Input (must not be NULL unless len is 0)
+ * @param len Length of input
+ * @param pos Output: length of the frame header (must not be NULL; only
+ * set on success)
+ * @param maxlen Maximum payload length
+ * @param frame Output: frame header (must not be NULL)
+ * @return HWIRE_OK on success
+ * @return HWIRE_EAGAIN if more data needed
+ * @return HWIRE_EILSEQ for a reserved opcode, a fragmented or over 125
+ * bytes long control frame, or a length not in its shortest form
+ * @return HWIRE_ELEN if the payload length exceeds maxlen
+ * @see RFC 6455 Section 5.2 Base Framing Protocol
+ */
+int hwire_ws_parse_frame(const char *str, size_t len, size_t *pos,
+                         uint64_t maxlen, hwire_ws_frame_t *frame);
+
+/**
+ * @brief Unmask a WebSocket payload in place
+ *
+ * XORs data with the masking key. A payload may be unmasked in pieces as
+ * it arrives; offset is the position of data[0] within the payload.
+ *
+ * @param data Payload bytes (must not be NULL unless len is 0)
+ * @param len Number of bytes
+ * @param mask Masking key of the frame (must not be NULL)
+ * @param offset Offset of data within the payload
+ * @see RFC 6455 Section 5.3 Client-to-Server Masking
+ */
+void hwire_ws_unmask(char *data, size_t len, const uint8_t mask[4],
+                     uint64_t offset);
+
+/** @} */ /* end of WebSocket Functions */
+
+/**
+ * @name HPACK Functions
+ * @{
+ *
+ * Header block decoding for HTTP/2 (RFC 7541). Decoded fields are passed
+ * to header_cb as hwire_header_t, like those of hwire_parse_headers.
+ */
+
+/**
+ * @brief Initialize an HPACK decoder
+ *
+ * entries, nentries, table and scratch must be set before the call.
+ *
+ * @param hp HPACK decoder (must not be NULL)
+ * @param max_size Maximum dynamic table size, i.e. the
+ * SETTINGS_HEADER_TABLE_SIZE sent to the peer (4096 by default)
+ * @return HWIRE_OK on success
+ * @return HWIRE_ERANGE if entries or table is too small for max_size, or
+ * max_size exceeds UINT32_MAX
+ */
+int hwire_hpack_init(hwire_hpack_t *hp, size_t max_size);
+
+/**
+ * @brief Decode an HPACK header block
+ *
+ * str must hold a complete header block, i.e. the fragments of a HEADERS
+ * or PUSH_PROMISE frame and its CONTINUATION frames. header_cb is called
+ * for each field line in order. Literals without Huffman coding are passed
+ * as slices of str; other names and values reference the static table,
+ * the dynamic table or scratch, and are valid until header_cb returns.
+ *
+ * If key_lc is allocated it receives the field name and its hash, as with
+ * hwire_parse_headers. Literal field names must be lowercase tokens,
+ * optionally prefixed by ':' for pseudo-header fields; values must not
+ * contain CTL characters other than HT, nor start or end with whitespace.
+ *
+ * Any error leaves the dynamic table out of sync with the peer's encoder;
+ * the connection must then be closed with COMPRESSION_ERROR.
+ *
+ * @param hp HPACK decoder (must not be NULL)
+ * @param ctx Parser context (header_cb must not be NULL)
+ * @param str Header block (must not be NULL unless len is 0)
+ * @param len Length of header block
+ * @param maxlen Maximum length of a field name plus its value
+ * @param maxnhdrs Maximum number of field lines
+ * @return HWIRE_OK on success
+ * @return HWIRE_EILSEQ for a truncated or malformed representation, an
+ * invalid index, invalid Huffman code or a misplaced or too large dynamic
+ * table size update
+ * @return HWIRE_EHDRLEN if a field line exceeds maxlen
+ * @return HWIRE_EHDRNAME if a literal field name is invalid
+ * @return HWIRE_EHDRVALUE if a literal field value is invalid
+ * @return HWIRE_EKEYLEN if a field name exceeds key_lc.size
+ * @return HWIRE_ENOBUFS if there are more than maxnhdrs field lines or
+ * scratch is too small
+ * @return HWIRE_ECALLBACK if header_cb returned non-zero
+ * @see RFC 7541 Section 6 Binary Format
+ */
+int hwire_hpack_decode(hwire_hpack_t *hp, hwire_ctx_t *ctx, const char *str,
+                       size_t len, size_t maxlen, uint8_t maxnhdrs);
+
+/** @} */ /* end of HPACK Functions */
+
+/**
+ * @name HTTP/2 Functions
+ * @{
+ *
+ * Connection preface and frame parsing for HTTP/2 (RFC 9113). Errors map
+ * to the HTTP/2 error codes as follows: HWIRE_ELEN to FRAME_SIZE_ERROR,
+ * HWIRE_EILSEQ to PROTOCOL_ERROR and HWIRE_ERANGE to FLOW_CONTROL_ERROR.
+ *
+ * A server that accepts both HTTP/1.1 and prior-knowledge HTTP/2 on one
+ * port calls hwire_parse_request on the first bytes of a connection; it
+ * returns HWIRE_EPREFACE for the client connection preface.
+ */
+
+#define HWIRE_H2_PREFACE          "PRI * HTTP/2.0\r\n\r\nSM\r\n\r\n"
+#define HWIRE_H2_PREFACE_LEN      24
+#define HWIRE_H2_FRAME_HEADER_LEN 9
+#define HWIRE_H2_MIN_FRAME_SIZE   16384      /**< Initial MAX_FRAME_SIZE */
+#define HWIRE_H2_MAX_FRAME_SIZE   16777215   /**< 2^24 - 1 */
+#define HWIRE_H2_MAX_WINDOW_SIZE  2147483647 /**< 2^31 - 1 */
+
+/**
+ * @brief Set the initial values of HTTP/2 settings
+ *
+ * HEADER_TABLE_SIZE 4096, ENABLE_PUSH 1, INITIAL_WINDOW_SIZE 65535 and
+ * MAX_FRAME_SIZE 16384; MAX_CONCURRENT_STREAMS and MAX_HEADER_LIST_SIZE
+ * are unlimited (UINT32_MAX).
+ *
+ * @param settings Settings (must not be NULL)
+ */
+void hwire_h2_settings_init(hwire_h2_settings_t *settings);
+
+/**
+ * @brief Parse an HTTP/2 frame
+ *
+ * +-----------------------------------------------+
+ * |                 Length (24)                   |
+ * +---------------+---------------+---------------+
+ * |   Type (8)    |   Flags (8)   |
+ * +-+-------------+---------------+-------------------------------+
+ * |R|                 Stream Identifier (31)                      |
+ * +=+=============================================================+
+ * |                   Frame Payload (0...)                      ...
+ * +---------------------------------------------------------------+
+ *
+ * The whole frame must be in str. Frames of the types defined by RFC 9113
+ * are checked for their stream identifier, their length and their
+ * padding; frames of other types are returned for the caller to ignore.
+ * pos is only set on success.
+ *
+ * @param str Input (must not be NULL unless len is 0)
+ * @param len Length of str
+ * @param pos Output: frame length including the header (must not be NULL)
+ * @param maxlen Maximum payload length, i.e. the SETTINGS_MAX_FRAME_SIZE
+ * sent to the peer
+ * @param frame Output: frame (must not be NULL)
+ * @return HWIRE_OK on success
+ * @return HWIRE_EAGAIN if the frame is incomplete
+ * @return HWIRE_ELEN if the length exceeds maxlen or does not fit the type
+ * @return HWIRE_EILSEQ for a stream identifier not allowed for the type,
+ * padding not shorter than the payload, or padding covering the priority
+ * fields of HEADERS or the Promised Stream ID of PUSH_PROMISE
+ * @see RFC 9113 Section 4.1 Frame Format
+ */
+int hwire_h2_parse_frame(const char *str, size_t len, size_t *pos,
+                         uint32_t maxlen, hwire_h2_frame_t *frame);
+
+/**
+ * @brief Parse the complete HTTP/2 frames in a buffer
+ *
+ * Calls hwire_h2_parse_frame until the input ends in an incomplete frame or
+ * *nframes frames are parsed. An invalid frame after the first ends the
+ * batch with HWIRE_OK; parsing again from pos returns its error.
+ *
+ * @param str Input (must not be NULL unless len is 0)
+ * @param len Length of str
+ * @param pos Output: bytes consumed by the parsed frames (must not be NULL)
+ * @param maxlen Maximum payload length
+ * @param frames Output: frames (must not be NULL)
+ * @param nframes Input: capacity of frames, Output: frames parsed (must not
+ * be NULL)
+ * @return HWIRE_OK if at least one frame was parsed
+ * @return HWIRE_EAGAIN if the first frame is incomplete
+ * @return Errors of hwire_h2_parse_frame for the first frame
+ */
+int hwire_h2_parse_frames(const char *str, size_t len, size_t *pos,
+                          uint32_t maxlen, hwire_h2_frame_t *frames,
+                          size_t *nframes);
+
+/**
+ * @brief Apply the parameters of a SETTINGS frame
+ *
+ * Parameters are applied in order and unknown identifiers are ignored. On
+ * error settings is left unchanged. An acknowledgment carries no
+ * parameters.
+ *
+ * @param frame SETTINGS frame (must not be NULL)
+ * @param settings Input: current settings, Output: updated settings (must
+ * not be NULL)
+ * @return HWIRE_OK on success
+ * @return HWIRE_ELEN if the length is not a multiple of 6, or not 0 for an
+ * acknowledgment
+ * @return HWIRE_EILSEQ for ENABLE_PUSH other than 0 or 1, or
+ * MAX_FRAME_SIZE outside 16384 to 16777215
+ * @return HWIRE_ERANGE for INITIAL_WINDOW_SIZE above 2^31 - 1
+ * @see RFC 9113 Section 6.5 SETTINGS
+ */
+int hwire_h2_parse_settings(const hwire_h2_frame_t *frame,
+                            hwire_h2_settings_t *settings);
+
+/**
+ * @brief Parse a WINDOW_UPDATE frame
+ *
+ * @param frame WINDOW_UPDATE frame (must not be NULL)
+ * @param increment Output: Window Size Increment, 1 to 2^31 - 1 (must not
+ * be NULL)
+ * @return HWIRE_OK on success
+ * @return HWIRE_ELEN if the length is not 4
+ * @return HWIRE_EILSEQ if the increment is 0; a stream error for a
+ * stream_id other than 0
+ * @see RFC 9113 Section 6.9 WINDOW_UPDATE
+ */
+int hwire_h2_parse_window_update(const hwire_h2_frame_t *frame,
+                                 uint32_t *increment);
+
+/**
+ * @brief Validate an HTTP/1.1 upgrade request to h2c
+ *
+ * Checks the header fields of a request parsed with both ctx->hdr_index
+ * and ctx->framing set:
+ *   - Upgrade contains "h2c" and Connection contains "upgrade" and
+ *     "http2-settings"
+ *   - HTTP2-Settings appears once and holds the payload of a SETTINGS
+ *     frame in base64url without padding
+ * and applies those settings. On success the server sends 101 (Switching
+ * Protocols) and continues with HTTP/2; the request becomes stream 1.
+ *
+ * @param ctx Parser context used for the request (hdr_index and framing
+ * must not be NULL)
+ * @param settings Input: current settings, Output: updated settings (must
+ * not be NULL)
+ * @return HWIRE_OK on success
+ * @return HWIRE_EHDRVALUE if Upgrade or Connection lacks the token, or
+ * HTTP2-Settings is missing, repeated or not valid base64url
+ * @return HWIRE_EILSEQ if Connection does not list HTTP2-Settings
+ * @return Errors of hwire_h2_parse_settings
+ * @see RFC 7540 Section 3.2 Starting HTTP/2 for "http" URIs
+ */
+int hwire_h2_upgrade(const hwire_ctx_t *ctx, hwire_h2_settings_t *settings);
+
+/** @} */ /* end of HTTP/2 Functions */
+
+#if defined(HWIRE_RING)
+/**
+ * @name Ring Buffer Functions
+ * @{
+ *
+ * Optional receive buffer for keep-alive connections. Data is written into
+ * the free space returned by hwire_ring_wbuf (e.g. with read(2)), committed,
+ * parsed from the contiguous span returned by hwire_ring_rbuf and then
+ * consumed; no bytes are ever moved. Strings passed to callbacks point into
+ * the ring and stay valid until the space they occupy is written again.
+ */
+
+/**
+ * @brief Create a mirrored ring buffer
+ *
+ * Maps an anonymous shared memory object (memfd_create(2) on Linux) twice
+ * into 2 * size bytes of address space. The memory must be released with
+ * hwire_ring_free.
+ *
+ * @param ring Ring buffer to initialize (must not be NULL)
+ * @param size Capacity in bytes, rounded up to a multiple of the page size
+ * @return HWIRE_OK on success
+ * @return HWIRE_ERANGE if size is 0 or too large
+ * @return HWIRE_ENOBUFS if the memory could not be mapped (errno is set)
+ */
+int hwire_ring_init(hwire_ring_t *ring, size_t size);
+
+/**
+ * @brief Release a ring buffer created by hwire_ring_init
+ *
+ * @param ring Ring buffer (must not be NULL)
+ */
+void hwire_ring_free(hwire_ring_t *ring);
+
+/**
+ * @brief Get the free space of a ring buffer
+ *
+ * @param ring Ring buffer (must not be NULL)
+ * @param avail Output: number of writable bytes (must not be NULL)
+ * @return Start of the free space, contiguous for *avail bytes
+ */
+char *hwire_ring_wbuf(hwire_ring_t *ring, size_t *avail);
+
+/**
+ * @brief Append bytes written into the free space to the unread data
+ *
+ * @param ring Ring buffer (must not be NULL)
+ * @param n Number of bytes written (at most the space of hwire_ring_wbuf)
+ */
+void hwire_ring_commit(hwire_ring_t *ring, size_t n);
+
+/**
+ * @brief Get the unread data of a ring buffer
+ *
+ * @param ring Ring buffer (must not be NULL)
+ * @param len Output: number of unread bytes (must not be NULL)
+ * @return Start of the unread data, contiguous for *len bytes
+ */
+const char *hwire_ring_rbuf(const hwire_ring_t *ring, size_t *len);
+
+/**
+ * @brief Discard bytes from the start of the unread data
+ *
+ * @param ring Ring buffer (must not be NULL)
+ * @param n Number of bytes to discard (at most the unread length)
+ */
+void hwire_ring_consume(hwire_ring_t *ring, size_t n);
+
+/**
+ * @brief Feed the unread data of a ring buffer to a message parser
+ *
+ * Calls hwire_msg_parse with the data of hwire_ring_rbuf and consumes the
+ * bytes it reports on HWIRE_OK and HWIRE_EAGAIN. On HWIRE_OK the next
+ * pipelined message starts at the new head; call hwire_msg_init and then
+ * this function again before reading more data.
+ *
+ * @param ring Ring buffer (must not be NULL)
+ * @param msg Message parser (must not be NULL)
+ * @param ctx Parser context, as for hwire_msg_parse
+ * @return HWIRE_ENOBUFS if the ring is full and the message head or a
+ * chunk-size line still does not fit
+ * @return Any other value returned by hwire_msg_parse
+ */
+int hwire_ring_msg_parse(hwire_ring_t *ring, hwire_msg_parser_t *msg,
+                         hwire_ctx_t *ctx);
+
+/** @} */ /* end of Ring Buffer Functions */
+#endif
+
+/**
+ * @name Header Index Functions
+ * @{
+ */
+
+/**
+ * @brief Look up the first header field with the given name
+ *
+ * The name is compared byte-wise against the lowercased field names stored
+ * in the index; no case folding is performed.
+ *
+ * @param idx Header index filled by hwire_parse_headers (must not be NULL)
+ * @param name Lowercase field name (must not be NULL)
+ * @param len Length of name
+ * @return First matching entry in arrival order, or NULL if not found
+ */
+const hwire_hdr_entry_t *hwire_hdr_index_get(const hwire_hdr_index_t *idx,
+                                             const char *name, size_t len);
+
+/**
+ * @brief Get the next header field with the same name
+ *
+ * @param idx Header index filled by hwire_parse_headers (must not be NULL)
+ * @param entry Entry returned by hwire_hdr_index_get or a previous call
+ * (must not be NULL)
+ * @return Next entry with the same name, or NULL if entry is the last one
+ */
+const hwire_hdr_entry_t *hwire_hdr_index_next(const hwire_hdr_index_t *idx,
+                                              const hwire_hdr_entry_t *entry);
+
+/** @} */ /* end of Header Index Functions */
+
+/**
+ * @name URI Functions
+ * @{
+ */
+
+/**
+ * @brief Percent-decode a string into a caller buffer
+ *
+ * Decodes pct-encoded octets (RFC 3986 2.1) and, with HWIRE_PCT_PLUS, '+'
+ * as SP. Runs without escapes are located with SIMD and copied in bulk.
+ * The output is never longer than the input, so a dst->size of len always
+ * suffices. dst->hash is not modified.
+ *
+ * @param str String to decode (e.g. hwire_request_t.path or query)
+ * @param len Length of str
+ * @param dst Output buffer; dst->len is set to the decoded length on success
+ * (must not be NULL)
+ * @param flags HWIRE_PCT_* flags
+ * @return HWIRE_OK on success
+ * @return HWIRE_EILSEQ for '%' not followed by two hex digits, or an octet
+ * rejected by HWIRE_PCT_REJECT_NUL / HWIRE_PCT_REJECT_SLASH
+ * @return HWIRE_ENOBUFS if the decoded string does not fit in dst->size
+ */
+int hwire_pct_decode(const char *str, size_t len, hwire_buf_t *dst,
+                     unsigned int flags);
+
+/**
+ * @brief Percent-decode a caller-owned slice in place
+ *
+ * Same as hwire_pct_decode, writing the result over str->ptr and updating
+ * str->len. The bytes referenced by str must be writable and owned by the
+ * caller; on error their content is unspecified.
+ *
+ * @param str Slice to decode (must not be NULL)
+ * @param flags HWIRE_PCT_* flags
+ * @return HWIRE_OK on success
+ * @return HWIRE_EILSEQ as for hwire_pct_decode
+ */
+int hwire_pct_decode_inplace(hwire_str_t *str, unsigned int flags);
+
+/**
+ * @brief Get the next parameter of a query string
+ *
+ * Iterates over application/x-www-form-urlencoded data (a request query or
+ * a form body): pairs are separated by '&' and split at their first '='.
+ * Empty pairs are skipped; every other pair is returned, so "a" and "a="
+ * differ only in HWIRE_QUERY_HAS_VALUE. No byte is rejected and nothing is
+ * copied; separators and encoded bytes are found with SIMD.
+ *
+ * Start with *pos = 0 and call until 0 is returned:
+ * @code
+ * size_t pos = 0;
+ * hwire_query_param_t p;
+ * while (hwire_query_next(req->query.ptr, req->query.len, &pos, &p)) { ... }
+ * @endcode
+ *
+ * @param str Query string without the leading '?' (may be NULL if len is 0)
+ * @param len Length of str
+ * @param pos Input/Output: scan position (must not be NULL)
+ * @param param Output: next parameter (must not be NULL)
+ * @return 1 if a parameter was returned, 0 at the end of the string
+ */
+int hwire_query_next(const char *str, size_t len, size_t *pos,
+                     hwire_query_param_t *param);
+
+/**
+ * @brief Normalize a request path in place
+ *
+ * Rewrites an absolute path (e.g. hwire_request_t.path of an origin-form
+ * request) in a single forward pass over the caller's buffer:
+ *   - escapes of unreserved characters are decoded and the hex digits of
+ *     the remaining escapes are uppercased (RFC 3986 6.2.2)
+ *   - runs of '/' are collapsed into one
+ *   - "." and ".." segments are removed (RFC 3986 5.2.4), including their
+ *     encoded forms such as "%2E%2E"
+ * A trailing "/", "/." or "/.." leaves the path ending in '/'. The result
+ * is never longer than the input and the work is linear in path->len. The
+ * bytes referenced by path must be writable and owned by the caller; on
+ * error their content is unspecified.
+ *
+ * @param path Path to normalize; path->len is updated (must not be NULL)
+ * @return HWIRE_OK on success
+ * @return HWIRE_EILSEQ if the path does not start with '/' or contains an
+ * invalid escape
+ * @return HWIRE_ERANGE if a ".." segment would climb above the root
+ */
+int hwire_path_normalize(hwire_str_t *path);
+
+/** @} */ /* end of URI Functions */
+
 /** @} */ /* end of hwire */
 
 #ifdef __cplusplus
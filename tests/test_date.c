@@ -0,0 +1,191 @@
+#include "test_helpers.h"
+#include <time.h>
+
+/*
+ * Covers: IMF-fixdate formatting (RFC 9110 §5.6.7).
+ * MUST: the output MUST be the fixed 29-byte layout in GMT.
+ * MUST: dates before 1970 and leap days MUST be formatted correctly.
+ * MUST: times outside the years 1 to 9999 MUST return HWIRE_ERANGE.
+ */
+void test_format_date(void)
+{
+    TEST_START("test_format_date");
+
+    static const struct {
+        int64_t t;
+        const char *date;
+    } cases[] = {
+        {784111777, "Sun, 06 Nov 1994 08:49:37 GMT"},
+        {0, "Thu, 01 Jan 1970 00:00:00 GMT"},
+        {-1, "Wed, 31 Dec 1969 23:59:59 GMT"},
+        {951782400, "Tue, 29 Feb 2000 00:00:00 GMT"},
+        {4107542400, "Mon, 01 Mar 2100 00:00:00 GMT"},
+        {INT64_C(-62135596800), "Mon, 01 Jan 0001 00:00:00 GMT"},
+        {INT64_C(253402300799), "Fri, 31 Dec 9999 23:59:59 GMT"},
+    };
+    char buf[HWIRE_DATE_LEN + 1];
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        buf[HWIRE_DATE_LEN] = '\0';
+        ASSERT_OK(hwire_format_date(cases[i].t, buf));
+        ASSERT(strcmp(buf, cases[i].date) == 0);
+    }
+    ASSERT_EQ(hwire_format_date(INT64_C(-62135596801), buf), HWIRE_ERANGE);
+    ASSERT_EQ(hwire_format_date(INT64_C(253402300800), buf), HWIRE_ERANGE);
+
+    TEST_END();
+}
+
+/*
+ * Covers: the three HTTP-date forms (RFC 9110 §5.6.7).
+ * MUST: IMF-fixdate, rfc850-date and asctime-date MUST be accepted.
+ * MUST: a two-digit year MUST be in the current century unless that is
+ *       more than 50 years in the future (cases resolved in 2026).
+ * MUST: a formatted date MUST parse back to the same time.
+ */
+void test_parse_date(void)
+{
+    TEST_START("test_parse_date");
+
+    static const struct {
+        const char *date;
+        int64_t t;
+    } cases[] = {
+        {"Sun, 06 Nov 1994 08:49:37 GMT", 784111777},
+        {"Sunday, 06-Nov-94 08:49:37 GMT", 784111777},
+        {"Sun Nov  6 08:49:37 1994", 784111777},
+        {"Sun Nov 06 08:49:37 1994", 784111777},
+        {"Friday, 31-Dec-99 23:59:59 GMT", 946684799},
+        {"Wednesday, 01-Jan-20 00:00:00 GMT", 1577836800},
+        // the window boundary: 2076 is 50 years ahead, 2077 more
+        {"Wednesday, 01-Jan-76 00:00:00 GMT", INT64_C(3345062400)},
+        {"Saturday, 01-Jan-77 00:00:00 GMT", 220924800},
+        {"Tue, 29 Feb 2000 00:00:00 GMT", 951782400},
+        {"Thu, 01 Jan 1970 00:00:00 GMT", 0},
+        {"Wed, 31 Dec 1969 23:59:59 GMT", -1},
+        // the day name is not checked against the date
+        {"Mon, 06 Nov 1994 08:49:37 GMT", 784111777},
+    };
+    int64_t t = 0;
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        t = 0;
+        ASSERT_OK(hwire_parse_date_at(cases[i].date, strlen(cases[i].date),
+                                      2026, &t));
+        ASSERT_EQ(t, cases[i].t);
+    }
+
+    // the boundary moves with the current year
+    static const char y99[] = "Friday, 31-Dec-99 00:00:00 GMT";
+    ASSERT_OK(hwire_parse_date_at(y99, sizeof(y99) - 1, 2048, &t));
+    ASSERT_EQ(t, 946598400);
+    ASSERT_OK(hwire_parse_date_at(y99, sizeof(y99) - 1, 2049, &t));
+    ASSERT_EQ(t, INT64_C(4102358400));
+
+    // hwire_parse_date uses the system clock
+    {
+        time_t now    = time(NULL);
+        struct tm *tm = gmtime(&now);
+        int64_t ref   = 0;
+        ASSERT_OK(hwire_parse_date_at(y99, sizeof(y99) - 1,
+                                      (unsigned int)tm->tm_year + 1900, &ref));
+        ASSERT_OK(hwire_parse_date(y99, sizeof(y99) - 1, &t));
+        ASSERT_EQ(t, ref);
+    }
+
+    // every day of 1900 to 2100 round-trips
+    char buf[HWIRE_DATE_LEN];
+    for (int64_t d = -25567; d <= 47482; d++) {
+        int64_t in = d * 86400 + (d % 86400);
+        ASSERT_OK(hwire_format_date(in, buf));
+        ASSERT_OK(hwire_parse_date(buf, sizeof(buf), &t));
+        ASSERT_EQ(t, in);
+    }
+
+    TEST_END();
+}
+
+/*
+ * Covers: malformed HTTP-dates.
+ * MUST: a date that does not match a form exactly MUST return HWIRE_EILSEQ.
+ * MUST: out-of-range fields MUST return HWIRE_EILSEQ, including the year 0
+ *       that hwire_format_date cannot produce.
+ */
+void test_parse_date_errors(void)
+{
+    TEST_START("test_parse_date_errors");
+
+    static const char *const cases[] = {
+        "",
+        "Sun",
+        "Sun, 06 Nov 1994 08:49:37 UTC",
+        "sun, 06 Nov 1994 08:49:37 GMT",
+        "Sun, 06 nov 1994 08:49:37 GMT",
+        "Sun, 6 Nov 1994 08:49:37 GMT ",
+        "Sun,  6 Nov 1994 08:49:37 GMT",
+        "Sun, 06 Nov 1994 08-49-37 GMT",
+        "Sun, 06 Nov 199x 08:49:37 GMT",
+        "Sun, 31 Nov 1994 08:49:37 GMT",
+        "Sun, 00 Nov 1994 08:49:37 GMT",
+        "Sun, 29 Feb 1900 08:49:37 GMT",
+        "Sun, 01 Jan 0000 00:00:00 GMT",
+        "Sun Jan  1 00:00:00 0000",
+        "Sun, 06 Nov 1994 24:00:00 GMT",
+        "Sun, 06 Nov 1994 08:60:00 GMT",
+        "Sun, 06 Nov 1994 08:49:61 GMT",
+        "Sun, 06 Nov 1994 08:49:37 GMT\r",
+        "Sunday, 06 Nov 1994 08:49:37 GMT",
+        "Sunday, 06-Nov-1994 08:49:37 GMT",
+        "Sunnday, 06-Nov-94 08:49:37 GMT",
+        "Sundax, 06-Nov-94 08:49:37 GMT",
+        "Sunday, 06-Nov 94 08:49:37 GMT",
+        "Sun Nov  6 08:49:37 94",
+        "Sun Nov    6 08:49:37 1994",
+        "Sun Nov  x 08:49:37 1994",
+        "Sun Nov 6  08:49:37 1994",
+        "Xyz Nov  6 08:49:37 1994",
+    };
+    int64_t t = 0;
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        ASSERT_EQ(hwire_parse_date(cases[i], strlen(cases[i]), &t),
+                  HWIRE_EILSEQ);
+    }
+
+    TEST_END();
+}
+
+/*
+ * Covers: the per-second cache of the current date.
+ * MUST: hwire_date_now MUST match the formatted current time.
+ */
+void test_date_now(void)
+{
+    TEST_START("test_date_now");
+
+    char now[HWIRE_DATE_LEN];
+    char ref[HWIRE_DATE_LEN];
+
+    for (int i = 0; i < 1000; i++) {
+        // retry if the second changes in between
+        time_t t = time(NULL);
+        hwire_date_now(now);
+        if (time(NULL) != t) {
+            continue;
+        }
+        ASSERT_OK(hwire_format_date((int64_t)t, ref));
+        ASSERT(memcmp(now, ref, HWIRE_DATE_LEN) == 0);
+    }
+
+    TEST_END();
+}
+
+int main(void)
+{
+    test_format_date();
+    test_parse_date();
+    test_parse_date_errors();
+    test_date_now();
+    print_test_summary();
+    return g_tests_failed;
+}
@@ -0,0 +1,502 @@
+#include "test_helpers.h"
+
+// frame header: 24-bit length, type, flags, 31-bit stream identifier
+#define FH(len, type, flags, sid)                                              \
+    "\x00\x00" len type flags "\x00\x00\x00" sid
+
+/*
+ * Covers: RFC 9113 §3.4 HTTP/2 connection preface with prior knowledge.
+ * MUST: the preface MUST return HWIRE_EPREFACE with pos set past it.
+ * MUST: a prefix of the preface MUST return HWIRE_EAGAIN.
+ * MUST: other versions and HTTP/1.x requests MUST be unaffected.
+ */
+void test_h2_preface(void)
+{
+    TEST_START("test_h2_preface");
+
+    hwire_ctx_t ctx = {.request_cb = mock_request_cb,
+                       .header_cb  = mock_header_cb};
+    static const char in[] = HWIRE_H2_PREFACE "\x00\x00\x00\x04";
+    size_t pos             = 0;
+
+    ASSERT_EQ(strlen(HWIRE_H2_PREFACE), HWIRE_H2_PREFACE_LEN);
+    ASSERT_EQ(hwire_parse_request(&ctx, in, sizeof(in) - 1, &pos, 256, 8),
+              HWIRE_EPREFACE);
+    ASSERT_EQ(pos, HWIRE_H2_PREFACE_LEN);
+    for (size_t n = 0; n < HWIRE_H2_PREFACE_LEN; n++) {
+        pos = 0;
+        ASSERT_EQ(hwire_parse_request(&ctx, in, n, &pos, 256, 8),
+                  HWIRE_EAGAIN);
+        ASSERT_EQ(pos, 0);
+    }
+
+    static const struct {
+        const char *req;
+        int rv;
+    } cases[] = {
+        {"PRI * HTTP/2.0\r\n\r\nSM\r\n\r", HWIRE_EAGAIN},
+        {"PRI * HTTP/2.0\r\n\r\nXX\r\n\r\n", HWIRE_EVERSION},
+        {"PRI * HTTP/2.0\r\n\r\n", HWIRE_EAGAIN},
+        {"\r\nPRI * HTTP/2.0\r\n\r\nSM\r\n\r\n", HWIRE_EVERSION},
+        {"GET / HTTP/2.0\r\n\r\n", HWIRE_EVERSION},
+        {"PRI * HTTP/1.1\r\n\r\n", HWIRE_OK},
+        {"GET / HTTP/1.1\r\nHost: a\r\n\r\n", HWIRE_OK},
+    };
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        pos = 0;
+        ASSERT_EQ(hwire_parse_request(&ctx, cases[i].req,
+                                      strlen(cases[i].req), &pos, 256, 8),
+                  cases[i].rv);
+    }
+
+    TEST_END();
+}
+
+/*
+ * Covers: RFC 9113 §4.1 frame format and §6 frame definitions.
+ * MUST: the payload MUST exclude Pad Length, Padding and the HEADERS
+ *       priority fields; len MUST keep the wire length.
+ * MUST: the reserved bit of the stream identifier MUST be ignored.
+ * MUST: frames of unknown types MUST be returned unvalidated.
+ */
+void test_h2_parse_frame(void)
+{
+    TEST_START("test_h2_parse_frame");
+
+    static const struct {
+        const char *in;
+        size_t len;
+        uint8_t type;
+        uint8_t flags;
+        uint32_t sid;
+        size_t off; // payload offset
+        size_t plen;
+    } cases[] = {
+        {FH("\x05", "\x00", "\x01", "\x01") "hello", 14, HWIRE_H2_DATA,
+         HWIRE_H2_FLAG_END_STREAM, 1, 9, 5},
+        {FH("\x08", "\x00", "\x08", "\x03") "\x02" "hello" "\x00\x00", 17,
+         HWIRE_H2_DATA, HWIRE_H2_FLAG_PADDED, 3, 10, 5},
+        {FH("\x01", "\x00", "\x08", "\x03") "\x00", 10, HWIRE_H2_DATA,
+         HWIRE_H2_FLAG_PADDED, 3, 10, 0},
+        {FH("\x03", "\x01", "\x04", "\x01") "\x82\x86\x84", 12,
+         HWIRE_H2_HEADERS, HWIRE_H2_FLAG_END_HEADERS, 1, 9, 3},
+        {FH("\x0a", "\x01", "\x2c", "\x05") "\x01"
+                                            "\x80\x00\x00\x03\x0f"
+                                            "\x82\x86\x84"
+                                            "\x00",
+         19, HWIRE_H2_HEADERS, 0x2c, 5, 15, 3},
+        {FH("\x05", "\x02", "\x00", "\x07") "\x00\x00\x00\x05\x10", 14,
+         HWIRE_H2_PRIORITY, 0, 7, 9, 5},
+        {FH("\x04", "\x03", "\x00", "\x01") "\x00\x00\x00\x08", 13,
+         HWIRE_H2_RST_STREAM, 0, 1, 9, 4},
+        {FH("\x00", "\x04", "\x01", "\x00"), 9, HWIRE_H2_SETTINGS,
+         HWIRE_H2_FLAG_ACK, 0, 9, 0},
+        {FH("\x06", "\x04", "\x00", "\x00") "\x00\x03\x00\x00\x00\x64", 15,
+         HWIRE_H2_SETTINGS, 0, 0, 9, 6},
+        {FH("\x04", "\x05", "\x04", "\x01") "\x00\x00\x00\x02", 13,
+         HWIRE_H2_PUSH_PROMISE, HWIRE_H2_FLAG_END_HEADERS, 1, 9, 4},
+        {FH("\x08", "\x06", "\x00", "\x00") "pingpong", 17, HWIRE_H2_PING, 0,
+         0, 9, 8},
+        {FH("\x0a", "\x07", "\x00", "\x00") "\x00\x00\x00\x00\x00\x00\x00"
+                                            "\x00"
+                                            "hi",
+         19, HWIRE_H2_GOAWAY, 0, 0, 9, 10},
+        {FH("\x04", "\x08", "\x00", "\x00") "\x00\x00\x10\x00", 13,
+         HWIRE_H2_WINDOW_UPDATE, 0, 0, 9, 4},
+        {FH("\x04", "\x08", "\x00", "\x09") "\x00\x00\x10\x00", 13,
+         HWIRE_H2_WINDOW_UPDATE, 0, 9, 9, 4},
+        {FH("\x01", "\x09", "\x04", "\x01") "\xbe", 10, HWIRE_H2_CONTINUATION,
+         HWIRE_H2_FLAG_END_HEADERS, 1, 9, 1},
+        // unknown type: no stream identifier, length or padding rules
+        {FH("\x01", "\x0a", "\xff", "\x00") "x", 10, 0x0a, 0xff, 0, 9, 1},
+    };
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        hwire_h2_frame_t frame;
+        size_t pos = 0;
+
+        ASSERT_OK(hwire_h2_parse_frame(cases[i].in, cases[i].len, &pos,
+                                       HWIRE_H2_MIN_FRAME_SIZE, &frame));
+        ASSERT_EQ(pos, cases[i].len);
+        ASSERT_EQ(frame.len, cases[i].len - HWIRE_H2_FRAME_HEADER_LEN);
+        ASSERT_EQ(frame.type, cases[i].type);
+        ASSERT_EQ(frame.flags, cases[i].flags);
+        ASSERT_EQ(frame.stream_id, cases[i].sid);
+        // the payload references the input
+        ASSERT(frame.payload.ptr == cases[i].in + cases[i].off);
+        ASSERT_EQ(frame.payload.len, cases[i].plen);
+        // every proper prefix is incomplete
+        for (size_t n = 0; n < cases[i].len; n++) {
+            pos = 0;
+            ASSERT_EQ(hwire_h2_parse_frame(cases[i].in, n, &pos,
+                                           HWIRE_H2_MIN_FRAME_SIZE, &frame),
+                      HWIRE_EAGAIN);
+            ASSERT_EQ(pos, 0);
+        }
+    }
+
+    // reserved bit and 24-bit length
+    {
+        static char big[HWIRE_H2_FRAME_HEADER_LEN + 0x10203];
+        hwire_h2_frame_t frame;
+        size_t pos = 0;
+
+        memcpy(big, "\x01\x02\x03\x00\x00\xff\xff\xff\xff", 9);
+        ASSERT_OK(hwire_h2_parse_frame(big, sizeof(big), &pos,
+                                       HWIRE_H2_MAX_FRAME_SIZE, &frame));
+        ASSERT_EQ(pos, sizeof(big));
+        ASSERT_EQ(frame.len, 0x10203);
+        ASSERT_EQ(frame.stream_id, 0x7FFFFFFFu);
+        ASSERT_EQ(hwire_h2_parse_frame(big, sizeof(big), &pos, 0x10202,
+                                       &frame),
+                  HWIRE_ELEN);
+        // the length is checked before the payload arrives
+        ASSERT_EQ(hwire_h2_parse_frame(big, 9, &pos, 0x10202, &frame),
+                  HWIRE_ELEN);
+    }
+
+    TEST_END();
+}
+
+/*
+ * Covers: RFC 9113 §6 connection errors detected from a single frame.
+ * MUST: a frame on the wrong stream or with padding not shorter than its
+ *       payload MUST return HWIRE_EILSEQ (PROTOCOL_ERROR), as MUST padding
+ *       that leaves no room for the priority or promised stream fields.
+ * MUST: a length above maxlen or not allowed for the type MUST return
+ *       HWIRE_ELEN (FRAME_SIZE_ERROR).
+ */
+void test_h2_parse_frame_errors(void)
+{
+    TEST_START("test_h2_parse_frame_errors");
+
+    static const struct {
+        const char *in;
+        size_t len;
+        int rv;
+    } cases[] = {
+        // stream identifier
+        {FH("\x00", "\x00", "\x00", "\x00"), 9, HWIRE_EILSEQ},
+        {FH("\x00", "\x01", "\x04", "\x00"), 9, HWIRE_EILSEQ},
+        {FH("\x05", "\x02", "\x00", "\x00") "\x00\x00\x00\x01\x10", 14,
+         HWIRE_EILSEQ},
+        {FH("\x04", "\x03", "\x00", "\x00") "\x00\x00\x00\x08", 13,
+         HWIRE_EILSEQ},
+        {FH("\x00", "\x04", "\x00", "\x01"), 9, HWIRE_EILSEQ},
+        {FH("\x04", "\x05", "\x00", "\x00") "\x00\x00\x00\x02", 13,
+         HWIRE_EILSEQ},
+        {FH("\x08", "\x06", "\x00", "\x01") "pingpong", 17, HWIRE_EILSEQ},
+        {FH("\x08", "\x07", "\x00", "\x01") "\x00\x00\x00\x00\x00\x00\x00"
+                                            "\x00",
+         17, HWIRE_EILSEQ},
+        {FH("\x00", "\x09", "\x00", "\x00"), 9, HWIRE_EILSEQ},
+        // padding
+        {FH("\x03", "\x00", "\x08", "\x01") "\x03" "ab", 12, HWIRE_EILSEQ},
+        {FH("\x03", "\x01", "\x08", "\x01") "\x05" "ab", 12, HWIRE_EILSEQ},
+        {FH("\x00", "\x00", "\x08", "\x01"), 9, HWIRE_ELEN},
+        {FH("\x06", "\x01", "\x28", "\x01") "\x01\x00\x00\x00\x03\x0f", 15,
+         HWIRE_EILSEQ},
+        {FH("\x05", "\x05", "\x08", "\x01") "\x01\x00\x00\x00\x00", 14,
+         HWIRE_EILSEQ},
+        // lengths
+        {FH("\x04", "\x02", "\x00", "\x01") "\x00\x00\x00\x01", 13,
+         HWIRE_ELEN},
+        {FH("\x05", "\x03", "\x00", "\x01") "\x00\x00\x00\x08\x00", 14,
+         HWIRE_ELEN},
+        {FH("\x05", "\x04", "\x00", "\x00") "\x00\x03\x00\x00\x00", 14,
+         HWIRE_ELEN},
+        {FH("\x06", "\x04", "\x01", "\x00") "\x00\x03\x00\x00\x00\x64", 15,
+         HWIRE_ELEN},
+        {FH("\x04", "\x05", "\x08", "\x01") "\x00\x00\x00\x00", 13,
+         HWIRE_ELEN},
+        {FH("\x07", "\x06", "\x00", "\x00") "pingpon", 16, HWIRE_ELEN},
+        {FH("\x07", "\x07", "\x00", "\x00") "\x00\x00\x00\x00\x00\x00\x00",
+         16, HWIRE_ELEN},
+        {FH("\x03", "\x08", "\x00", "\x00") "\x00\x00\x01", 12, HWIRE_ELEN},
+        {FH("\x04", "\x01", "\x20", "\x01") "\x00\x00\x00\x03", 13,
+         HWIRE_ELEN},
+        {FH("\x05", "\x01", "\x28", "\x01") "\x00\x00\x00\x00\x03", 14,
+         HWIRE_ELEN},
+    };
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        hwire_h2_frame_t frame;
+        size_t pos = SIZE_MAX;
+
+        ASSERT_EQ(hwire_h2_parse_frame(cases[i].in, cases[i].len, &pos,
+                                       HWIRE_H2_MIN_FRAME_SIZE, &frame),
+                  cases[i].rv);
+        ASSERT_EQ(pos, SIZE_MAX);
+    }
+
+    TEST_END();
+}
+
+/*
+ * Covers: walking the frames of a read buffer in one call.
+ * MUST: parsing MUST stop at an incomplete frame or at the capacity of
+ *       frames, with pos set past the last frame parsed.
+ * MUST: an invalid frame after valid ones MUST end the batch with HWIRE_OK
+ *       and be reported by the next call.
+ */
+void test_h2_parse_frames(void)
+{
+    TEST_START("test_h2_parse_frames");
+
+    static const char in[] =
+        FH("\x06", "\x04", "\x00", "\x00") "\x00\x04\x00\x01\x00\x00"
+        FH("\x04", "\x08", "\x00", "\x00") "\x00\x0f\x00\x01"
+        FH("\x02", "\x01", "\x05", "\x01") "\x82\x84"
+        FH("\x03", "\x00", "\x01", "\x01") "abc"
+        FH("\x08", "\x06", "\x00", "\x00") "ping";
+    const size_t len = sizeof(in) - 1;
+    hwire_h2_frame_t frames[8];
+    size_t nframes = 8;
+    size_t pos     = 0;
+
+    ASSERT_OK(hwire_h2_parse_frames(in, len, &pos, HWIRE_H2_MIN_FRAME_SIZE,
+                                    frames, &nframes));
+    ASSERT_EQ(nframes, 4);
+    ASSERT_EQ(pos, len - 13);
+    ASSERT_EQ(frames[0].type, HWIRE_H2_SETTINGS);
+    ASSERT_EQ(frames[1].type, HWIRE_H2_WINDOW_UPDATE);
+    ASSERT_EQ(frames[2].type, HWIRE_H2_HEADERS);
+    ASSERT_EQ(frames[3].type, HWIRE_H2_DATA);
+    ASSERT(memcmp(frames[3].payload.ptr, "abc", 3) == 0);
+
+    // capacity
+    nframes = 2;
+    ASSERT_OK(hwire_h2_parse_frames(in, len, &pos, HWIRE_H2_MIN_FRAME_SIZE,
+                                    frames, &nframes));
+    ASSERT_EQ(nframes, 2);
+    ASSERT_EQ(pos, 28);
+
+    // incomplete first frame
+    nframes = 8;
+    pos     = SIZE_MAX;
+    ASSERT_EQ(hwire_h2_parse_frames(in + len - 13, 13, &pos,
+                                    HWIRE_H2_MIN_FRAME_SIZE, frames,
+                                    &nframes),
+              HWIRE_EAGAIN);
+    ASSERT_EQ(nframes, 0);
+    ASSERT_EQ(pos, SIZE_MAX);
+    ASSERT_EQ(hwire_h2_parse_frames(NULL, 0, &pos, HWIRE_H2_MIN_FRAME_SIZE,
+                                    frames, &nframes),
+              HWIRE_EAGAIN);
+
+    // an error is deferred to the call that starts with it
+    static const char bad[] = FH("\x00", "\x04", "\x01", "\x00")
+        FH("\x00", "\x00", "\x00", "\x00");
+    nframes = 8;
+    ASSERT_OK(hwire_h2_parse_frames(bad, sizeof(bad) - 1, &pos,
+                                    HWIRE_H2_MIN_FRAME_SIZE, frames,
+                                    &nframes));
+    ASSERT_EQ(nframes, 1);
+    ASSERT_EQ(pos, 9);
+    nframes = 8;
+    ASSERT_EQ(hwire_h2_parse_frames(bad + pos, sizeof(bad) - 1 - pos, &pos,
+                                    HWIRE_H2_MIN_FRAME_SIZE, frames,
+                                    &nframes),
+              HWIRE_EILSEQ);
+    ASSERT_EQ(nframes, 0);
+
+    TEST_END();
+}
+
+/*
+ * Covers: RFC 9113 §6.5 SETTINGS and §6.9 WINDOW_UPDATE payloads.
+ * MUST: parameters MUST apply in order and unknown ones MUST be ignored.
+ * MUST: invalid values MUST leave the settings unchanged.
+ * MUST: a zero window increment MUST return HWIRE_EILSEQ.
+ */
+void test_h2_settings(void)
+{
+    TEST_START("test_h2_settings");
+
+    hwire_h2_settings_t st;
+    hwire_h2_frame_t frame = {.type = HWIRE_H2_SETTINGS};
+    uint32_t inc           = 0;
+
+    hwire_h2_settings_init(&st);
+    ASSERT_EQ(st.header_table_size, 4096);
+    ASSERT_EQ(st.enable_push, 1);
+    ASSERT_EQ(st.max_concurrent_streams, UINT32_MAX);
+    ASSERT_EQ(st.initial_window_size, 65535);
+    ASSERT_EQ(st.max_frame_size, 16384);
+    ASSERT_EQ(st.max_header_list_size, UINT32_MAX);
+
+    frame.payload.ptr = "\x00\x01\x00\x00\x10\x00"
+                        "\x00\x02\x00\x00\x00\x00"
+                        "\x00\x03\x00\x00\x00\x64"
+                        "\x00\x04\x7f\xff\xff\xff"
+                        "\x00\x05\x00\xff\xff\xff"
+                        "\x00\x06\x00\x00\x20\x00"
+                        "\x00\x07\x00\x00\x00\x01"
+                        "\x00\x03\x00\x00\x00\x80";
+    frame.payload.len = 48;
+    ASSERT_OK(hwire_h2_parse_settings(&frame, &st));
+    ASSERT_EQ(st.header_table_size, 4096);
+    ASSERT_EQ(st.enable_push, 0);
+    ASSERT_EQ(st.max_concurrent_streams, 128);
+    ASSERT_EQ(st.initial_window_size, 0x7FFFFFFFu);
+    ASSERT_EQ(st.max_frame_size, 0xFFFFFF);
+    ASSERT_EQ(st.max_header_list_size, 8192);
+
+    static const struct {
+        const char *payload;
+        size_t len;
+        uint8_t flags;
+        int rv;
+    } cases[] = {
+        {"\x00\x02\x00\x00\x00\x02", 6, 0, HWIRE_EILSEQ},
+        {"\x00\x04\x80\x00\x00\x00", 6, 0, HWIRE_ERANGE},
+        {"\x00\x05\x00\x00\x3f\xff", 6, 0, HWIRE_EILSEQ},
+        {"\x00\x05\x01\x00\x00\x00", 6, 0, HWIRE_EILSEQ},
+        {"\x00\x03\x00\x00\x00\x01\x00\x05\x00\x00\x00\x00", 12, 0,
+         HWIRE_EILSEQ},
+        {"\x00\x03\x00\x00\x00", 5, 0, HWIRE_ELEN},
+        {"\x00\x03\x00\x00\x00\x01", 6, HWIRE_H2_FLAG_ACK, HWIRE_ELEN},
+    };
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        hwire_h2_settings_t before = st;
+
+        frame.payload.ptr = cases[i].payload;
+        frame.payload.len = cases[i].len;
+        frame.flags       = cases[i].flags;
+        ASSERT_EQ(hwire_h2_parse_settings(&frame, &st), cases[i].rv);
+        ASSERT(memcmp(&before, &st, sizeof(st)) == 0);
+    }
+    frame.payload.len = 0;
+    frame.flags       = HWIRE_H2_FLAG_ACK;
+    ASSERT_OK(hwire_h2_parse_settings(&frame, &st));
+
+    frame.type        = HWIRE_H2_WINDOW_UPDATE;
+    frame.flags       = 0;
+    frame.payload.ptr = "\xff\xff\xff\xff";
+    frame.payload.len = 4;
+    ASSERT_OK(hwire_h2_parse_window_update(&frame, &inc));
+    ASSERT_EQ(inc, 0x7FFFFFFFu);
+    frame.payload.ptr = "\x80\x00\x00\x00";
+    ASSERT_EQ(hwire_h2_parse_window_update(&frame, &inc), HWIRE_EILSEQ);
+    frame.payload.len = 3;
+    ASSERT_EQ(hwire_h2_parse_window_update(&frame, &inc), HWIRE_ELEN);
+    ASSERT_EQ(inc, 0x7FFFFFFFu);
+
+    TEST_END();
+}
+
+/*
+ * Covers: RFC 7540 §3.2 upgrade from HTTP/1.1 to h2c.
+ * MUST: Upgrade: h2c with Connection: Upgrade, HTTP2-Settings (in one or
+ *       more fields) and one HTTP2-Settings field MUST be accepted and its
+ *       settings applied.
+ * MUST: a missing, repeated or malformed HTTP2-Settings MUST return
+ *       HWIRE_EHDRVALUE; invalid settings MUST return their error.
+ * MUST: HTTP2-Settings not listed in Connection MUST return HWIRE_EILSEQ.
+ */
+void test_h2_upgrade(void)
+{
+    TEST_START("test_h2_upgrade");
+
+    static const struct {
+        const char *headers;
+        int rv;
+    } cases[] = {
+        {"Host: server.example.com\r\n"
+         "Connection: Upgrade, HTTP2-Settings\r\n"
+         "Upgrade: h2c\r\n"
+         "HTTP2-Settings: AAMAAABkAAQAoAAAAAIAAAAA\r\n"
+         "\r\n",
+         HWIRE_OK},
+        {"Connection: Upgrade, HTTP2-Settings\r\n"
+         "Upgrade: h2c\r\n"
+         "HTTP2-Settings:\r\n"
+         "\r\n",
+         HWIRE_OK},
+        {"Connection: Upgrade\r\n"
+         "Upgrade: h2c\r\n"
+         "Connection: http2-settings\r\n"
+         "HTTP2-Settings:\r\n"
+         "\r\n",
+         HWIRE_OK},
+        {"Connection: HTTP2-Settings\r\n"
+         "Upgrade: h2c\r\n"
+         "HTTP2-Settings: AAMAAABk\r\n"
+         "\r\n",
+         HWIRE_EHDRVALUE},
+        {"Connection: Upgrade, HTTP2-Settings\r\n"
+         "Upgrade: websocket\r\n"
+         "HTTP2-Settings: AAMAAABk\r\n"
+         "\r\n",
+         HWIRE_EHDRVALUE},
+        {"Connection: Upgrade\r\n"
+         "Upgrade: h2c\r\n"
+         "HTTP2-Settings: AAMAAABk\r\n"
+         "\r\n",
+         HWIRE_EILSEQ},
+        {"Connection: Upgrade, HTTP2-Settings\r\n"
+         "Upgrade: h2c\r\n"
+         "\r\n",
+         HWIRE_EHDRVALUE},
+        {"Connection: Upgrade, HTTP2-Settings\r\n"
+         "Upgrade: h2c\r\n"
+         "HTTP2-Settings: AAMAAABk\r\n"
+         "HTTP2-Settings: AAMAAABk\r\n"
+         "\r\n",
+         HWIRE_EHDRVALUE},
+        {"Connection: Upgrade, HTTP2-Settings\r\n"
+         "Upgrade: h2c\r\n"
+         "HTTP2-Settings: AAMAAAB\r\n"
+         "\r\n",
+         HWIRE_EHDRVALUE},
+        {"Connection: Upgrade, HTTP2-Settings\r\n"
+         "Upgrade: h2c\r\n"
+         "HTTP2-Settings: AAMAAAB+\r\n"
+         "\r\n",
+         HWIRE_EHDRVALUE},
+        {"Connection: Upgrade, HTTP2-Settings\r\n"
+         "Upgrade: h2c\r\n"
+         "HTTP2-Settings: AAIAAAAC\r\n"
+         "\r\n",
+         HWIRE_EILSEQ},
+        {"Connection: Upgrade, HTTP2-Settings\r\n"
+         "Upgrade: h2c\r\n"
+         "HTTP2-Settings: AAT_____\r\n"
+         "\r\n",
+         HWIRE_ERANGE},
+    };
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        hdr_index_fixture_t f;
+        hwire_framing_t fr = {0};
+        const char *h      = cases[i].headers;
+        hwire_h2_settings_t st;
+        size_t pos = 0;
+
+        hdr_index_fixture_init(&f, 0);
+        f.ctx.framing = &fr;
+        hwire_h2_settings_init(&st);
+        ASSERT_OK(hwire_parse_headers(&f.ctx, h, strlen(h), &pos, 256,
+                                      TEST_NENTRIES));
+        ASSERT_EQ(hwire_h2_upgrade(&f.ctx, &st), cases[i].rv);
+        if (i == 0) {
+            ASSERT_EQ(st.max_concurrent_streams, 100);
+            ASSERT_EQ(st.initial_window_size, 0xA00000);
+            ASSERT_EQ(st.enable_push, 0);
+        } else {
+            ASSERT_EQ(st.max_concurrent_streams, UINT32_MAX);
+        }
+    }
+
+    TEST_END();
+}
+
+int main(void)
+{
+    test_h2_preface();
+    test_h2_parse_frame();
+    test_h2_parse_frame_errors();
+    test_h2_parse_frames();
+    test_h2_settings();
+    test_h2_upgrade();
+    print_test_summary();
+    return g_tests_failed;
+}
@@ -0,0 +1,242 @@
+#include "test_helpers.h"
+
+/*
+ * Covers: header index built during hwire_parse_headers.
+ * MUST: every header MUST be indexed in arrival order.
+ * MUST: lookup MUST find fields by lowercased name regardless of the case
+ *       used on the wire.
+ * MUST: header_cb MAY be NULL when hdr_index is set.
+ */
+void test_hdr_index_lookup(void)
+{
+    TEST_START("test_hdr_index_lookup");
+
+    static const char *buf = "Host: example.com\r\n"
+                             "Content-Type: text/html\r\n"
+                             "content-length: 42\r\n"
+                             "X-Custom-Header-With-A-Long-Name: yes\r\n"
+                             "\r\n";
+
+    for (int with_key_lc = 1; with_key_lc >= 0; with_key_lc--) {
+        hdr_index_fixture_t f;
+        size_t pos = 0;
+        hdr_index_fixture_init(&f, with_key_lc);
+
+        int rv = hwire_parse_headers(&f.ctx, buf, strlen(buf), &pos, 1024, 10);
+        ASSERT_OK(rv);
+        ASSERT_EQ(pos, strlen(buf));
+        ASSERT_EQ(f.idx.count, 4);
+
+        // entries are stored in arrival order
+        ASSERT(str_eq(f.entries[0].header.key, "Host"));
+        ASSERT(str_eq(f.entries[1].header.key, "Content-Type"));
+        ASSERT(str_eq(f.entries[2].header.key, "content-length"));
+        ASSERT(str_eq(f.entries[3].header.key,
+                      "X-Custom-Header-With-A-Long-Name"));
+
+        const hwire_hdr_entry_t *e;
+        e = hwire_hdr_index_get(&f.idx, "content-type", 12);
+        ASSERT(e != NULL);
+        ASSERT(str_eq(e->name, "content-type"));
+        ASSERT(str_eq(e->header.value, "text/html"));
+        ASSERT_EQ(e->header.hash, hwire_hash_key("Content-Type", 12));
+        ASSERT(hwire_hdr_index_next(&f.idx, e) == NULL);
+
+        e = hwire_hdr_index_get(&f.idx, "host", 4);
+        ASSERT(e != NULL);
+        ASSERT(str_eq(e->header.value, "example.com"));
+
+        e = hwire_hdr_index_get(&f.idx, "content-length", 14);
+        ASSERT(e != NULL);
+        ASSERT(str_eq(e->header.value, "42"));
+
+        e = hwire_hdr_index_get(&f.idx, "x-custom-header-with-a-long-name",
+                                32);
+        ASSERT(e != NULL);
+        ASSERT(str_eq(e->header.value, "yes"));
+
+        // lookup names must be lowercase; missing names return NULL
+        ASSERT(hwire_hdr_index_get(&f.idx, "Host", 4) == NULL);
+        ASSERT(hwire_hdr_index_get(&f.idx, "accept", 6) == NULL);
+        ASSERT(hwire_hdr_index_get(&f.idx, "hos", 3) == NULL);
+    }
+
+    TEST_END();
+}
+
+/*
+ * Covers: repeated field names (e.g. Set-Cookie).
+ * MUST: fields with the same name MUST be chained in arrival order.
+ */
+void test_hdr_index_duplicates(void)
+{
+    TEST_START("test_hdr_index_duplicates");
+
+    static const char *buf = "Set-Cookie: a=1\r\n"
+                             "Host: example.com\r\n"
+                             "set-cookie: b=2\r\n"
+                             "Vary: Accept\r\n"
+                             "SET-COOKIE: c=3\r\n"
+                             "\r\n";
+    hdr_index_fixture_t f;
+    size_t pos = 0;
+    hdr_index_fixture_init(&f, 1);
+
+    int rv = hwire_parse_headers(&f.ctx, buf, strlen(buf), &pos, 1024, 10);
+    ASSERT_OK(rv);
+    ASSERT_EQ(f.idx.count, 5);
+
+    const hwire_hdr_entry_t *e = hwire_hdr_index_get(&f.idx, "set-cookie", 10);
+    ASSERT(e != NULL);
+    ASSERT(str_eq(e->header.value, "a=1"));
+    e = hwire_hdr_index_next(&f.idx, e);
+    ASSERT(e != NULL);
+    ASSERT(str_eq(e->header.value, "b=2"));
+    e = hwire_hdr_index_next(&f.idx, e);
+    ASSERT(e != NULL);
+    ASSERT(str_eq(e->header.value, "c=3"));
+    ASSERT(hwire_hdr_index_next(&f.idx, e) == NULL);
+
+    e = hwire_hdr_index_get(&f.idx, "vary", 4);
+    ASSERT(e != NULL);
+    ASSERT(str_eq(e->header.value, "Accept"));
+
+    TEST_END();
+}
+
+typedef struct {
+    int called;
+    uint8_t count_at_cb;
+} index_cb_capture_t;
+
+static int index_count_cb(hwire_ctx_t *ctx, hwire_header_t *header)
+{
+    index_cb_capture_t *cap = (index_cb_capture_t *)ctx->uctx;
+    (void)header;
+    cap->called++;
+    cap->count_at_cb = ctx->hdr_index->count;
+    return 0;
+}
+
+/*
+ * Covers: index reset, capacity limits and interaction with header_cb.
+ * MUST: the index MUST be reset on each hwire_parse_headers call.
+ * MUST: header_cb MUST see the current header already indexed.
+ * MUST: return HWIRE_ENOBUFS when entries or name storage run out.
+ */
+void test_hdr_index_limits(void)
+{
+    TEST_START("test_hdr_index_limits");
+
+    /* Case 1: re-parsing after EAGAIN restarts the index */
+    {
+        hdr_index_fixture_t f;
+        const char *buf = "A: 1\r\nB: 2\r\n\r\n";
+        size_t pos      = 0;
+        hdr_index_fixture_init(&f, 1);
+
+        int rv = hwire_parse_headers(&f.ctx, buf, 8, &pos, 1024, 10);
+        ASSERT_EQ(rv, HWIRE_EAGAIN);
+        ASSERT_EQ(f.idx.count, 1);
+        rv = hwire_parse_headers(&f.ctx, buf, strlen(buf), &pos, 1024, 10);
+        ASSERT_OK(rv);
+        ASSERT_EQ(f.idx.count, 2);
+        ASSERT_EQ(f.idx.names.len, 2);
+        ASSERT(hwire_hdr_index_next(&f.idx, hwire_hdr_index_get(&f.idx, "a",
+                                                                1)) == NULL);
+    }
+
+    /* Case 2: header_cb is still called, after the header is indexed */
+    {
+        hdr_index_fixture_t f;
+        index_cb_capture_t cap = {0};
+        const char *buf        = "A: 1\r\nB: 2\r\n\r\n";
+        size_t pos             = 0;
+        hdr_index_fixture_init(&f, 1);
+        f.ctx.uctx      = &cap;
+        f.ctx.header_cb = index_count_cb;
+
+        int rv = hwire_parse_headers(&f.ctx, buf, strlen(buf), &pos, 1024, 10);
+        ASSERT_OK(rv);
+        ASSERT_EQ(cap.called, 2);
+        ASSERT_EQ(cap.count_at_cb, 2);
+    }
+
+    /* Case 3: more headers than entries */
+    {
+        hdr_index_fixture_t f;
+        const char *buf = "A: 1\r\nB: 2\r\nC: 3\r\n\r\n";
+        size_t pos      = 0;
+        hdr_index_fixture_init(&f, 1);
+        f.idx.nentries = 2;
+
+        int rv = hwire_parse_headers(&f.ctx, buf, strlen(buf), &pos, 1024, 10);
+        ASSERT_EQ(rv, HWIRE_ENOBUFS);
+        ASSERT_EQ(f.idx.count, 2);
+    }
+
+    /* Case 4: name storage exhausted */
+    {
+        hdr_index_fixture_t f;
+        const char *buf = "Host: a\r\nAccept: b\r\n\r\n";
+        size_t pos      = 0;
+        hdr_index_fixture_init(&f, 1);
+        f.idx.names.size = 8;
+
+        int rv = hwire_parse_headers(&f.ctx, buf, strlen(buf), &pos, 1024, 10);
+        ASSERT_EQ(rv, HWIRE_ENOBUFS);
+        ASSERT_EQ(f.idx.count, 1);
+    }
+
+    /* Case 5: empty header block */
+    {
+        hdr_index_fixture_t f;
+        size_t pos = 0;
+        hdr_index_fixture_init(&f, 1);
+
+        int rv = hwire_parse_headers(&f.ctx, "\r\n", 2, &pos, 1024, 10);
+        ASSERT_OK(rv);
+        ASSERT_EQ(f.idx.count, 0);
+        ASSERT(hwire_hdr_index_get(&f.idx, "host", 4) == NULL);
+    }
+
+    TEST_END();
+}
+
+/*
+ * Covers: index filled by hwire_parse_request without header_cb.
+ */
+void test_hdr_index_request(void)
+{
+    TEST_START("test_hdr_index_request");
+
+    hdr_index_fixture_t f;
+    const char *buf = "GET /index.html HTTP/1.1\r\n"
+                      "Host: example.com\r\n"
+                      "Accept: */*\r\n"
+                      "\r\n";
+    size_t pos      = 0;
+    hdr_index_fixture_init(&f, 1);
+    f.ctx.request_cb = mock_request_cb;
+
+    int rv = hwire_parse_request(&f.ctx, buf, strlen(buf), &pos, 1024, 10);
+    ASSERT_OK(rv);
+    ASSERT_EQ(pos, strlen(buf));
+    ASSERT_EQ(f.idx.count, 2);
+
+    const hwire_hdr_entry_t *e = hwire_hdr_index_get(&f.idx, "accept", 6);
+    ASSERT(e != NULL);
+    ASSERT(str_eq(e->header.value, "*/*"));
+
+    TEST_END();
+}
+
+int main(void)
+{
+    test_hdr_index_lookup();
+    test_hdr_index_duplicates();
+    test_hdr_index_limits();
+    test_hdr_index_request();
+    print_test_summary();
+    return g_tests_failed;
+}
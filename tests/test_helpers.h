@@ -10,6 +10,8 @@
 /* Common buffer sizes */
 #define TEST_BUF_SIZE 256
 #define TEST_KEY_SIZE 64
+#define TEST_NENTRIES 8
+#define TEST_NBUCKETS 16
 
 /* Test counters */
 extern int g_tests_run;
@@ -80,6 +82,40 @@ static inline int str_in_buf(hwire_str_t s, const char *buf, size_t buf_len)
     return s.ptr >= buf && s.ptr + s.len <= buf + buf_len;
 }
 
+/* Compare a hwire_str_t slice with a NUL-terminated string. */
+static inline int str_eq(hwire_str_t s, const char *expected)
+{
+    size_t len = strlen(expected);
+    return s.len == len && memcmp(s.ptr, expected, len) == 0;
+}
+
+/* Header index with its storage, attached to ctx.hdr_index. */
+typedef struct {
+    hwire_hdr_entry_t entries[TEST_NENTRIES];
+    uint8_t buckets[TEST_NBUCKETS];
+    char names[TEST_BUF_SIZE];
+    char key_storage[TEST_KEY_SIZE];
+    hwire_hdr_index_t idx;
+    hwire_ctx_t ctx;
+} hdr_index_fixture_t;
+
+static inline void hdr_index_fixture_init(hdr_index_fixture_t *f,
+                                          int with_key_lc)
+{
+    memset(f, 0, sizeof(*f));
+    f->idx.entries    = f->entries;
+    f->idx.nentries   = TEST_NENTRIES;
+    f->idx.buckets    = f->buckets;
+    f->idx.nbuckets   = TEST_NBUCKETS;
+    f->idx.names.buf  = f->names;
+    f->idx.names.size = sizeof(f->names);
+    f->ctx.hdr_index  = &f->idx;
+    if (with_key_lc) {
+        f->ctx.key_lc.buf  = f->key_storage;
+        f->ctx.key_lc.size = sizeof(f->key_storage);
+    }
+}
+
 /* Helper to print summary */
 void print_test_summary(void);
 
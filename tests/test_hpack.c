@@ -0,0 +1,595 @@
+#include "test_helpers.h"
+
+typedef struct {
+    char text[1024];
+    size_t len;
+    int count;
+    const char *value; // value.ptr of the last field
+    uint32_t hash;     // hash of the last field
+} hp_log_t;
+
+// append "name=value;" for each field line
+static int log_header_cb(hwire_ctx_t *ctx, hwire_header_t *header)
+{
+    hp_log_t *log = (hp_log_t *)ctx->uctx;
+    size_t n      = header->key.len + header->value.len + 2;
+    if (log->len + n >= sizeof(log->text)) {
+        return 1;
+    }
+    memcpy(log->text + log->len, header->key.ptr, header->key.len);
+    log->len += header->key.len;
+    log->text[log->len++] = '=';
+    memcpy(log->text + log->len, header->value.ptr, header->value.len);
+    log->len += header->value.len;
+    log->text[log->len++] = ';';
+    log->text[log->len]   = '\0';
+    log->value            = header->value.ptr;
+    log->hash             = header->hash;
+    log->count++;
+    return 0;
+}
+
+typedef struct {
+    hwire_hpack_t hp;
+    hwire_hpack_entry_t entries[128];
+    char table[8192];
+    char scratch[256];
+} hp_dec_t;
+
+static int dec_init(hp_dec_t *d, size_t max_size)
+{
+    memset(&d->hp, 0, sizeof(d->hp));
+    d->hp.entries      = d->entries;
+    d->hp.nentries     = 128;
+    d->hp.table.buf    = d->table;
+    d->hp.table.size   = sizeof(d->table);
+    d->hp.scratch.buf  = d->scratch;
+    d->hp.scratch.size = sizeof(d->scratch);
+    return hwire_hpack_init(&d->hp, max_size);
+}
+
+static size_t unhex(const char *hex, char *out)
+{
+    size_t n = 0;
+    for (; hex[0] != '\0' && hex[1] != '\0'; hex += 2) {
+        unsigned int v = 0;
+        sscanf(hex, "%2x", &v);
+        out[n++] = (char)v;
+    }
+    return n;
+}
+
+// code lengths of RFC 7541 Appendix B, symbols 0-255 and EOS
+static const uint8_t HUFF_LEN[257] = {
+    13, 23, 28, 28, 28, 28, 28, 28, 28, 24, 30, 28, 28, 30, 28, 28,
+    28, 28, 28, 28, 28, 28, 30, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    6, 10, 10, 12, 13, 6, 8, 11, 10, 10, 8, 11, 8, 6, 6, 6,
+    5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 7, 8, 15, 6, 12, 10,
+    13, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 8, 7, 8, 13, 19, 13, 14, 6,
+    15, 5, 6, 5, 6, 5, 6, 6, 6, 5, 7, 7, 6, 6, 6, 5,
+    6, 7, 6, 5, 5, 6, 7, 7, 7, 7, 7, 15, 11, 14, 13, 28,
+    20, 22, 20, 20, 22, 22, 22, 23, 22, 23, 23, 23, 23, 23, 24, 23,
+    24, 24, 22, 23, 24, 23, 23, 23, 23, 21, 22, 23, 22, 23, 23, 24,
+    22, 21, 20, 22, 22, 23, 23, 21, 23, 22, 22, 24, 21, 22, 23, 23,
+    21, 21, 22, 21, 23, 22, 23, 23, 20, 22, 22, 22, 23, 22, 22, 23,
+    26, 26, 20, 19, 22, 23, 22, 25, 26, 26, 26, 27, 27, 26, 24, 25,
+    19, 21, 26, 27, 27, 26, 27, 24, 21, 21, 26, 26, 28, 27, 27, 27,
+    20, 24, 20, 21, 22, 21, 21, 23, 22, 22, 25, 25, 24, 24, 26, 23,
+    26, 27, 26, 26, 27, 27, 27, 27, 27, 28, 27, 27, 27, 27, 27, 26,
+    30,
+};
+
+// Huffman-encode str, followed by EOS if eos is set, and pad with ones
+static size_t huff_encode(const char *str, size_t len, int eos,
+                          unsigned char *out)
+{
+    uint32_t codes[257];
+    uint32_t code = 0;
+    uint64_t bits = 0;
+    unsigned n    = 0;
+    size_t olen   = 0;
+
+    // canonical code: consecutive by length, then by symbol
+    for (unsigned l = 5; l <= 30; l++, code <<= 1) {
+        for (size_t s = 0; s < 257; s++) {
+            if (HUFF_LEN[s] == l) {
+                codes[s] = code++;
+            }
+        }
+    }
+    for (size_t i = 0; i < len + (eos ? 1 : 0); i++) {
+        size_t s = (i < len) ? (unsigned char)str[i] : 256;
+        bits     = bits << HUFF_LEN[s] | codes[s];
+        n += HUFF_LEN[s];
+        while (n >= 8) {
+            n -= 8;
+            out[olen++] = (unsigned char)(bits >> n);
+        }
+    }
+    if (n > 0) {
+        out[olen++] = (unsigned char)(bits << (8 - n) | (0xFFu >> n));
+    }
+    return olen;
+}
+
+// append an integer with an N-bit prefix (RFC 7541 5.1)
+static size_t put_int(unsigned char *out, unsigned char first,
+                      unsigned prefix, size_t v)
+{
+    const size_t max = ((size_t)1 << prefix) - 1;
+    size_t n         = 0;
+
+    if (v < max) {
+        out[0] = (unsigned char)(first | v);
+        return 1;
+    }
+    out[n++] = (unsigned char)(first | max);
+    for (v -= max; v >= 128; v /= 128) {
+        out[n++] = (unsigned char)(v % 128 + 128);
+    }
+    out[n++] = (unsigned char)v;
+    return n;
+}
+
+// append a string literal (RFC 7541 5.2)
+static size_t put_str(unsigned char *out, const char *str, size_t len,
+                      int huffman)
+{
+    unsigned char tmp[1024];
+    size_t n;
+
+    if (huffman) {
+        len = huff_encode(str, len, 0, tmp);
+        str = (const char *)tmp;
+    }
+    n = put_int(out, huffman ? 0x80 : 0, 7, len);
+    memcpy(out + n, str, len);
+    return n + len;
+}
+
+// decode hex, log the fields to log and return the result
+static int decode_hex(hp_dec_t *d, hp_log_t *log, const char *hex)
+{
+    char buf[512];
+    hwire_ctx_t ctx = {.uctx = log, .header_cb = log_header_cb};
+    size_t len      = unhex(hex, buf);
+
+    memset(log, 0, sizeof(*log));
+    return hwire_hpack_decode(&d->hp, &ctx, buf, len, 256, 16);
+}
+
+typedef struct {
+    const char *hex;
+    size_t size; // dynamic table size afterwards
+} hp_block_t;
+
+// RFC 7541 C.3 and C.4, with and without Huffman coding
+static const hp_block_t REQUESTS[2][3] = {
+    {{"828684410f7777772e6578616d706c652e636f6d", 57},
+     {"828684be58086e6f2d6361636865", 110},
+     {"828785bf400a637573746f6d2d6b65790c637573746f6d2d76616c7565", 164}},
+    {{"828684418cf1e3c2e5f23a6ba0ab90f4ff", 57},
+     {"828684be5886a8eb10649cbf", 110},
+     {"828785bf408825a849e95ba97d7f8925a849e95bb8e8b4bf", 164}},
+};
+
+static const char *const REQUEST_FIELDS[3] = {
+    ":method=GET;:scheme=http;:path=/;:authority=www.example.com;",
+    ":method=GET;:scheme=http;:path=/;:authority=www.example.com;"
+    "cache-control=no-cache;",
+    ":method=GET;:scheme=https;:path=/index.html;"
+    ":authority=www.example.com;custom-key=custom-value;",
+};
+
+// RFC 7541 C.5 and C.6, with a 256-byte table and eviction
+static const hp_block_t RESPONSES[2][3] = {
+    {{"4803333032580770726976617465611d4d6f6e2c203231204f637420323031332032"
+      "303a31333a323120474d546e1768747470733a2f2f7777772e6578616d706c652e63"
+      "6f6d",
+      222},
+     {"4803333037c1c0bf", 222},
+     {"88c1611d4d6f6e2c203231204f637420323031332032303a31333a323220474d54c0"
+      "5a04677a69707738666f6f3d4153444a4b48514b425a584f5157454f504955415851"
+      "57454f49553b206d61782d6167653d333630303b2076657273696f6e3d31",
+      215}},
+    {{"488264025885aec3771a4b6196d07abe941054d444a8200595040b8166e082a62d1b"
+      "ff6e919d29ad171863c78f0b97c8e9ae82ae43d3",
+      222},
+     {"4883640effc1c0bf", 222},
+     {"88c16196d07abe941054d444a8200595040b8166e084a62d1bffc05a839bd9ab77ad"
+      "94e7821dd7f2e6c7b335dfdfcd5b3960d5af27087f3672c1ab270fb5291f95873160"
+      "65c003ed4ee5b1063d5007",
+      215}},
+};
+
+static const char *const RESPONSE_FIELDS[3] = {
+    ":status=302;cache-control=private;"
+    "date=Mon, 21 Oct 2013 20:13:21 GMT;location=https://www.example.com;",
+    ":status=307;cache-control=private;"
+    "date=Mon, 21 Oct 2013 20:13:21 GMT;location=https://www.example.com;",
+    ":status=200;cache-control=private;"
+    "date=Mon, 21 Oct 2013 20:13:22 GMT;location=https://www.example.com;"
+    "content-encoding=gzip;"
+    "set-cookie=foo=ASDJKHQKBZXOQWEOPIUAXQWEOIU; max-age=3600; version=1;",
+};
+
+/*
+ * Covers: RFC 7541 Appendix C request and response examples.
+ * MUST: indexed, literal and Huffman-coded fields MUST decode to the fields
+ *       of the examples, in order.
+ * MUST: the dynamic table MUST grow and evict as in the examples.
+ */
+void test_hpack_decode(void)
+{
+    TEST_START("test_hpack_decode");
+
+    static hp_dec_t d;
+    hp_log_t log;
+
+    for (size_t h = 0; h < 2; h++) {
+        ASSERT_OK(dec_init(&d, 4096));
+        for (size_t i = 0; i < 3; i++) {
+            ASSERT_OK(decode_hex(&d, &log, REQUESTS[h][i].hex));
+            ASSERT(strcmp(log.text, REQUEST_FIELDS[i]) == 0);
+            ASSERT_EQ(d.hp.size, REQUESTS[h][i].size);
+        }
+        ASSERT_EQ(d.hp.count, 3);
+
+        ASSERT_OK(dec_init(&d, 256));
+        for (size_t i = 0; i < 3; i++) {
+            ASSERT_OK(decode_hex(&d, &log, RESPONSES[h][i].hex));
+            ASSERT(strcmp(log.text, RESPONSE_FIELDS[i]) == 0);
+            ASSERT_EQ(d.hp.size, RESPONSES[h][i].size);
+        }
+        ASSERT_EQ(d.hp.count, 3);
+    }
+
+    TEST_END();
+}
+
+/*
+ * Covers: zero-copy literals, key_lc and field name hashes.
+ * MUST: literals without Huffman coding and indexing MUST be passed as
+ *       slices of the input.
+ * MUST: with key_lc allocated, hash MUST equal that of hwire_parse_headers
+ *       for static, dynamic and literal names alike; otherwise it MUST be 0.
+ */
+void test_hpack_key_lc(void)
+{
+    TEST_START("test_hpack_key_lc");
+
+    static hp_dec_t d;
+    // literal name not indexed, literal name indexed, dynamic entry,
+    // static name (content-length is static entry 28)
+    static const struct {
+        const char *block;
+        size_t len;
+    } cases[] = {
+        {"\x00\x0e" "content-length" "\x01" "5", 18},
+        {"\x40\x0e" "content-length" "\x01" "5", 18},
+        {"\xbe", 1},
+        {"\x5c\x01" "7", 3},
+    };
+    char key_buf[TEST_KEY_SIZE];
+    hp_log_t log    = {0};
+    hwire_ctx_t ctx = {.key_lc    = {.size = sizeof(key_buf), .buf = key_buf},
+                       .uctx      = &log,
+                       .header_cb = log_header_cb};
+    size_t pos      = 0;
+    uint32_t hash;
+
+    ASSERT_OK(hwire_parse_headers(&ctx, "Content-Length: 1\r\n\r\n", 21,
+                                  &pos, 64, 1));
+    hash = log.hash;
+    ASSERT(hash != 0);
+
+    ASSERT_OK(dec_init(&d, 4096));
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        memset(&log, 0, sizeof(log));
+        ASSERT_OK(hwire_hpack_decode(&d.hp, &ctx, cases[i].block,
+                                     cases[i].len, 64, 8));
+        ASSERT_EQ(log.count, 1);
+        ASSERT_EQ(log.hash, hash);
+        ASSERT_EQ(ctx.key_lc.hash, hash);
+        ASSERT_EQ(ctx.key_lc.len, 14);
+        ASSERT(memcmp(ctx.key_lc.buf, "content-length", 14) == 0);
+        if (i == 0) {
+            ASSERT(log.value == cases[i].block + 17);
+        }
+    }
+    ASSERT_EQ(d.hp.count, 2);
+
+    ctx.key_lc.size = 0;
+    memset(&log, 0, sizeof(log));
+    ASSERT_OK(hwire_hpack_decode(&d.hp, &ctx, "\xbf", 1, 64, 8));
+    ASSERT(strcmp(log.text, "content-length=5;") == 0);
+    ASSERT_EQ(log.hash, 0);
+
+    TEST_END();
+}
+
+/*
+ * Covers: RFC 7541 §5.2 Huffman-coded string literals.
+ * MUST: every symbol MUST decode, including those of codes longer than
+ *       8 bits; control characters MUST then be rejected as values.
+ * MUST: padding longer than 7 bits, not of ones, or EOS MUST return
+ *       HWIRE_EILSEQ.
+ * MUST: output larger than scratch MUST return HWIRE_ENOBUFS.
+ */
+void test_hpack_huffman(void)
+{
+    TEST_START("test_hpack_huffman");
+
+    static hp_dec_t d;
+    static unsigned char block[1200];
+    static char value[400];
+    hp_log_t log;
+    hwire_ctx_t ctx = {.uctx = &log, .header_cb = log_header_cb};
+    size_t len;
+
+    ASSERT_OK(dec_init(&d, 4096));
+    for (unsigned b = 0; b < 256; b++) {
+        const char v[3] = {'a', (char)b, 'a'};
+        const int valid = b == '\t' || (b >= 0x20 && b != 0x7F);
+
+        // literal field line without indexing, name :authority
+        block[0] = 0x01;
+        len      = 1 + put_str(block + 1, v, 3, 1);
+        memset(&log, 0, sizeof(log));
+        ASSERT_EQ(hwire_hpack_decode(&d.hp, &ctx, (const char *)block, len,
+                                     256, 8),
+                  valid ? HWIRE_OK : HWIRE_EHDRVALUE);
+        if (valid) {
+            ASSERT_EQ(log.len, 15);
+            ASSERT(memcmp(log.text, ":authority=", 11) == 0);
+            ASSERT(memcmp(log.text + 11, v, 3) == 0);
+        }
+    }
+
+    // values refilling the bit buffer many times, around the scratch size
+    static const size_t sizes[] = {1, 2, 7, 8, 9, 31, 100, 255, 256, 257, 400};
+    for (size_t j = 0; j < sizeof(sizes) / sizeof(sizes[0]); j++) {
+        const size_t n = sizes[j];
+        for (size_t i = 0; i < n; i++) {
+            value[i] = (char)(0x21 + (i * 131 + n) % 0xDE);
+            if (value[i] == 0x7F) {
+                value[i] = 'x';
+            }
+        }
+        block[0] = 0x01;
+        len      = 1 + put_str(block + 1, value, n, 1);
+        memset(&log, 0, sizeof(log));
+        if (n > sizeof(d.scratch)) {
+            ASSERT_EQ(hwire_hpack_decode(&d.hp, &ctx, (const char *)block,
+                                         len, 1024, 8),
+                      HWIRE_ENOBUFS);
+            continue;
+        }
+        ASSERT_OK(hwire_hpack_decode(&d.hp, &ctx, (const char *)block, len,
+                                     1024, 8));
+        ASSERT_EQ(log.len, n + 12);
+        ASSERT(memcmp(log.text + 11, value, n) == 0);
+    }
+
+    static const struct {
+        const char *hex;
+        int rv;
+    } cases[] = {
+        {"0180", HWIRE_OK},       // empty
+        {"01811f", HWIRE_OK},     // 'a' and 3 bits of padding
+        {"018118", HWIRE_EILSEQ}, // padding of zeros
+        {"0181ff", HWIRE_EILSEQ}, // 8 bits of padding
+        {"01821fff", HWIRE_EILSEQ},
+        {"0181", HWIRE_EILSEQ},
+    };
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        ASSERT_EQ(decode_hex(&d, &log, cases[i].hex), cases[i].rv);
+    }
+
+    // EOS
+    block[0] = 0x01;
+    len      = huff_encode("a", 1, 1, block + 2);
+    block[1] = (unsigned char)(0x80 | len);
+    ASSERT_EQ(hwire_hpack_decode(&d.hp, &ctx, (const char *)block, len + 2,
+                                 256, 8),
+              HWIRE_EILSEQ);
+
+    TEST_END();
+}
+
+typedef struct {
+    char name[8];
+    char value[64];
+    size_t nlen;
+    size_t vlen;
+} model_entry_t;
+
+/*
+ * Covers: RFC 7541 §4 dynamic table management in the caller's rings.
+ * MUST: entries MUST be evicted oldest first to keep the table size within
+ *       its maximum, also across the end of the ring.
+ * MUST: a name indexed from an entry evicted by the insertion MUST be kept.
+ * MUST: a size update MUST evict; an entry larger than the table MUST
+ *       empty it.
+ */
+void test_hpack_table(void)
+{
+    TEST_START("test_hpack_table");
+
+    static hp_dec_t d;
+    static model_entry_t model[16]; // newest first
+    size_t mcount = 0;
+    size_t msize  = 0;
+    uint32_t seed = 1;
+    unsigned char block[256];
+    hp_log_t log;
+    hwire_ctx_t ctx = {.uctx = &log, .header_cb = log_header_cb};
+    size_t len;
+
+    // the smallest rings for 256 bytes
+    ASSERT_OK(dec_init(&d, 256));
+    d.hp.nentries   = 7;
+    ASSERT_EQ(hwire_hpack_init(&d.hp, 256), HWIRE_ERANGE);
+    d.hp.nentries   = 8;
+    d.hp.table.size = 511;
+    ASSERT_EQ(hwire_hpack_init(&d.hp, 256), HWIRE_ERANGE);
+    d.hp.table.size = 512;
+    ASSERT_OK(hwire_hpack_init(&d.hp, 256));
+
+    for (int i = 0; i < 1000; i++) {
+        model_entry_t e;
+        size_t esz;
+
+        seed = seed * 1103515245u + 12345u;
+        if (mcount > 0 && (seed >> 8) % 4 == 0) {
+            // name of the oldest entry, which the insertion may evict
+            e   = model[mcount - 1];
+            len = put_int(block, 0x40, 6, 61 + mcount);
+        } else {
+            e.nlen = (size_t)snprintf(e.name, sizeof(e.name), "k%d", i);
+            len    = put_int(block, 0x40, 6, 0);
+            len += put_str(block + len, e.name, e.nlen, i & 1);
+        }
+        e.vlen = (seed >> 16) % 60;
+        memset(e.value, 'a' + i % 26, e.vlen);
+        len += put_str(block + len, e.value, e.vlen, i & 2);
+        memset(&log, 0, sizeof(log));
+        ASSERT_OK(hwire_hpack_decode(&d.hp, &ctx, (const char *)block, len,
+                                     256, 8));
+
+        esz = e.nlen + e.vlen + 32;
+        while (msize + esz > 256) {
+            mcount--;
+            msize -= model[mcount].nlen + model[mcount].vlen + 32;
+        }
+        memmove(model + 1, model, mcount * sizeof(model[0]));
+        model[0] = e;
+        mcount++;
+        msize += esz;
+        ASSERT_EQ(d.hp.size, msize);
+        ASSERT_EQ(d.hp.count, mcount);
+
+        for (size_t k = 0; k < mcount; k++) {
+            const model_entry_t *m = &model[k];
+            len                    = put_int(block, 0x80, 7, 62 + k);
+            memset(&log, 0, sizeof(log));
+            ASSERT_OK(hwire_hpack_decode(&d.hp, &ctx, (const char *)block,
+                                         len, 256, 8));
+            ASSERT_EQ(log.len, m->nlen + m->vlen + 2);
+            ASSERT(memcmp(log.text, m->name, m->nlen) == 0);
+            ASSERT(memcmp(log.text + m->nlen + 1, m->value, m->vlen) == 0);
+        }
+    }
+
+    // larger than the maximum size
+    ASSERT_EQ(decode_hex(&d, &log, "3fe11f"), HWIRE_EILSEQ);
+    // 128, then an entry of 133 bytes empties the table
+    ASSERT_OK(decode_hex(&d, &log, "3fe100"));
+    ASSERT(d.hp.size <= 128);
+    memset(block, 'v', sizeof(block));
+    block[0] = 0x40;
+    block[1] = 0x01;
+    block[2] = 'k';
+    block[3] = 100;
+    memset(&log, 0, sizeof(log));
+    ASSERT_OK(hwire_hpack_decode(&d.hp, &ctx, (const char *)block, 104, 256,
+                                 8));
+    ASSERT_EQ(d.hp.count, 0);
+    ASSERT_EQ(d.hp.size, 0);
+    // several updates before the first field line; 0 disables indexing
+    ASSERT_OK(decode_hex(&d, &log, "3fe1002040016101628240016101628a"));
+    ASSERT_EQ(d.hp.count, 0);
+    ASSERT_EQ(log.count, 4);
+
+    TEST_END();
+}
+
+/*
+ * Covers: malformed header blocks and limits.
+ * MUST: index 0, indexes beyond the dynamic table, truncated
+ *       representations and integers beyond 32 bits MUST return
+ *       HWIRE_EILSEQ.
+ * MUST: a size update after a field line MUST return HWIRE_EILSEQ.
+ * MUST: names that are not lowercase tokens MUST return HWIRE_EHDRNAME,
+ *       values with CTLs or surrounding whitespace HWIRE_EHDRVALUE.
+ * MUST: limits MUST return HWIRE_EHDRLEN, HWIRE_ENOBUFS or HWIRE_EKEYLEN.
+ */
+void test_hpack_errors(void)
+{
+    TEST_START("test_hpack_errors");
+
+    static hp_dec_t d;
+    static const struct {
+        const char *hex;
+        int rv;
+    } cases[] = {
+        {"", HWIRE_OK},
+        {"80", HWIRE_EILSEQ},
+        {"be", HWIRE_EILSEQ},
+        {"ff", HWIRE_EILSEQ},
+        {"ff80", HWIRE_EILSEQ},
+        {"ffffffffff0f", HWIRE_EILSEQ},
+        {"ff808080808000", HWIRE_EILSEQ},
+        {"fffefffffe0f", HWIRE_EILSEQ}, // index UINT32_MAX
+        {"40", HWIRE_EILSEQ},
+        {"4001", HWIRE_EILSEQ},
+        {"400178", HWIRE_EILSEQ},
+        {"40017801", HWIRE_EILSEQ},
+        {"0f", HWIRE_EILSEQ},
+        {"8220", HWIRE_EILSEQ},
+        {"3fe11f82", HWIRE_OK},
+        {"3fe21f", HWIRE_EILSEQ},
+        {"4001580161", HWIRE_EHDRNAME},
+        {"40000161", HWIRE_EHDRNAME},
+        {"40013a0161", HWIRE_EHDRNAME},
+        {"400261200161", HWIRE_EHDRNAME},
+        {"40023a610161", HWIRE_OK},
+        {"1001280161", HWIRE_EHDRNAME},
+        {"0103610062", HWIRE_EHDRVALUE},
+        {"01022061", HWIRE_EHDRVALUE},
+        {"01026109", HWIRE_EHDRVALUE},
+        {"0103617f62", HWIRE_EHDRVALUE},
+        {"01036109ff", HWIRE_OK},
+        {"0111" "3031323334353637383961626364656667", HWIRE_EHDRLEN},
+        {"0110", HWIRE_EILSEQ},
+        {"4110" "30313233343536373839616263646566", HWIRE_EHDRLEN},
+        {"828282", HWIRE_ENOBUFS},
+    };
+    char key_buf[TEST_KEY_SIZE];
+    hp_log_t log    = {0};
+    hwire_ctx_t ctx = {.key_lc    = {.size = sizeof(key_buf), .buf = key_buf},
+                       .uctx      = &log,
+                       .header_cb = log_header_cb};
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        char buf[64];
+        size_t len = unhex(cases[i].hex, buf);
+        ASSERT_OK(dec_init(&d, 4096));
+        ASSERT_EQ(hwire_hpack_decode(&d.hp, &ctx, buf, len, 16, 2),
+                  cases[i].rv);
+    }
+
+    // name longer than key_lc
+    ctx.key_lc.size = 6;
+    ASSERT_EQ(hwire_hpack_decode(&d.hp, &ctx, "\x82", 1, 16, 2),
+              HWIRE_EKEYLEN);
+    // callback abort
+    ctx.key_lc.size = 0;
+    ctx.header_cb   = mock_header_cb_fail;
+    ASSERT_EQ(hwire_hpack_decode(&d.hp, &ctx, "\x82", 1, 16, 2),
+              HWIRE_ECALLBACK);
+
+    TEST_END();
+}
+
+int main(void)
+{
+    test_hpack_decode();
+    test_hpack_key_lc();
+    test_hpack_huffman();
+    test_hpack_table();
+    test_hpack_errors();
+    print_test_summary();
+    return g_tests_failed;
+}
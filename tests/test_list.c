@@ -0,0 +1,249 @@
+#include "test_helpers.h"
+
+typedef struct {
+    size_t count;
+    char keys[8][16];
+    char values[8][32];
+} param_log_t;
+
+static param_log_t g_log;
+
+static int log_param_cb(hwire_ctx_t *ctx, hwire_param_t *param)
+{
+    size_t i = g_log.count++;
+    if (i >= 8 || param->value.len >= sizeof(g_log.values[0])) {
+        return 1;
+    }
+    // key_lc holds the lowercased name
+    memcpy(g_log.keys[i], ctx->key_lc.buf, ctx->key_lc.len);
+    g_log.keys[i][ctx->key_lc.len] = '\0';
+    memcpy(g_log.values[i], param->value.ptr, param->value.len);
+    g_log.values[i][param->value.len] = '\0';
+    return 0;
+}
+
+static int reject_param_cb(hwire_ctx_t *ctx, hwire_param_t *param)
+{
+    (void)ctx;
+    (void)param;
+    return 1;
+}
+
+typedef struct {
+    const char *value;
+    uint16_t q;
+} list_expect_t;
+
+/*
+ * Covers: RFC 9110 §5.6.1 #element lists and §12.4.2 weights.
+ * MUST: elements MUST be split at ',' and trimmed of OWS; empty ones skipped.
+ * MUST: ',' and ';' inside quoted-strings MUST not split an element.
+ * MUST: "q=" MUST be parsed into thousandths; a missing weight MUST be 1000.
+ */
+void test_list_next(void)
+{
+    TEST_START("test_list_next");
+
+    static const struct {
+        const char *str;
+        size_t n;
+        list_expect_t elems[8];
+    } cases[] = {
+        {"", 0, {{0}}},
+        {" , ,, ", 0, {{0}}},
+        {"gzip, deflate, br",
+         3,
+         {{"gzip", 1000}, {"deflate", 1000}, {"br", 1000}}},
+        {"ja,en-US;q=0.9,en;q=0.8",
+         3,
+         {{"ja", 1000}, {"en-US", 900}, {"en", 800}}},
+        {"text/html,application/xhtml+xml,application/xml;q=0.9,image/avif,"
+         "image/webp,image/apng,*/*;q=0.8",
+         7,
+         {{"text/html", 1000},
+          {"application/xhtml+xml", 1000},
+          {"application/xml", 900},
+          {"image/avif", 1000},
+          {"image/webp", 1000},
+          {"image/apng", 1000},
+          {"*/*", 800}}},
+        {"a ;Q=1.000 , b; q=0, c;q=0., d;q=0.125",
+         4,
+         {{"a", 1000}, {"b", 0}, {"c", 0}, {"d", 125}}},
+        {"x;;q=0.5;, y", 2, {{"x", 500}, {"y", 1000}}},
+        {"W/\"a,b\", \"c;d\"", 2, {{"W/\"a,b\"", 1000}, {"\"c;d\"", 1000}}},
+        {"User Agent, Foo", 2, {{"User Agent", 1000}, {"Foo", 1000}}},
+    };
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        const char *str = cases[i].str;
+        size_t len      = strlen(str);
+        size_t pos      = 0;
+        size_t n        = 0;
+        hwire_list_elem_t e;
+        int rv;
+
+        while ((rv = hwire_list_next(NULL, str, len, &pos, &e)) == 1) {
+            ASSERT(n < cases[i].n);
+            ASSERT(str_eq(e.value, cases[i].elems[n].value));
+            ASSERT_EQ(e.q, cases[i].elems[n].q);
+            n++;
+        }
+        ASSERT_EQ(rv, 0);
+        ASSERT_EQ(n, cases[i].n);
+        ASSERT_EQ(pos, len);
+        // the end is sticky
+        ASSERT_EQ(hwire_list_next(NULL, str, len, &pos, &e), 0);
+    }
+
+    // NULL string with length 0
+    {
+        size_t pos = 0;
+        hwire_list_elem_t e;
+        ASSERT_EQ(hwire_list_next(NULL, NULL, 0, &pos, &e), 0);
+    }
+
+    TEST_END();
+}
+
+/*
+ * Covers: parameters other than the weight.
+ * MUST: every non-q parameter MUST reach param_cb with a lowercased name,
+ *       and quoted values MUST be passed without their DQUOTEs.
+ * MUST: a non-zero return from param_cb MUST return HWIRE_ECALLBACK.
+ */
+void test_list_next_params(void)
+{
+    TEST_START("test_list_next_params");
+
+    char key_buf[16];
+    hwire_ctx_t ctx = {0};
+    ctx.key_lc.buf  = key_buf;
+    ctx.key_lc.size = sizeof(key_buf);
+    ctx.param_cb    = log_param_cb;
+    memset(&g_log, 0, sizeof(g_log));
+
+    const char *str = "text/html;Level=1;q=0.4;ext=\"a, b\", text/plain";
+    size_t len      = strlen(str);
+    size_t pos      = 0;
+    hwire_list_elem_t e;
+
+    ASSERT_EQ(hwire_list_next(&ctx, str, len, &pos, &e), 1);
+    ASSERT(str_eq(e.value, "text/html"));
+    ASSERT_EQ(e.q, 400);
+    ASSERT_EQ(g_log.count, 2);
+    ASSERT(strcmp(g_log.keys[0], "level") == 0);
+    ASSERT(strcmp(g_log.values[0], "1") == 0);
+    ASSERT(strcmp(g_log.keys[1], "ext") == 0);
+    ASSERT(strcmp(g_log.values[1], "a, b") == 0);
+
+    ASSERT_EQ(hwire_list_next(&ctx, str, len, &pos, &e), 1);
+    ASSERT(str_eq(e.value, "text/plain"));
+    ASSERT_EQ(e.q, 1000);
+    ASSERT_EQ(g_log.count, 2);
+    ASSERT_EQ(hwire_list_next(&ctx, str, len, &pos, &e), 0);
+
+    // callback abort; the weight alone does not reach the callback
+    ctx.param_cb = reject_param_cb;
+    pos          = 0;
+    ASSERT_EQ(hwire_list_next(&ctx, str, len, &pos, &e), HWIRE_ECALLBACK);
+    pos = 0;
+    ASSERT_EQ(hwire_list_next(&ctx, "br;q=0.1", 8, &pos, &e), 1);
+    ASSERT_EQ(e.q, 100);
+
+    // parameter name longer than key_lc
+    pos = 0;
+    str = "a;averyveryverylongname=1";
+    ASSERT_EQ(hwire_list_next(&ctx, str, strlen(str), &pos, &e),
+              HWIRE_EKEYLEN);
+
+    TEST_END();
+}
+
+/*
+ * Covers: malformed elements, parameters and weights.
+ * MUST: an invalid qvalue or parameter MUST return HWIRE_EILSEQ.
+ */
+void test_list_next_errors(void)
+{
+    TEST_START("test_list_next_errors");
+
+    static const struct {
+        const char *str;
+        int rv;
+    } cases[] = {
+        {"a;q=1.5", HWIRE_EILSEQ},
+        {"a;q=2", HWIRE_EILSEQ},
+        {"a;q=0.1234", HWIRE_EILSEQ},
+        {"a;q=.5", HWIRE_EILSEQ},
+        {"a;q=", HWIRE_EILSEQ},
+        {"a;q=\"1\"", HWIRE_EILSEQ},
+        {"a;q", HWIRE_EILSEQ},
+        {"a;=1", HWIRE_EILSEQ},
+        {"a;b c=1", HWIRE_EILSEQ},
+        {"a;b=1 x", HWIRE_EILSEQ},
+        {";q=0.5", HWIRE_EILSEQ},
+        {"\"open, b", HWIRE_EILSEQ},
+        {"a;b=\"x", HWIRE_EILSEQ},
+        // the weight is 0 and "5x" is the next element
+        {"a;q=0,5x", 1},
+        {"a b;q=0.1 ", 1},
+    };
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        const char *str = cases[i].str;
+        size_t pos      = 0;
+        hwire_list_elem_t e;
+        ASSERT_EQ(hwire_list_next(NULL, str, strlen(str), &pos, &e),
+                  cases[i].rv);
+    }
+
+    TEST_END();
+}
+
+/*
+ * Covers: separators around SIMD block boundaries.
+ * MUST: results MUST not depend on the position of ',' or ';'.
+ */
+void test_list_next_simd_boundary(void)
+{
+    TEST_START("test_list_next_simd_boundary");
+
+    char buf[TEST_BUF_SIZE];
+
+    for (size_t alen = 1; alen <= 40; alen++) {
+        for (int sep = 0; sep < 2; sep++) {
+            size_t n = 0;
+            memset(buf, 'a', alen);
+            n += alen;
+            if (sep) {
+                memcpy(buf + n, ";q=0.5", 6);
+                n += 6;
+            }
+            memcpy(buf + n, ",\"x,y\"", 6);
+            n += 6;
+
+            size_t pos = 0;
+            hwire_list_elem_t e;
+            ASSERT_EQ(hwire_list_next(NULL, buf, n, &pos, &e), 1);
+            ASSERT(e.value.ptr == buf);
+            ASSERT_EQ(e.value.len, alen);
+            ASSERT_EQ(e.q, sep ? 500 : 1000);
+            ASSERT_EQ(hwire_list_next(NULL, buf, n, &pos, &e), 1);
+            ASSERT(str_eq(e.value, "\"x,y\""));
+            ASSERT_EQ(hwire_list_next(NULL, buf, n, &pos, &e), 0);
+        }
+    }
+
+    TEST_END();
+}
+
+int main(void)
+{
+    test_list_next();
+    test_list_next_params();
+    test_list_next_errors();
+    test_list_next_simd_boundary();
+    print_test_summary();
+    return g_tests_failed;
+}
@@ -0,0 +1,300 @@
+#include "test_helpers.h"
+
+typedef struct {
+    char text[16384];
+    size_t len;
+    int nparts;
+    int nslices;
+} mp_log_t;
+
+static void log_append(mp_log_t *log, const char *s, size_t n)
+{
+    if (log->len + n < sizeof(log->text)) {
+        memcpy(log->text + log->len, s, n);
+        log->len += n;
+        log->text[log->len] = '\0';
+    }
+}
+
+// "|" per part, "name=value;" per header, then the body
+static int log_part_cb(hwire_ctx_t *ctx)
+{
+    mp_log_t *log = (mp_log_t *)ctx->uctx;
+    log_append(log, "|", 1);
+    log->nparts++;
+    return 0;
+}
+
+static int log_header_cb(hwire_ctx_t *ctx, hwire_header_t *header)
+{
+    mp_log_t *log = (mp_log_t *)ctx->uctx;
+    log_append(log, header->key.ptr, header->key.len);
+    log_append(log, "=", 1);
+    log_append(log, header->value.ptr, header->value.len);
+    log_append(log, ";", 1);
+    return 0;
+}
+
+static int log_body_cb(hwire_ctx_t *ctx, const char *data, size_t len)
+{
+    mp_log_t *log = (mp_log_t *)ctx->uctx;
+    log_append(log, data, len);
+    log->nslices++;
+    return 0;
+}
+
+static int fail_part_cb(hwire_ctx_t *ctx)
+{
+    (void)ctx;
+    return 1;
+}
+
+#define BOUNDARY "----WebKitFormBoundary7MA4YWxkTrZu0gW"
+
+static const char FORM[] =
+    "This is the preamble.\r\n"
+    "--" BOUNDARY "\r\n"
+    "Content-Disposition: form-data; name=\"field1\"\r\n"
+    "\r\n"
+    "value1\r\n"
+    "--" BOUNDARY " \t\r\n"
+    "Content-Disposition: form-data; name=\"file\"; filename=\"a.txt\"\r\n"
+    "Content-Type: text/plain\r\n"
+    "\r\n"
+    "line 1\r\n"
+    "--" "----WebKitFormBoundary\r\n"
+    "\r\n"
+    "--" BOUNDARY "\r\n"
+    "\r\n"
+    "no headers\r\n"
+    "--" BOUNDARY "--\r\n"
+    "This is the epilogue.\r\n";
+
+static const char FORM_LOG[] =
+    "|Content-Disposition=form-data; name=\"field1\";value1"
+    "|Content-Disposition=form-data; name=\"file\"; filename=\"a.txt\";"
+    "Content-Type=text/plain;"
+    "line 1\r\n--" "----WebKitFormBoundary\r\n"
+    "|no headers";
+
+static int fail_body_cb(hwire_ctx_t *ctx, const char *data, size_t len)
+{
+    (void)ctx;
+    (void)data;
+    (void)len;
+    return 1;
+}
+
+/*
+ * Covers: RFC 2046 §5.1.1 multipart bodies and RFC 7578 form data.
+ * MUST: the preamble and epilogue MUST be skipped.
+ * MUST: header sections MUST be reported through header_cb, bodies through
+ *       body_cb without the CRLF before the delimiter.
+ * MUST: a prefix of the boundary in a body MUST NOT end the part.
+ */
+void test_multipart(void)
+{
+    TEST_START("test_multipart");
+
+    static mp_log_t log;
+    hwire_ctx_t ctx = {.uctx      = &log,
+                       .header_cb = log_header_cb,
+                       .body_cb   = log_body_cb,
+                       .part_cb   = log_part_cb};
+    hwire_multipart_t mp;
+    const size_t len = sizeof(FORM) - 1;
+    size_t pos       = 0;
+
+    ASSERT_OK(hwire_multipart_init(&mp, BOUNDARY, sizeof(BOUNDARY) - 1, 256,
+                                   8));
+    ASSERT_OK(hwire_multipart_parse(&mp, &ctx, FORM, len, &pos));
+    ASSERT_EQ(pos, len - 25);
+    ASSERT_EQ(mp.state, HWIRE_MULTIPART_DONE);
+    ASSERT_EQ(log.nparts, 3);
+    ASSERT(strcmp(log.text, FORM_LOG) == 0);
+
+    // a finished parser stays done
+    ASSERT_OK(hwire_multipart_parse(&mp, &ctx, "x", 1, &pos));
+    ASSERT_EQ(pos, 0);
+
+    TEST_END();
+}
+
+/*
+ * Covers: streaming input with the caller keeping unconsumed bytes.
+ * MUST: every split of the input MUST produce the same callbacks.
+ * MUST: a delimiter split across fragments MUST be found.
+ * MUST: body bytes MUST be passed exactly once.
+ */
+void test_multipart_stream(void)
+{
+    TEST_START("test_multipart_stream");
+
+    static const char body[] = "preamble\r\n--" BOUNDARY "\r\n"
+                               "Content-Disposition: form-data; name=\"f\"\r\n"
+                               "\r\n"
+                               "\r\n--" "----WebKit\r\r\n\r\n-"
+                               "\r\n--" BOUNDARY "\r\n"
+                               "X: y\r\n"
+                               "\r\n"
+                               "last\r\n--" BOUNDARY "--";
+    // header_cb may see a field again until its section is complete
+    static const char expect[] = "|\r\n--"
+                                 "----WebKit\r\r\n\r\n-"
+                                 "|last";
+    const size_t len           = sizeof(body) - 1;
+    static mp_log_t log;
+    hwire_ctx_t ctx = {.uctx      = &log,
+                       .header_cb = mock_header_cb,
+                       .body_cb   = log_body_cb,
+                       .part_cb   = log_part_cb};
+    hwire_multipart_t mp;
+
+    for (size_t step = 1; step <= len; step++) {
+        size_t start = 0; // first byte not consumed
+        size_t avail = 0; // bytes received so far
+        int rv       = HWIRE_EAGAIN;
+
+        memset(&log, 0, sizeof(log));
+        ASSERT_OK(hwire_multipart_init(&mp, BOUNDARY, sizeof(BOUNDARY) - 1,
+                                       256, 8));
+        while (rv == HWIRE_EAGAIN && avail < len) {
+            size_t pos = 0;
+            avail      = (avail + step > len) ? len : avail + step;
+            rv         = hwire_multipart_parse(&mp, &ctx, body + start,
+                                               avail - start, &pos);
+            // at most a delimiter and the byte after it are held back
+            if (rv == HWIRE_EAGAIN && mp.state == HWIRE_MULTIPART_BODY) {
+                ASSERT(avail - start - pos <= sizeof(BOUNDARY) - 1 + 5);
+            }
+            start += pos;
+        }
+        ASSERT_OK(rv);
+        ASSERT_EQ(start, len);
+        ASSERT_EQ(log.nparts, 2);
+        ASSERT(strcmp(log.text, expect) == 0);
+    }
+
+    TEST_END();
+}
+
+/*
+ * Covers: the vectorized delimiter search.
+ * MUST: the delimiter MUST be found at every offset, also among bytes that
+ *       match its first or last byte.
+ */
+void test_multipart_search(void)
+{
+    TEST_START("test_multipart_search");
+
+    static char buf[4096];
+    static mp_log_t log;
+    hwire_ctx_t ctx = {.uctx      = &log,
+                       .header_cb = log_header_cb,
+                       .body_cb   = log_body_cb};
+    hwire_multipart_t mp;
+    const char head[] = "--b0\r\n\r\n";
+    const size_t hlen = sizeof(head) - 1;
+
+    for (size_t n = 0; n < 300; n++) {
+        size_t len = hlen;
+        memcpy(buf, head, hlen);
+        // content of near misses: CR, '0', "\r\n--b" and "\r\n-b0"
+        for (size_t i = 0; i < n; i++) {
+            static const char fill[] = "\r0\r\n--bx\r\n-b0ab";
+            buf[len++] = fill[(i * 7) % (sizeof(fill) - 1)];
+        }
+        memcpy(buf + len, "\r\n--b0--", 8);
+        len += 8;
+
+        memset(&log, 0, sizeof(log));
+        size_t pos = 0;
+        ASSERT_OK(hwire_multipart_init(&mp, "b0", 2, 256, 8));
+        ASSERT_OK(hwire_multipart_parse(&mp, &ctx, buf, len, &pos));
+        ASSERT_EQ(pos, len);
+        ASSERT_EQ(log.len, n);
+        ASSERT(memcmp(log.text, buf + hlen, n) == 0);
+        // one slice per call
+        ASSERT(log.nslices <= 1);
+    }
+
+    TEST_END();
+}
+
+/*
+ * Covers: boundaries and malformed delimiter lines.
+ * MUST: boundaries MUST be 1*70 bchars not ending with a space.
+ * MUST: a delimiter followed by other than padding CRLF or "--" MUST return
+ *       HWIRE_EILSEQ; errors of hwire_parse_headers MUST be returned.
+ */
+void test_multipart_errors(void)
+{
+    TEST_START("test_multipart_errors");
+
+    hwire_multipart_t mp;
+    hwire_ctx_t ctx = {.header_cb = mock_header_cb};
+    size_t pos      = 0;
+    char b71[72];
+
+    memset(b71, 'a', sizeof(b71));
+    ASSERT_EQ(hwire_multipart_init(&mp, "", 0, 256, 8), HWIRE_ERANGE);
+    ASSERT_EQ(hwire_multipart_init(&mp, b71, 71, 256, 8), HWIRE_ERANGE);
+    ASSERT_OK(hwire_multipart_init(&mp, b71, 70, 256, 8));
+    ASSERT_OK(hwire_multipart_init(&mp, "a'()+_,-./:=? z", 15, 256, 8));
+    ASSERT_EQ(hwire_multipart_init(&mp, "ab ", 3, 256, 8), HWIRE_EILSEQ);
+    ASSERT_EQ(hwire_multipart_init(&mp, "a;b", 3, 256, 8), HWIRE_EILSEQ);
+    ASSERT_EQ(hwire_multipart_init(&mp, "a\"b", 3, 256, 8), HWIRE_EILSEQ);
+    ASSERT_EQ(hwire_multipart_init(&mp, "a\0b", 3, 256, 8), HWIRE_EILSEQ);
+
+    static const struct {
+        const char *body;
+        int rv;
+        size_t pos;
+    } cases[] = {
+        {"--bnd", HWIRE_EAGAIN, 0},
+        {"--bnd\r", HWIRE_EAGAIN, 0},
+        {"--bnd-", HWIRE_EAGAIN, 0},
+        {"--bnd-x", HWIRE_EILSEQ, 0},
+        {"--bnd\n\n", HWIRE_EILSEQ, 0},
+        {"--bnd  x\r\n", HWIRE_EILSEQ, 0},
+        {"--bnd          \r\n", HWIRE_ELEN, 0},
+        {"--bnd\r\nA: 1\r\n", HWIRE_EAGAIN, 7},
+        {"--bnd\r\nA : 1\r\n\r\n", HWIRE_EHDRNAME, 7},
+        {"--bnd\r\nA: 1\r\nB: 2\r\nC: 3\r\n\r\n", HWIRE_ENOBUFS, 7},
+        {"--bnd\r\n\r\nabc\r\n--bnd", HWIRE_EAGAIN, 12},
+        {"--bnd\r\n\r\nabc\r\n--bn", HWIRE_EAGAIN, 12},
+        {"--bnd\r\n\r\nabc\r\n--bx", HWIRE_EAGAIN, 18},
+        {"preamble\r\n--bn", HWIRE_EAGAIN, 8},
+    };
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        ASSERT_OK(hwire_multipart_init(&mp, "bnd", 3, 8, 2));
+        pos = SIZE_MAX;
+        ASSERT_EQ(hwire_multipart_parse(&mp, &ctx, cases[i].body,
+                                        strlen(cases[i].body), &pos),
+                  cases[i].rv);
+        ASSERT_EQ(pos, cases[i].pos);
+    }
+
+    // callback abort
+    ctx.part_cb = fail_part_cb;
+    ASSERT_OK(hwire_multipart_init(&mp, "bnd", 3, 256, 8));
+    ASSERT_EQ(hwire_multipart_parse(&mp, &ctx, "--bnd\r\n", 7, &pos),
+              HWIRE_ECALLBACK);
+    ctx.part_cb = NULL;
+    ctx.body_cb = fail_body_cb;
+    ASSERT_OK(hwire_multipart_init(&mp, "bnd", 3, 256, 8));
+    ASSERT_EQ(hwire_multipart_parse(&mp, &ctx, "--bnd\r\n\r\nabc", 12, &pos),
+              HWIRE_ECALLBACK);
+
+    TEST_END();
+}
+
+int main(void)
+{
+    test_multipart();
+    test_multipart_stream();
+    test_multipart_search();
+    test_multipart_errors();
+    print_test_summary();
+    return g_tests_failed;
+}
@@ -0,0 +1,182 @@
+#include "test_helpers.h"
+
+/*
+ * Covers: RFC 6265 §4.2.1 cookie-string, parsed leniently per §5.4.
+ * MUST: pairs MUST be split at ';' and at the first '=' of each pair.
+ * MUST: OWS around separators MUST be trimmed and empty pairs skipped.
+ * MUST: a pair without '=' MUST be reported with an empty name.
+ */
+void test_parse_cookie(void)
+{
+    TEST_START("test_parse_cookie");
+
+    static const struct {
+        const char *str;
+        uint8_t n;
+        const char *pairs[4][2];
+    } cases[] = {
+        {"", 0, {{0}}},
+        {" ; ;", 0, {{0}}},
+        {"SID=31d4d96e407aad42", 1, {{"SID", "31d4d96e407aad42"}}},
+        {"SID=31d4d96e407aad42; lang=en-US",
+         2,
+         {{"SID", "31d4d96e407aad42"}, {"lang", "en-US"}}},
+        {"a=1;b=2 ;  c = 3 ;", 3, {{"a", "1"}, {"b", "2"}, {"c", "3"}}},
+        {"x=a=b; e=", 2, {{"x", "a=b"}, {"e", ""}}},
+        {"flag; =v", 2, {{"", "flag"}, {"", "v"}}},
+        {"q=\"quoted value\"", 1, {{"q", "\"quoted value\""}}},
+        {"t=a\tb", 1, {{"t", "a\tb"}}},
+    };
+    hwire_kv_pair_t items[4];
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        hwire_kv_array_t cookies = {.items = items};
+        const char *str          = cases[i].str;
+        int rv = hwire_parse_cookie(str, strlen(str), &cookies, 4, NULL);
+        ASSERT_OK(rv);
+        ASSERT_EQ(cookies.count, cases[i].n);
+        for (uint8_t j = 0; j < cookies.count; j++) {
+            ASSERT(str_eq(items[j].key, cases[i].pairs[j][0]));
+            ASSERT(str_eq(items[j].value, cases[i].pairs[j][1]));
+        }
+    }
+
+    TEST_END();
+}
+
+/*
+ * Covers: control characters and the caller's array capacity.
+ * MUST: a CTL other than HT MUST return HWIRE_EILSEQ.
+ * MUST: more pairs than maxcookies MUST return HWIRE_ENOBUFS.
+ */
+void test_parse_cookie_errors(void)
+{
+    TEST_START("test_parse_cookie_errors");
+
+    hwire_kv_pair_t items[2];
+    hwire_kv_array_t cookies = {.items = items};
+
+    static const struct {
+        const char *str;
+        size_t len;
+    } bad[] = {
+        {"a=b\r\n", 5},
+        {"a=\x01", 3},
+        {"a=1; b\x7f=2", 10},
+        {"a=\0", 3},
+    };
+    for (size_t i = 0; i < sizeof(bad) / sizeof(bad[0]); i++) {
+        int rv = hwire_parse_cookie(bad[i].str, bad[i].len, &cookies, 2, NULL);
+        ASSERT_EQ(rv, HWIRE_EILSEQ);
+    }
+
+    const char *str = "a=1; b=2; c=3";
+    ASSERT_EQ(hwire_parse_cookie(str, strlen(str), &cookies, 2, NULL),
+              HWIRE_ENOBUFS);
+    ASSERT_EQ(cookies.count, 2);
+    ASSERT_OK(hwire_parse_cookie(str, 9, &cookies, 2, NULL));
+    ASSERT_EQ(cookies.count, 2);
+
+    // NULL string with length 0
+    ASSERT_OK(hwire_parse_cookie(NULL, 0, &cookies, 2, NULL));
+    ASSERT_EQ(cookies.count, 0);
+
+    TEST_END();
+}
+
+/*
+ * Covers: looking up a single cookie by name.
+ * MUST: only the first pair with that exact name MUST be stored.
+ * MUST: bytes after the match MUST not be examined.
+ * MUST: a missing name MUST return HWIRE_OK with count 0.
+ */
+void test_parse_cookie_lookup(void)
+{
+    TEST_START("test_parse_cookie_lookup");
+
+    hwire_kv_pair_t item;
+    hwire_kv_array_t cookies = {.items = &item};
+    hwire_str_t sid          = {.ptr = "sid", .len = 3};
+
+    // the control byte after the match is never reached
+    const char str[] = "lang=en; SID=upper; sid=s1; sid=s2; bad=\x01";
+    int rv = hwire_parse_cookie(str, sizeof(str) - 1, &cookies, 1, &sid);
+    ASSERT_OK(rv);
+    ASSERT_EQ(cookies.count, 1);
+    ASSERT(str_eq(item.key, "sid"));
+    ASSERT(str_eq(item.value, "s1"));
+    ASSERT(item.value.ptr == str + 24);
+
+    rv = hwire_parse_cookie(str, 18, &cookies, 1, &sid);
+    ASSERT_OK(rv);
+    ASSERT_EQ(cookies.count, 0);
+
+    // a full parse of the same string fails on the control byte
+    hwire_kv_pair_t items[8];
+    hwire_kv_array_t all = {.items = items};
+    rv = hwire_parse_cookie(str, sizeof(str) - 1, &all, 8, NULL);
+    ASSERT_EQ(rv, HWIRE_EILSEQ);
+
+    TEST_END();
+}
+
+/*
+ * Covers: separators and control bytes around SIMD block boundaries.
+ * MUST: results MUST not depend on the position of ';', '=' or a CTL.
+ */
+void test_parse_cookie_simd_boundary(void)
+{
+    TEST_START("test_parse_cookie_simd_boundary");
+
+    char buf[TEST_BUF_SIZE];
+    hwire_kv_pair_t items[2];
+    hwire_kv_array_t cookies = {.items = items};
+
+    for (size_t nlen = 1; nlen <= 40; nlen++) {
+        for (size_t vlen = 0; vlen <= 40; vlen++) {
+            size_t n = 0;
+            memset(buf, 'n', nlen);
+            n += nlen;
+            buf[n++] = '=';
+            memset(buf + n, 'v', vlen);
+            n += vlen;
+            memcpy(buf + n, "; z=1", 5);
+            n += 5;
+
+            ASSERT_OK(hwire_parse_cookie(buf, n, &cookies, 2, NULL));
+            ASSERT_EQ(cookies.count, 2);
+            ASSERT(items[0].key.ptr == buf);
+            ASSERT_EQ(items[0].key.len, nlen);
+            ASSERT(items[0].value.ptr == buf + nlen + 1);
+            ASSERT_EQ(items[0].value.len, vlen);
+            ASSERT(str_eq(items[1].key, "z"));
+            ASSERT(str_eq(items[1].value, "1"));
+
+            hwire_str_t z = {.ptr = "z", .len = 1};
+            ASSERT_OK(hwire_parse_cookie(buf, n, &cookies, 1, &z));
+            ASSERT_EQ(cookies.count, 1);
+            ASSERT(items[0].value.ptr == buf + n - 1);
+
+            // a control byte anywhere in the first pair
+            for (size_t at = 0; at < nlen + 1 + vlen; at++) {
+                char saved = buf[at];
+                buf[at]    = '\x1f';
+                ASSERT_EQ(hwire_parse_cookie(buf, n, &cookies, 2, NULL),
+                          HWIRE_EILSEQ);
+                buf[at] = saved;
+            }
+        }
+    }
+
+    TEST_END();
+}
+
+int main(void)
+{
+    test_parse_cookie();
+    test_parse_cookie_errors();
+    test_parse_cookie_lookup();
+    test_parse_cookie_simd_boundary();
+    print_test_summary();
+    return g_tests_failed;
+}
@@ -412,6 +412,14 @@ void test_parse_headers_rfc_compliance(void)
     pos = 0;
     rv  = hwire_parse_headers(&cb, buf, strlen(buf), &pos, 1024, 10);
     ASSERT_OK(rv);
+    ASSERT_EQ(pos, strlen(buf));
+
+    /* bare LF after a short value: the next header starts right after LF */
+    buf = "A:b\nKey: value\n\n";
+    pos = 0;
+    rv  = hwire_parse_headers(&cb, buf, strlen(buf), &pos, 1024, 10);
+    ASSERT_OK(rv);
+    ASSERT_EQ(pos, strlen(buf));
 
     /* hwire: bare LF as end-of-headers marker (lenient; RFC 9112 §2.2 SHOULD
        accept bare LF in place of CRLF) */
@@ -757,6 +765,339 @@ void test_parse_headers_content_verification(void)
     TEST_END();
 }
 
+typedef struct {
+    uint32_t hashes[8];
+    size_t n;
+} hdr_hash_capture_t;
+
+static int capture_hdr_hash_cb(hwire_ctx_t *ctx, hwire_header_t *header)
+{
+    hdr_hash_capture_t *cap = (hdr_hash_capture_t *)ctx->uctx;
+    if (cap->n < 8) {
+        cap->hashes[cap->n++] = header->hash;
+    }
+    return 0;
+}
+
+/*
+ * Covers: header->hash computed while lowercasing the field-name.
+ * MUST: hash MUST be the CRC32C (Castagnoli) of the lowercased field-name.
+ * MUST: hash MUST NOT depend on the letter case of the input.
+ * MUST: hash MUST equal hwire_hash_key() for every name length, including
+ *       names that span several SIMD blocks.
+ * MUST: hash MUST be 0 when key_lc is not allocated.
+ */
+void test_parse_headers_key_hash(void)
+{
+    TEST_START("test_parse_headers_key_hash");
+
+    char key_storage[TEST_KEY_SIZE];
+
+    // CRC32C check value and well-known field names
+    ASSERT_EQ(hwire_hash_key("123456789", 9), 0xE3069283u);
+    ASSERT_EQ(hwire_hash_key("", 0), 0u);
+    ASSERT_EQ(hwire_hash_key("host", 4), 0x959CFD20u);
+    ASSERT_EQ(hwire_hash_key("Content-Type", 12), 0xD71445A8u);
+    ASSERT_EQ(hwire_hash_key("CONTENT-LENGTH", 14), 0x187B63A4u);
+    ASSERT_EQ(hwire_hash_key("Transfer-Encoding", 17), 0x4FF967FBu);
+
+    // only A-Z are folded: '@' (0x40) and '[' (0x5B) must stay as is
+    ASSERT(hwire_hash_key("@", 1) != hwire_hash_key("`", 1));
+    ASSERT(hwire_hash_key("[", 1) != hwire_hash_key("{", 1));
+
+    /* Case 1: mixed-case names hash like their lowercase form */
+    {
+        hdr_hash_capture_t cap = {0};
+        hwire_ctx_t cb         = {
+                    .uctx      = &cap,
+                    .key_lc    = {.buf = key_storage, .size = sizeof(key_storage)},
+                    .header_cb = capture_hdr_hash_cb
+        };
+        const char *buf = "Host: a\r\n"
+                          "CONNECTION: close\r\n"
+                          "content-type: text/plain\r\n"
+                          "Set-Cookie: x=1\r\n\r\n";
+        size_t pos      = 0;
+        int rv = hwire_parse_headers(&cb, buf, strlen(buf), &pos, 1024, 10);
+        ASSERT_OK(rv);
+        ASSERT_EQ(cap.n, 4);
+        ASSERT_EQ(cap.hashes[0], 0x959CFD20u);
+        ASSERT_EQ(cap.hashes[1], 0x0BAC1178u);
+        ASSERT_EQ(cap.hashes[2], 0xD71445A8u);
+        ASSERT_EQ(cap.hashes[3], 0xCB0CBBE3u);
+    }
+
+    /* Case 2: every name length from 1 to 63 (scalar, SSE and AVX2 blocks) */
+    {
+        char name[TEST_KEY_SIZE];
+        char buf[TEST_BUF_SIZE];
+        for (size_t n = 1; n < sizeof(name); n++) {
+            for (size_t i = 0; i < n; i++) {
+                // alternate case and mix in non-letter tchars
+                name[i] = "aB3-x_Y.z~"[i % 10];
+            }
+            int blen = snprintf(buf, sizeof(buf), "%.*s: v\r\n\r\n", (int)n,
+                                name);
+            hdr_hash_capture_t cap = {0};
+            hwire_ctx_t cb         = {
+                        .uctx      = &cap,
+                        .key_lc    = {.buf = key_storage, .size = sizeof(key_storage)},
+                        .header_cb = capture_hdr_hash_cb
+            };
+            size_t pos = 0;
+            int rv     = hwire_parse_headers(&cb, buf, (size_t)blen, &pos, 1024,
+                                             10);
+            ASSERT_OK(rv);
+            ASSERT_EQ(cap.n, 1);
+            ASSERT_EQ(cap.hashes[0], hwire_hash_key(name, n));
+            ASSERT_EQ(cb.key_lc.hash, hwire_hash_key(name, n));
+        }
+    }
+
+    /* Case 3: no key_lc buffer, hash is not computed */
+    {
+        hdr_hash_capture_t cap = {0};
+        hwire_ctx_t cb = {.uctx = &cap, .header_cb = capture_hdr_hash_cb};
+        const char *buf = "Host: a\r\n\r\n";
+        size_t pos      = 0;
+        int rv = hwire_parse_headers(&cb, buf, strlen(buf), &pos, 1024, 10);
+        ASSERT_OK(rv);
+        ASSERT_EQ(cap.n, 1);
+        ASSERT_EQ(cap.hashes[0], 0u);
+    }
+
+    TEST_END();
+}
+
+/*
+ * Covers: framing fields extracted by hwire_parse_headers (ctx->framing).
+ * MUST: Content-Length MUST be parsed as a 64-bit integer; overflow MUST
+ *       return HWIRE_ERANGE and non-digits HWIRE_EHDRVALUE.
+ * MUST: repeated Content-Length fields MUST agree (HWIRE_ECLDUP).
+ * MUST: only the final transfer coding decides HWIRE_FRAMING_CHUNKED.
+ * MUST: results MUST be identical with and without key_lc.
+ * MUST: header_cb MAY be NULL when framing is set.
+ */
+void test_parse_headers_framing(void)
+{
+    TEST_START("test_parse_headers_framing");
+
+    static const struct {
+        const char *buf;
+        int rv;
+        uint16_t flags;
+        uint64_t content_length;
+    } cases[] = {
+        {"Host: a\r\n\r\n", HWIRE_OK, 0, 0},
+        {"Content-Length: 42\r\n\r\n", HWIRE_OK,
+         HWIRE_FRAMING_CONTENT_LENGTH, 42},
+        {"content-length: 18446744073709551615\r\n\r\n", HWIRE_OK,
+         HWIRE_FRAMING_CONTENT_LENGTH, UINT64_MAX},
+        {"CONTENT-LENGTH: 7\r\nX: y\r\ncontent-length: 7\r\n\r\n", HWIRE_OK,
+         HWIRE_FRAMING_CONTENT_LENGTH, 7},
+        {"Transfer-Encoding: gzip, chunked\r\n\r\n", HWIRE_OK,
+         HWIRE_FRAMING_TRANSFER_ENCODING | HWIRE_FRAMING_CHUNKED, 0},
+        {"Transfer-Encoding: chunked\r\nTransfer-Encoding: gzip\r\n\r\n",
+         HWIRE_OK, HWIRE_FRAMING_TRANSFER_ENCODING, 0},
+        {"transfer-encoding: CHUNKED\r\nConnection: close\r\n\r\n", HWIRE_OK,
+         HWIRE_FRAMING_TRANSFER_ENCODING | HWIRE_FRAMING_CHUNKED |
+             HWIRE_FRAMING_CLOSE,
+         0},
+        // same length as content-length but a different name
+        {"Content-Lengtx: 1\r\n\r\n", HWIRE_OK, 0, 0},
+        {"Content-Length: 18446744073709551616\r\n\r\n", HWIRE_ERANGE, 0, 0},
+        {"Content-Length: 1x\r\n\r\n", HWIRE_EHDRVALUE, 0, 0},
+        {"Content-Length: \r\n\r\n", HWIRE_EHDRVALUE, 0, 0},
+        {"Content-Length: 1\r\nContent-Length: 2\r\n\r\n", HWIRE_ECLDUP, 0, 0},
+    };
+    char key_storage[TEST_KEY_SIZE];
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        for (int with_key_lc = 0; with_key_lc <= 1; with_key_lc++) {
+            hwire_framing_t fr = {.content_length = 99, .flags = 0xFFFF};
+            hwire_ctx_t cb     = {.framing = &fr};
+            size_t pos         = 0;
+            if (with_key_lc) {
+                cb.key_lc.buf  = key_storage;
+                cb.key_lc.size = sizeof(key_storage);
+            }
+            int rv = hwire_parse_headers(&cb, cases[i].buf,
+                                         strlen(cases[i].buf), &pos, 1024, 10);
+            ASSERT_EQ(rv, cases[i].rv);
+            if (rv == HWIRE_OK) {
+                ASSERT_EQ(pos, strlen(cases[i].buf));
+                ASSERT_EQ(fr.flags, cases[i].flags);
+                ASSERT_EQ(fr.content_length, cases[i].content_length);
+            }
+        }
+    }
+
+    /* Case 2: filled through hwire_parse_request as well */
+    {
+        hwire_framing_t fr = {0};
+        hwire_ctx_t cb     = {.framing    = &fr,
+                              .key_lc     = {.buf  = key_storage,
+                                             .size = sizeof(key_storage)},
+                              .request_cb = mock_request_cb};
+        const char *buf    = "POST / HTTP/1.1\r\nContent-Length: 5\r\n\r\n";
+        size_t pos         = 0;
+        int rv = hwire_parse_request(&cb, buf, strlen(buf), &pos, 1024, 10);
+        ASSERT_OK(rv);
+        ASSERT_EQ(fr.flags, HWIRE_FRAMING_CONTENT_LENGTH);
+        ASSERT_EQ(fr.content_length, 5);
+    }
+
+    TEST_END();
+}
+
+/*
+ * Covers: connection semantics collected with the framing fields.
+ * MUST: Connection and Proxy-Connection close / keep-alive / upgrade tokens,
+ *       Upgrade websocket / h2c protocols and Expect: 100-continue MUST set
+ *       their HWIRE_FRAMING_* bits, matched case-insensitively.
+ * MUST: other tokens, and lookalike field names, MUST set nothing.
+ */
+void test_parse_headers_connection(void)
+{
+    TEST_START("test_parse_headers_connection");
+
+    static const struct {
+        const char *buf;
+        uint16_t flags;
+    } cases[] = {
+        {"Connection: Upgrade\r\nUpgrade: websocket\r\n\r\n",
+         HWIRE_FRAMING_UPGRADE | HWIRE_FRAMING_WEBSOCKET},
+        {"Connection: Upgrade, HTTP2-Settings\r\nUpgrade: h2c\r\n"
+         "HTTP2-Settings: AAMAAABkAAQCAAAAAAIAAAAA\r\n\r\n",
+         HWIRE_FRAMING_UPGRADE | HWIRE_FRAMING_H2C},
+        {"upgrade: foo/1, WebSocket/13 , H2C\r\n\r\n",
+         HWIRE_FRAMING_WEBSOCKET | HWIRE_FRAMING_H2C},
+        {"Expect: 100-Continue\r\nContent-Length: 3\r\n\r\n",
+         HWIRE_FRAMING_CONTINUE | HWIRE_FRAMING_CONTENT_LENGTH},
+        {"Proxy-Connection: Keep-Alive\r\n\r\n", HWIRE_FRAMING_KEEP_ALIVE},
+        {"Proxy-Connection: close\r\nConnection: keep-alive\r\n\r\n",
+         HWIRE_FRAMING_CLOSE | HWIRE_FRAMING_KEEP_ALIVE},
+        // unrelated tokens and names
+        {"Connection: upgraded, TE\r\nUpgrade: websockets, h2\r\n"
+         "Expect: 100-continued\r\n\r\n",
+         0},
+        {"Upgradx: websocket\r\nExpecx: 100-continue\r\n"
+         "Proxy-Connectiox: close\r\n\r\n",
+         0},
+    };
+    char key_storage[TEST_KEY_SIZE];
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        for (int with_key_lc = 0; with_key_lc <= 1; with_key_lc++) {
+            hwire_framing_t fr = {0};
+            hwire_ctx_t cb     = {.framing = &fr};
+            size_t pos         = 0;
+            if (with_key_lc) {
+                cb.key_lc.buf  = key_storage;
+                cb.key_lc.size = sizeof(key_storage);
+            }
+            int rv = hwire_parse_headers(&cb, cases[i].buf,
+                                         strlen(cases[i].buf), &pos, 1024, 10);
+            ASSERT_OK(rv);
+            ASSERT_EQ(fr.flags, cases[i].flags);
+        }
+
+        // the scanner fills the same bits
+        hwire_msginfo_t info;
+        char req[512];
+        size_t pos = 0;
+        int n =
+            snprintf(req, sizeof(req), "GET / HTTP/1.1\r\n%s", cases[i].buf);
+        int rv = hwire_scan_message(req, (size_t)n, &pos, 1024, 10, 0, &info);
+        ASSERT_OK(rv);
+        ASSERT_EQ(info.framing.flags, cases[i].flags);
+    }
+
+    TEST_END();
+}
+
+/*
+ * Covers: HWIRE_OPT_HARDENED request-smuggling checks.
+ * MUST: Content-Length with Transfer-Encoding MUST return HWIRE_ECLTE.
+ * MUST: whitespace between field name and colon MUST return HWIRE_EHDRWS
+ *       (RFC 9112 §5.1).
+ * MUST: obs-fold MUST return HWIRE_EOBSFOLD (RFC 9112 §5.2).
+ * MUST: without the option the same input keeps its generic error code.
+ * MUST: the checks MUST NOT depend on ctx->framing or key_lc.
+ */
+void test_parse_headers_hardened(void)
+{
+    TEST_START("test_parse_headers_hardened");
+
+    static const struct {
+        const char *buf;
+        int hardened_rv;
+        int default_rv;
+    } cases[] = {
+        {"Host: a\r\nContent-Length: 3\r\n\r\n", HWIRE_OK, HWIRE_OK},
+        {"Content-Length: 3\r\nTransfer-Encoding: chunked\r\n\r\n",
+         HWIRE_ECLTE, HWIRE_OK},
+        {"transfer-encoding: gzip\r\ncontent-length: 0\r\n\r\n", HWIRE_ECLTE,
+         HWIRE_OK},
+        {"Content-Length: 3\r\nContent-Length: 4\r\n\r\n", HWIRE_ECLDUP,
+         HWIRE_OK},
+        {"Content-Length : 3\r\n\r\n", HWIRE_EHDRWS, HWIRE_EHDRNAME},
+        {"Host\t: a\r\n\r\n", HWIRE_EHDRWS, HWIRE_EHDRNAME},
+        {"Host: a\r\n b\r\n\r\n", HWIRE_EOBSFOLD, HWIRE_EHDRNAME},
+        {"Host: a\r\n\tb\r\n\r\n", HWIRE_EOBSFOLD, HWIRE_EHDRNAME},
+        {" Host: a\r\n\r\n", HWIRE_EOBSFOLD, HWIRE_EHDRNAME},
+        {"Ho(st: a\r\n\r\n", HWIRE_EHDRNAME, HWIRE_EHDRNAME},
+        {"Host x: a\r\n\r\n", HWIRE_EHDRWS, HWIRE_EHDRNAME},
+    };
+    char key_storage[TEST_KEY_SIZE];
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        for (int variant = 0; variant < 4; variant++) {
+            hwire_framing_t fr = {0};
+            hwire_ctx_t cb     = {.header_cb = mock_header_cb};
+            size_t pos         = 0;
+            if (variant & 1) {
+                cb.key_lc.buf  = key_storage;
+                cb.key_lc.size = sizeof(key_storage);
+            }
+            if (variant & 2) {
+                cb.framing = &fr;
+            }
+
+            cb.options = HWIRE_OPT_HARDENED;
+            int rv     = hwire_parse_headers(&cb, cases[i].buf,
+                                             strlen(cases[i].buf), &pos, 1024, 10);
+            ASSERT_EQ(rv, cases[i].hardened_rv);
+            ASSERT_EQ(pos, (rv == HWIRE_OK) ? strlen(cases[i].buf) : 0);
+
+            // duplicate Content-Length is only detected with framing
+            int expect = cases[i].default_rv;
+            if (cases[i].hardened_rv == HWIRE_ECLDUP && cb.framing != NULL) {
+                expect = HWIRE_ECLDUP;
+            }
+            cb.options = 0;
+            pos        = 0;
+            rv         = hwire_parse_headers(&cb, cases[i].buf,
+                                             strlen(cases[i].buf), &pos, 1024, 10);
+            ASSERT_EQ(rv, expect);
+        }
+    }
+
+    /* Case 2: hwire_parse_request in hardened mode */
+    {
+        hwire_ctx_t cb  = {.header_cb  = mock_header_cb,
+                           .request_cb = mock_request_cb,
+                           .options    = HWIRE_OPT_HARDENED};
+        const char *buf = "POST / HTTP/1.1\r\nTransfer-Encoding: chunked\r\n"
+                          "Content-Length: 10\r\n\r\n";
+        size_t pos      = 0;
+        int rv = hwire_parse_request(&cb, buf, strlen(buf), &pos, 1024, 10);
+        ASSERT_EQ(rv, HWIRE_ECLTE);
+    }
+
+    TEST_END();
+}
+
 int main(void)
 {
     test_parse_headers_valid();
@@ -775,6 +1116,10 @@ int main(void)
     test_parse_headers_simd_boundary();
     test_parse_headers_streaming();
     test_parse_headers_content_verification();
+    test_parse_headers_key_hash();
+    test_parse_headers_framing();
+    test_parse_headers_connection();
+    test_parse_headers_hardened();
     print_test_summary();
     return g_tests_failed;
 }
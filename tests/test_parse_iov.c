@@ -0,0 +1,270 @@
+#include "test_helpers.h"
+
+typedef struct {
+    char text[512];
+    size_t len;
+    int count;
+    hwire_str_t last; // most recently reported value or reason
+} iov_log_t;
+
+static void log_str(iov_log_t *log, const char *s, size_t n, char sep)
+{
+    if (log->len + n + 2 < sizeof(log->text)) {
+        memcpy(log->text + log->len, s, n);
+        log->len += n;
+        log->text[log->len++] = sep;
+        log->text[log->len]   = '\0';
+    }
+}
+
+static int log_header_cb(hwire_ctx_t *ctx, hwire_header_t *header)
+{
+    iov_log_t *log = (iov_log_t *)ctx->uctx;
+    log_str(log, header->key.ptr, header->key.len, '=');
+    log_str(log, header->value.ptr, header->value.len, ';');
+    log->last = header->value;
+    log->count++;
+    return 0;
+}
+
+static int log_request_cb(hwire_ctx_t *ctx, hwire_request_t *req)
+{
+    iov_log_t *log = (iov_log_t *)ctx->uctx;
+    log_str(log, req->method.ptr, req->method.len, ' ');
+    log_str(log, req->uri.ptr, req->uri.len, '|');
+    return 0;
+}
+
+static int log_response_cb(hwire_ctx_t *ctx, hwire_response_t *rsp)
+{
+    iov_log_t *log = (iov_log_t *)ctx->uctx;
+    char status[4] = {(char)('0' + rsp->status / 100),
+                      (char)('0' + rsp->status / 10 % 10),
+                      (char)('0' + rsp->status % 10), '\0'};
+    log_str(log, status, 3, ' ');
+    log_str(log, rsp->reason.ptr, rsp->reason.len, '|');
+    return 0;
+}
+
+static const char REQUEST[] = "\r\nPOST /upload?id=42 HTTP/1.1\r\n"
+                              "Host: example.com\r\n"
+                              "Content-Type: text/plain\r\n"
+                              "Content-Length: 5\r\n"
+                              "X-Long: 0123456789abcdef0123456789abcdef\r\n"
+                              "\n"
+                              "hello";
+
+static const char RESPONSE[] = "HTTP/1.1 200 OK\r\n"
+                               "Server: hwire\r\n"
+                               "Transfer-Encoding: chunked\r\n"
+                               "\r\n";
+
+/*
+ * Covers: requests split into two and three segments at every offset.
+ * MUST: callbacks, *pos and framing MUST match hwire_parse_request.
+ * MUST: a line that does not cross a boundary MUST be reported in place.
+ */
+void test_parse_request_iov(void)
+{
+    TEST_START("test_parse_request_iov");
+
+    const size_t len  = sizeof(REQUEST) - 1;
+    iov_log_t ref     = {0};
+    hwire_framing_t fr;
+    char key_buf[TEST_KEY_SIZE];
+    char stitch_buf[TEST_BUF_SIZE];
+    hwire_buf_t stitch = {.size = sizeof(stitch_buf), .buf = stitch_buf};
+    hwire_ctx_t ctx    = {
+           .key_lc     = {.size = sizeof(key_buf), .buf = key_buf},
+           .uctx       = &ref,
+           .request_cb = log_request_cb,
+           .header_cb  = log_header_cb,
+           .framing    = &fr,
+    };
+    size_t ref_pos = 0;
+
+    ASSERT_OK(hwire_parse_request(&ctx, REQUEST, len, &ref_pos, 256, 10));
+    ASSERT_EQ(ref_pos, len - 5);
+
+    for (size_t i = 0; i <= len; i++) {
+        for (size_t j = i; j <= len; j += 7) {
+            hwire_iov_t iov[3] = {{REQUEST, i},
+                                  {REQUEST + i, j - i},
+                                  {REQUEST + j, len - j}};
+            iov_log_t log      = {0};
+            size_t pos         = 0;
+            ctx.uctx           = &log;
+            int rv = hwire_parse_request_iov(&ctx, iov, 3, &pos, 256, 10,
+                                             &stitch);
+            ASSERT_OK(rv);
+            ASSERT_EQ(pos, ref_pos);
+            ASSERT_EQ(log.count, 4);
+            ASSERT(strcmp(log.text, ref.text) == 0);
+            ASSERT_EQ(fr.content_length, 5);
+            // the last field line is in place unless a boundary cuts it
+            if ((i <= len - 48 || i >= len - 6) &&
+                (j <= len - 48 || j >= len - 6)) {
+                ASSERT(str_in_buf(log.last, REQUEST, len));
+            } else {
+                ASSERT(str_in_buf(log.last, stitch_buf, stitch.len));
+            }
+        }
+    }
+
+    TEST_END();
+}
+
+/*
+ * Covers: responses and header blocks given as segments.
+ * MUST: results MUST match the contiguous parsers, with empty segments.
+ */
+void test_parse_response_iov(void)
+{
+    TEST_START("test_parse_response_iov");
+
+    const size_t len = sizeof(RESPONSE) - 1;
+    const size_t hdr = 17; // length of the status line
+    iov_log_t ref    = {0};
+    hwire_framing_t fr;
+    char key_buf[TEST_KEY_SIZE];
+    char stitch_buf[TEST_BUF_SIZE];
+    hwire_buf_t stitch = {.size = sizeof(stitch_buf), .buf = stitch_buf};
+    hwire_ctx_t ctx    = {
+           .key_lc      = {.size = sizeof(key_buf), .buf = key_buf},
+           .uctx        = &ref,
+           .response_cb = log_response_cb,
+           .header_cb   = log_header_cb,
+           .framing     = &fr,
+    };
+    size_t ref_pos = 0;
+
+    ASSERT_OK(hwire_parse_response(&ctx, RESPONSE, len, &ref_pos, 256, 10));
+    ASSERT_EQ(ref_pos, len);
+    ASSERT(strcmp(ref.text, "200 OK|Server=hwire;Transfer-Encoding=chunked;") ==
+           0);
+
+    for (size_t i = 0; i <= len; i++) {
+        hwire_iov_t iov[4] = {{NULL, 0},
+                              {RESPONSE, i},
+                              {RESPONSE + i, 0},
+                              {RESPONSE + i, len - i}};
+        iov_log_t log      = {0};
+        size_t pos         = 0;
+        ctx.uctx           = &log;
+        ASSERT_OK(
+            hwire_parse_response_iov(&ctx, iov, 4, &pos, 256, 10, &stitch));
+        ASSERT_EQ(pos, ref_pos);
+        ASSERT(strcmp(log.text, ref.text) == 0);
+        ASSERT(fr.flags & HWIRE_FRAMING_CHUNKED);
+
+        // the header block alone
+        if (i >= hdr) {
+            iov[1].base = RESPONSE + hdr;
+            iov[1].len  = i - hdr;
+            log         = (iov_log_t){0};
+            ASSERT_OK(
+                hwire_parse_headers_iov(&ctx, iov, 4, &pos, 256, 10, &stitch));
+            ASSERT_EQ(pos, len - hdr);
+            ASSERT_EQ(log.count, 2);
+        }
+    }
+
+    TEST_END();
+}
+
+/*
+ * Covers: incomplete input, stitch capacity and errors across segments.
+ * MUST: a head that ends early MUST return HWIRE_EAGAIN.
+ * MUST: a split line larger than stitch MUST return HWIRE_ENOBUFS.
+ * MUST: errors and hardened checks MUST match the contiguous parsers.
+ */
+void test_parse_iov_errors(void)
+{
+    TEST_START("test_parse_iov_errors");
+
+    char stitch_buf[TEST_BUF_SIZE];
+    hwire_buf_t stitch = {.size = sizeof(stitch_buf), .buf = stitch_buf};
+    hwire_ctx_t ctx    = {.request_cb = mock_request_cb,
+                          .header_cb  = mock_header_cb};
+    size_t pos         = 0;
+
+    // every proper prefix of the head is incomplete
+    const size_t len = sizeof(REQUEST) - 6;
+    for (size_t i = 0; i < len; i++) {
+        hwire_iov_t iov[2] = {{REQUEST, i / 2}, {REQUEST + i / 2, i - i / 2}};
+        ASSERT_EQ(hwire_parse_request_iov(&ctx, iov, 2, &pos, 256, 10,
+                                          &stitch),
+                  HWIRE_EAGAIN);
+    }
+    ASSERT_EQ(hwire_parse_request_iov(&ctx, NULL, 0, &pos, 256, 10, &stitch),
+              HWIRE_EAGAIN);
+
+    // the split field line needs 25 bytes of stitch
+    {
+        static const char a[] = "GET / HTTP/1.1\r\nX: 01";
+        static const char b[] = "234567890123456789\r\n\r\n";
+        hwire_iov_t iov[2]    = {{a, sizeof(a) - 1}, {b, sizeof(b) - 1}};
+        stitch.size           = 16;
+        ASSERT_EQ(hwire_parse_request_iov(&ctx, iov, 2, &pos, 256, 10,
+                                          &stitch),
+                  HWIRE_ENOBUFS);
+        // a field line over maxlen is still reported as such
+        ASSERT_EQ(hwire_parse_request_iov(&ctx, iov, 2, &pos, 14, 10,
+                                          &stitch),
+                  HWIRE_EHDRLEN);
+        stitch.size = 25;
+        ASSERT_OK(hwire_parse_request_iov(&ctx, iov, 2, &pos, 256, 10,
+                                          &stitch));
+        ASSERT_EQ(pos, sizeof(a) + sizeof(b) - 2);
+        stitch.size = sizeof(stitch_buf);
+    }
+
+    static const struct {
+        const char *a;
+        const char *b;
+        unsigned int options;
+        int rv;
+    } cases[] = {
+        {"GET / HTTP/1.1\r\nA: 1\r", "\r\n\r\n", 0, HWIRE_EEOL},
+        {"GET / HTTP/1.1\r\nA", " : 1\r\n\r\n", 0, HWIRE_EHDRNAME},
+        {"GET / HTTP/1.1\r\nA", " : 1\r\n\r\n", HWIRE_OPT_HARDENED,
+         HWIRE_EHDRWS},
+        {"GET / HTTP/1.1\r\nA: 1\r\n", " b\r\n\r\n", HWIRE_OPT_HARDENED,
+         HWIRE_EOBSFOLD},
+        {"GET / HTTP/1.1\r\nContent-Length: 1\r\nTransfer-Enc",
+         "oding: chunked\r\n\r\n", HWIRE_OPT_HARDENED, HWIRE_ECLTE},
+        {"GET / HTTP/1.1\r\nA: 1\r\nB: 2\r\nC", ": 3\r\n\r\n", 0,
+         HWIRE_ENOBUFS},
+        {"G@T / HTTP/1.1\r", "\n\r\n", 0, HWIRE_EMETHOD},
+    };
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        hwire_iov_t iov[2] = {{cases[i].a, strlen(cases[i].a)},
+                              {cases[i].b, strlen(cases[i].b)}};
+        ctx.options        = cases[i].options;
+        ASSERT_EQ(hwire_parse_request_iov(&ctx, iov, 2, &pos, 256, 2,
+                                          &stitch),
+                  cases[i].rv);
+    }
+
+    // callback abort
+    {
+        hwire_iov_t iov[2] = {{RESPONSE, 10},
+                              {RESPONSE + 10, sizeof(RESPONSE) - 11}};
+        ctx.options        = 0;
+        ctx.response_cb    = mock_response_cb_fail;
+        ASSERT_EQ(hwire_parse_response_iov(&ctx, iov, 2, &pos, 256, 10,
+                                           &stitch),
+                  HWIRE_ECALLBACK);
+    }
+
+    TEST_END();
+}
+
+int main(void)
+{
+    test_parse_request_iov();
+    test_parse_response_iov();
+    test_parse_iov_errors();
+    print_test_summary();
+    return g_tests_failed;
+}
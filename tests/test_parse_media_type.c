@@ -0,0 +1,147 @@
+#include "test_helpers.h"
+
+typedef struct {
+    char text[TEST_BUF_SIZE];
+    size_t len;
+    int count;
+} param_log_t;
+
+// append "name=value;" for each parameter, with the lowercased name
+static int log_param_cb(hwire_ctx_t *ctx, hwire_param_t *param)
+{
+    param_log_t *log = (param_log_t *)ctx->uctx;
+    size_t n         = ctx->key_lc.len + param->value.len + 2;
+    if (log->len + n >= sizeof(log->text)) {
+        return 1;
+    }
+    memcpy(log->text + log->len, ctx->key_lc.buf, ctx->key_lc.len);
+    log->len += ctx->key_lc.len;
+    log->text[log->len++] = '=';
+    memcpy(log->text + log->len, param->value.ptr, param->value.len);
+    log->len += param->value.len;
+    log->text[log->len++] = ';';
+    log->text[log->len]   = '\0';
+    log->count++;
+    return 0;
+}
+
+/*
+ * Covers: RFC 9110 §8.3.1 media-type = type "/" subtype parameters.
+ * MUST: well-known types MUST be identified regardless of case.
+ * MUST: type and subtype MUST reference the input as sent.
+ * MUST: parameters MUST be passed to param_cb with lowercased names.
+ */
+void test_parse_media_type(void)
+{
+    TEST_START("test_parse_media_type");
+
+    static const struct {
+        const char *str;
+        hwire_media_id_t id;
+        size_t typelen;
+        size_t sublen;
+        const char *params;
+    } cases[] = {
+        {"application/json", HWIRE_MEDIA_APPLICATION_JSON, 11, 4, ""},
+        {"text/html; charset=utf-8", HWIRE_MEDIA_TEXT_HTML, 4, 4,
+         "charset=utf-8;"},
+        {"Text/HTML;Charset=\"UTF-8\"", HWIRE_MEDIA_TEXT_HTML, 4, 4,
+         "charset=UTF-8;"},
+        {"multipart/form-data; boundary=----WebKitFormBoundary7MA4YWxk",
+         HWIRE_MEDIA_MULTIPART_FORM_DATA, 9, 9,
+         "boundary=----WebKitFormBoundary7MA4YWxk;"},
+        {"APPLICATION/X-WWW-FORM-URLENCODED", HWIRE_MEDIA_APPLICATION_FORM, 11,
+         21, ""},
+        {"image/svg+xml", HWIRE_MEDIA_IMAGE_SVG, 5, 7, ""},
+        {"text/plain ; charset=us-ascii ; format=flowed",
+         HWIRE_MEDIA_TEXT_PLAIN, 4, 5, "charset=us-ascii;format=flowed;"},
+        // empty parameters are allowed
+        {"text/plain;", HWIRE_MEDIA_TEXT_PLAIN, 4, 5, ""},
+        {"text/plain;;a=1; ", HWIRE_MEDIA_TEXT_PLAIN, 4, 5, "a=1;"},
+        // valid media types that are not well-known
+        {"text/json", HWIRE_MEDIA_OTHER, 4, 4, ""},
+        {"application/jsonx", HWIRE_MEDIA_OTHER, 11, 5, ""},
+        {"application/vnd.openxmlformats-officedocument.spreadsheetml.sheet",
+         HWIRE_MEDIA_OTHER, 11, 53, ""},
+        {"x-really-long-experimental-type-name-here/json", HWIRE_MEDIA_OTHER,
+         41, 4, ""},
+    };
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        param_log_t log = {0};
+        char key_buf[TEST_KEY_SIZE];
+        hwire_ctx_t ctx = {.key_lc   = {.size = sizeof(key_buf),
+                                        .buf  = key_buf},
+                           .uctx     = &log,
+                           .param_cb = log_param_cb};
+        hwire_media_type_t mt;
+        const char *str = cases[i].str;
+
+        ASSERT_OK(hwire_parse_media_type(&ctx, str, strlen(str), &mt, 4));
+        ASSERT_EQ(mt.id, cases[i].id);
+        ASSERT(mt.type.ptr == str);
+        ASSERT_EQ(mt.type.len, cases[i].typelen);
+        ASSERT(mt.subtype.ptr == str + cases[i].typelen + 1);
+        ASSERT_EQ(mt.subtype.len, cases[i].sublen);
+        ASSERT(strcmp(log.text, cases[i].params) == 0);
+    }
+
+    TEST_END();
+}
+
+/*
+ * Covers: malformed media types and parameter limits.
+ * MUST: a type or subtype that is not a token MUST return HWIRE_EILSEQ.
+ * MUST: a truncated parameter or trailing bytes MUST return HWIRE_EILSEQ.
+ * MUST: more parameters than maxnparams MUST return HWIRE_ENOBUFS.
+ */
+void test_parse_media_type_errors(void)
+{
+    TEST_START("test_parse_media_type_errors");
+
+    static const struct {
+        const char *str;
+        int rv;
+    } cases[] = {
+        {"", HWIRE_EILSEQ},
+        {"text", HWIRE_EILSEQ},
+        {"text/", HWIRE_EILSEQ},
+        {"/html", HWIRE_EILSEQ},
+        {"text /html", HWIRE_EILSEQ},
+        {"text/ html", HWIRE_EILSEQ},
+        {"te(t/html", HWIRE_EILSEQ},
+        {"text/html/x", HWIRE_EILSEQ},
+        {"text/html charset=utf-8", HWIRE_EILSEQ},
+        {"text/html; charset", HWIRE_EILSEQ},
+        {"text/html; charset=", HWIRE_EILSEQ},
+        {"text/html; charset=\"utf-8", HWIRE_EILSEQ},
+        {"text/html; =utf-8", HWIRE_EILSEQ},
+        {"text/html; a=1; b=2; c=3", HWIRE_ENOBUFS},
+    };
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        hwire_ctx_t ctx = {.param_cb = mock_param_cb};
+        hwire_media_type_t mt;
+        ASSERT_EQ(hwire_parse_media_type(&ctx, cases[i].str,
+                                         strlen(cases[i].str), &mt, 2),
+                  cases[i].rv);
+    }
+
+    // callback abort
+    {
+        hwire_ctx_t ctx = {.param_cb = mock_param_cb_fail};
+        hwire_media_type_t mt;
+        ASSERT_EQ(hwire_parse_media_type(&ctx, "text/html; a=1", 14, &mt, 2),
+                  HWIRE_ECALLBACK);
+    }
+
+    TEST_END();
+}
+
+int main(void)
+{
+    test_parse_media_type();
+    test_parse_media_type_errors();
+    print_test_summary();
+    return g_tests_failed;
+}
@@ -0,0 +1,389 @@
+#include "test_helpers.h"
+
+typedef struct {
+    char body[TEST_BUF_SIZE];
+    size_t body_len;
+    int nbody;
+    int nchunks;
+    int ntrailers;
+    int fail_body;
+} msg_capture_t;
+
+static int capture_body_cb(hwire_ctx_t *ctx, const char *data, size_t len)
+{
+    msg_capture_t *cap = (msg_capture_t *)ctx->uctx;
+    if (cap->fail_body) {
+        return 1;
+    } else if (cap->body_len + len > sizeof(cap->body)) {
+        return 1;
+    }
+    memcpy(cap->body + cap->body_len, data, len);
+    cap->body_len += len;
+    cap->nbody++;
+    return 0;
+}
+
+static int count_chunksize_cb(hwire_ctx_t *ctx, uint32_t size)
+{
+    msg_capture_t *cap = (msg_capture_t *)ctx->uctx;
+    (void)size;
+    cap->nchunks++;
+    return 0;
+}
+
+static int count_header_cb(hwire_ctx_t *ctx, hwire_header_t *header)
+{
+    msg_capture_t *cap = (msg_capture_t *)ctx->uctx;
+    (void)header;
+    cap->ntrailers++;
+    return 0;
+}
+
+static void ctx_init(hwire_ctx_t *ctx, msg_capture_t *cap)
+{
+    memset(ctx, 0, sizeof(*ctx));
+    memset(cap, 0, sizeof(*cap));
+    ctx->uctx         = cap;
+    ctx->request_cb   = mock_request_cb;
+    ctx->response_cb  = mock_response_cb;
+    ctx->header_cb    = mock_header_cb;
+    ctx->body_cb      = capture_body_cb;
+    ctx->chunksize_cb = count_chunksize_cb;
+}
+
+/*
+ * Feed buf to the message parser in fragments of at most step bytes,
+ * keeping unconsumed bytes like a network read buffer would.
+ * Returns the final result; *consumed is the total number of bytes consumed.
+ */
+static int feed(hwire_msg_parser_t *msg, hwire_ctx_t *ctx, const char *buf,
+                size_t len, size_t step, size_t *consumed)
+{
+    size_t off   = 0;
+    size_t avail = 0;
+    int rv       = HWIRE_EAGAIN;
+
+    while (rv == HWIRE_EAGAIN && avail < len) {
+        size_t pos = 0;
+        avail      = (avail + step > len) ? len : avail + step;
+        rv         = hwire_msg_parse(msg, ctx, buf + off, avail - off, &pos);
+        if (rv == HWIRE_OK || rv == HWIRE_EAGAIN) {
+            off += pos;
+        }
+    }
+    *consumed = off;
+    return rv;
+}
+
+/*
+ * Covers: RFC 9112 §6.3 fixed-length body.
+ * MUST: the body MUST be delivered exactly once regardless of how the input
+ *       is fragmented, and parsing MUST stop at Content-Length.
+ */
+void test_msg_content_length(void)
+{
+    TEST_START("test_msg_content_length");
+
+    static const char buf[] = "POST /upload HTTP/1.1\r\n"
+                              "Host: example.com\r\n"
+                              "Content-Length: 11\r\n"
+                              "\r\n"
+                              "hello world"
+                              "GET /next HTTP/1.1\r\n\r\n";
+    const size_t msglen     = sizeof(buf) - 1 - 22;
+
+    for (size_t step = 1; step <= sizeof(buf); step++) {
+        hwire_ctx_t ctx;
+        msg_capture_t cap;
+        hwire_msg_parser_t msg;
+        size_t consumed = 0;
+        ctx_init(&ctx, &cap);
+        hwire_msg_init(&msg, 0, 1024, 10, 4);
+
+        int rv = feed(&msg, &ctx, buf, sizeof(buf) - 1, step, &consumed);
+        ASSERT_OK(rv);
+        ASSERT_EQ(consumed, msglen);
+        ASSERT_EQ(msg.state, HWIRE_MSG_DONE);
+        ASSERT_EQ(msg.info.body, HWIRE_BODY_LENGTH);
+        ASSERT_EQ(msg.info.framing.content_length, 11);
+        ASSERT_EQ(cap.body_len, 11);
+        ASSERT(memcmp(cap.body, "hello world", 11) == 0);
+
+        // pipelined request follows right after the body
+        size_t pos = 0;
+        hwire_msg_init(&msg, 0, 1024, 10, 4);
+        rv = hwire_msg_parse(&msg, &ctx, buf + consumed,
+                             sizeof(buf) - 1 - consumed, &pos);
+        ASSERT_OK(rv);
+        ASSERT_EQ(pos, 22);
+        ASSERT_EQ(msg.info.body, HWIRE_BODY_NONE);
+    }
+
+    TEST_END();
+}
+
+/*
+ * Covers: RFC 9112 §7.1 chunked transfer coding and trailer section.
+ * MUST: chunk-data MUST be delivered in order without chunk framing.
+ * MUST: chunk-data MUST be followed by CRLF.
+ * MUST: trailer fields MUST be passed to header_cb.
+ * MUST: RFC 9112 §6.1 a chunked HTTP/1.0 message MUST NOT be persistent.
+ */
+void test_msg_chunked(void)
+{
+    TEST_START("test_msg_chunked");
+
+    static const char buf[] = "HTTP/1.1 200 OK\r\n"
+                              "Transfer-Encoding: chunked\r\n"
+                              "\r\n"
+                              "5;name=value\r\nhello\r\n"
+                              "1\r\n \r\n"
+                              "A\r\n0123456789\r\n"
+                              "0\r\n"
+                              "Checksum: abc\r\n"
+                              "Expires: never\r\n"
+                              "\r\n";
+
+    for (size_t step = 1; step <= sizeof(buf); step++) {
+        hwire_ctx_t ctx;
+        msg_capture_t cap;
+        hwire_msg_parser_t msg;
+        size_t consumed = 0;
+        ctx_init(&ctx, &cap);
+        hwire_msg_init(&msg, HWIRE_SCAN_RESPONSE, 1024, 10, 4);
+
+        int rv = feed(&msg, &ctx, buf, sizeof(buf) - 1, step, &consumed);
+        ASSERT_OK(rv);
+        ASSERT_EQ(consumed, sizeof(buf) - 1);
+        ASSERT_EQ(msg.info.body, HWIRE_BODY_CHUNKED);
+        ASSERT_EQ(cap.body_len, 16);
+        ASSERT(memcmp(cap.body, "hello 0123456789", 16) == 0);
+        ASSERT(cap.nchunks >= 4);
+    }
+
+    /* trailer fields reach header_cb; the index keeps the header section */
+    {
+        hwire_hdr_entry_t entries[4];
+        uint8_t buckets[8];
+        char names[64];
+        hwire_hdr_index_t idx = {.entries  = entries,
+                                 .buckets  = buckets,
+                                 .names    = {.buf = names, .size = 64},
+                                 .nbuckets = 8,
+                                 .nentries = 4};
+        char key_storage[TEST_KEY_SIZE];
+        hwire_ctx_t ctx;
+        msg_capture_t cap;
+        hwire_msg_parser_t msg;
+        size_t pos = 0;
+        ctx_init(&ctx, &cap);
+        ctx.key_lc.buf  = key_storage;
+        ctx.key_lc.size = sizeof(key_storage);
+        ctx.hdr_index   = &idx;
+        ctx.header_cb   = count_header_cb;
+        hwire_msg_init(&msg, HWIRE_SCAN_RESPONSE, 1024, 10, 4);
+
+        int rv = hwire_msg_parse(&msg, &ctx, buf, sizeof(buf) - 1, &pos);
+        ASSERT_OK(rv);
+        // Expires is forbidden in trailers and dropped
+        ASSERT_EQ(cap.ntrailers, 2);
+        ASSERT_EQ(idx.count, 1);
+        ASSERT(hwire_hdr_index_get(&idx, "transfer-encoding", 17) != NULL);
+    }
+
+    /* HTTP/1.0 with Transfer-Encoding closes even with keep-alive */
+    {
+        hwire_ctx_t ctx;
+        msg_capture_t cap;
+        hwire_msg_parser_t msg;
+        size_t pos = 0;
+        const char *req = "POST / HTTP/1.0\r\nTransfer-Encoding: chunked\r\n"
+                          "Connection: keep-alive\r\n"
+                          "\r\n3\r\nabc\r\n0\r\n\r\n";
+        ctx_init(&ctx, &cap);
+        hwire_msg_init(&msg, 0, 1024, 10, 4);
+        int rv = hwire_msg_parse(&msg, &ctx, req, strlen(req), &pos);
+        ASSERT_OK(rv);
+        ASSERT_EQ(pos, strlen(req));
+        ASSERT_EQ(msg.info.body, HWIRE_BODY_CHUNKED);
+        ASSERT_EQ(msg.info.keep_alive, 0);
+        ASSERT_EQ(cap.body_len, 3);
+    }
+
+    /* missing CRLF after chunk-data */
+    {
+        hwire_ctx_t ctx;
+        msg_capture_t cap;
+        hwire_msg_parser_t msg;
+        size_t pos = 0;
+        const char *bad = "POST / HTTP/1.1\r\nTransfer-Encoding: chunked\r\n"
+                          "\r\n3\r\nabcX\r\n0\r\n\r\n";
+        ctx_init(&ctx, &cap);
+        hwire_msg_init(&msg, 0, 1024, 10, 4);
+        int rv = hwire_msg_parse(&msg, &ctx, bad, strlen(bad), &pos);
+        ASSERT_EQ(rv, HWIRE_EEOL);
+    }
+
+    /* invalid chunk-size */
+    {
+        hwire_ctx_t ctx;
+        msg_capture_t cap;
+        hwire_msg_parser_t msg;
+        size_t pos = 0;
+        const char *bad = "POST / HTTP/1.1\r\nTransfer-Encoding: chunked\r\n"
+                          "\r\nzz\r\n";
+        ctx_init(&ctx, &cap);
+        hwire_msg_init(&msg, 0, 1024, 10, 4);
+        int rv = hwire_msg_parse(&msg, &ctx, bad, strlen(bad), &pos);
+        ASSERT_EQ(rv, HWIRE_EILSEQ);
+    }
+
+    TEST_END();
+}
+
+/*
+ * Covers: RFC 9112 §6.3 responses without body and close-delimited bodies.
+ * MUST: responses to HEAD and 204/304 MUST complete after the header
+ *       section.
+ * MUST: a close-delimited body MUST be completed by hwire_msg_eof.
+ */
+void test_msg_response_framing(void)
+{
+    TEST_START("test_msg_response_framing");
+
+    hwire_ctx_t ctx;
+    msg_capture_t cap;
+    hwire_msg_parser_t msg;
+    size_t pos;
+    int rv;
+    const char *buf;
+
+    /* HEAD response advertises a length but has no body */
+    buf = "HTTP/1.1 200 OK\r\nContent-Length: 100\r\n\r\n";
+    ctx_init(&ctx, &cap);
+    hwire_msg_init(&msg, HWIRE_SCAN_RESPONSE | HWIRE_SCAN_HEAD, 1024, 10, 4);
+    pos = 0;
+    rv  = hwire_msg_parse(&msg, &ctx, buf, strlen(buf), &pos);
+    ASSERT_OK(rv);
+    ASSERT_EQ(pos, strlen(buf));
+    ASSERT_EQ(cap.nbody, 0);
+
+    /* 304 */
+    buf = "HTTP/1.1 304 Not Modified\r\nContent-Length: 100\r\n\r\nX";
+    hwire_msg_init(&msg, HWIRE_SCAN_RESPONSE, 1024, 10, 4);
+    pos = 0;
+    rv  = hwire_msg_parse(&msg, &ctx, buf, strlen(buf), &pos);
+    ASSERT_OK(rv);
+    ASSERT_EQ(pos, strlen(buf) - 1);
+
+    /* close-delimited body */
+    buf = "HTTP/1.0 200 OK\r\n\r\nfirst";
+    ctx_init(&ctx, &cap);
+    hwire_msg_init(&msg, HWIRE_SCAN_RESPONSE, 1024, 10, 4);
+    pos = 0;
+    rv  = hwire_msg_parse(&msg, &ctx, buf, strlen(buf), &pos);
+    ASSERT_EQ(rv, HWIRE_EAGAIN);
+    ASSERT_EQ(pos, strlen(buf));
+    ASSERT_EQ(msg.state, HWIRE_MSG_CLOSE_BODY);
+    ASSERT_EQ(msg.info.keep_alive, 0);
+    rv = hwire_msg_parse(&msg, &ctx, "second", 6, &pos);
+    ASSERT_EQ(rv, HWIRE_EAGAIN);
+    ASSERT_EQ(pos, 6);
+    ASSERT_OK(hwire_msg_eof(&msg));
+    ASSERT_EQ(cap.body_len, 11);
+    ASSERT(memcmp(cap.body, "firstsecond", 11) == 0);
+
+    /* connection closed in the middle of a fixed-length body */
+    buf = "HTTP/1.1 200 OK\r\nContent-Length: 10\r\n\r\nabc";
+    hwire_msg_init(&msg, HWIRE_SCAN_RESPONSE, 1024, 10, 4);
+    pos = 0;
+    rv  = hwire_msg_parse(&msg, &ctx, buf, strlen(buf), &pos);
+    ASSERT_EQ(rv, HWIRE_EAGAIN);
+    ASSERT_EQ(msg.remaining, 7);
+    ASSERT_EQ(hwire_msg_eof(&msg), HWIRE_EAGAIN);
+
+    TEST_END();
+}
+
+/*
+ * Covers: error propagation.
+ * MUST: head errors MUST be reported as by hwire_parse_request.
+ * MUST: a non-zero body_cb result MUST stop parsing with HWIRE_ECALLBACK.
+ * MUST: HWIRE_OPT_HARDENED MUST apply to the head and the trailer section.
+ */
+void test_msg_errors(void)
+{
+    TEST_START("test_msg_errors");
+
+    hwire_ctx_t ctx;
+    msg_capture_t cap;
+    hwire_msg_parser_t msg;
+    size_t pos;
+    int rv;
+    const char *buf;
+
+    buf = "GET / HTTP/1.1\r\nBad Name: x\r\n\r\n";
+    ctx_init(&ctx, &cap);
+    hwire_msg_init(&msg, 0, 1024, 10, 4);
+    pos = 0;
+    rv  = hwire_msg_parse(&msg, &ctx, buf, strlen(buf), &pos);
+    ASSERT_EQ(rv, HWIRE_EHDRNAME);
+
+    buf = "POST / HTTP/1.1\r\nTransfer-Encoding: gzip\r\n\r\n";
+    hwire_msg_init(&msg, 0, 1024, 10, 4);
+    pos = 0;
+    rv  = hwire_msg_parse(&msg, &ctx, buf, strlen(buf), &pos);
+    ASSERT_EQ(rv, HWIRE_EHDRVALUE);
+
+    buf = "POST / HTTP/1.1\r\nContent-Length: 3\r\n\r\nabc";
+    cap.fail_body = 1;
+    hwire_msg_init(&msg, 0, 1024, 10, 4);
+    pos = 0;
+    rv  = hwire_msg_parse(&msg, &ctx, buf, strlen(buf), &pos);
+    ASSERT_EQ(rv, HWIRE_ECALLBACK);
+
+    /* body_cb is optional */
+    ctx.body_cb = NULL;
+    hwire_msg_init(&msg, 0, 1024, 10, 4);
+    pos = 0;
+    rv  = hwire_msg_parse(&msg, &ctx, buf, strlen(buf), &pos);
+    ASSERT_OK(rv);
+    ASSERT_EQ(pos, strlen(buf));
+
+    /* hardened mode covers the head and the trailer section */
+    ctx.options = HWIRE_OPT_HARDENED;
+    buf = "POST / HTTP/1.1\r\nContent-Length: 3\r\n"
+          "Transfer-Encoding: chunked\r\n\r\n0\r\n\r\n";
+    hwire_msg_init(&msg, 0, 1024, 10, 4);
+    pos = 0;
+    rv  = hwire_msg_parse(&msg, &ctx, buf, strlen(buf), &pos);
+    ASSERT_EQ(rv, HWIRE_ECLTE);
+    buf = "POST / HTTP/1.1\r\nTransfer-Encoding: chunked\r\n\r\n"
+          "0\r\nX: a\r\n b\r\n\r\n";
+    hwire_msg_init(&msg, 0, 1024, 10, 4);
+    pos = 0;
+    rv  = hwire_msg_parse(&msg, &ctx, buf, strlen(buf), &pos);
+    ASSERT_EQ(rv, HWIRE_EOBSFOLD);
+    ctx.options = 0;
+
+    /* incomplete head consumes nothing */
+    buf = "GET / HTTP/1.1\r\nHost: a";
+    hwire_msg_init(&msg, 0, 1024, 10, 4);
+    pos = 123;
+    rv  = hwire_msg_parse(&msg, &ctx, buf, strlen(buf), &pos);
+    ASSERT_EQ(rv, HWIRE_EAGAIN);
+    ASSERT_EQ(pos, 0);
+    ASSERT_EQ(msg.state, HWIRE_MSG_HEAD);
+
+    TEST_END();
+}
+
+int main(void)
+{
+    test_msg_content_length();
+    test_msg_chunked();
+    test_msg_response_framing();
+    test_msg_errors();
+    print_test_summary();
+    return g_tests_failed;
+}
@@ -614,6 +614,176 @@ void test_parse_request_content_verification(void)
     TEST_END();
 }
 
+static int capture_request_cb(hwire_ctx_t *ctx, hwire_request_t *req)
+{
+    *(hwire_request_t *)ctx->uctx = *req;
+    return 0;
+}
+
+/*
+ * Covers: request-line scanned in 16/32-byte blocks.
+ * MUST: method and request-target MUST be delimited correctly wherever the
+ *       SP separators fall relative to block boundaries.
+ * MUST: an invalid request-target character at any offset → HWIRE_EURI.
+ * MUST: a request-target of exactly maxlen bytes is accepted; one byte more
+ *       → HWIRE_ELEN.
+ */
+void test_parse_request_line_simd_boundary(void)
+{
+    TEST_START("test_parse_request_line_simd_boundary");
+
+    char buf[TEST_BUF_SIZE];
+    hwire_request_t req;
+    hwire_ctx_t cb = {.uctx       = &req,
+                      .request_cb = capture_request_cb,
+                      .header_cb  = mock_header_cb};
+
+    for (size_t mlen = 1; mlen <= 40; mlen++) {
+        for (size_t ulen = 1; ulen <= 80; ulen++) {
+            size_t n = 0;
+            memset(buf + n, 'M', mlen);
+            n += mlen;
+            buf[n++] = ' ';
+            buf[n++] = '/';
+            memset(buf + n, 'u', ulen - 1);
+            n += ulen - 1;
+            memcpy(buf + n, " HTTP/1.1\r\n\r\n", 13);
+            n += 13;
+
+            size_t pos = 0;
+            memset(&req, 0, sizeof(req));
+            int rv = hwire_parse_request(&cb, buf, n, &pos, 1024, 10);
+            ASSERT_OK(rv);
+            ASSERT_EQ(pos, n);
+            ASSERT_EQ(req.method.len, mlen);
+            ASSERT(req.method.ptr == buf);
+            ASSERT_EQ(req.uri.len, ulen);
+            ASSERT(req.uri.ptr == buf + mlen + 1);
+            ASSERT_EQ(req.version, HWIRE_HTTP_V11);
+
+            // exactly maxlen is accepted, one byte over is not
+            pos = 0;
+            rv  = hwire_parse_request(&cb, buf, n, &pos, ulen, 10);
+            ASSERT_OK(rv);
+            pos = 0;
+            rv  = hwire_parse_request(&cb, buf, n, &pos, ulen - 1, 10);
+            ASSERT_EQ(rv, HWIRE_ELEN);
+
+            // invalid character at every request-target offset
+            for (size_t i = 1; i < ulen; i++) {
+                char *p = &buf[mlen + 1 + i];
+                char c  = *p;
+                *p      = '<';
+                pos     = 0;
+                rv      = hwire_parse_request(&cb, buf, n, &pos, 1024, 10);
+                *p      = c;
+                ASSERT_EQ(rv, HWIRE_EURI);
+            }
+
+            // truncated anywhere before the version → HWIRE_EAGAIN
+            pos = 0;
+            rv  = hwire_parse_request(&cb, buf, mlen + 1 + ulen, &pos, 1024, 10);
+            ASSERT_EQ(rv, HWIRE_EAGAIN);
+        }
+
+        // invalid method character at the end of the method
+        {
+            size_t n = 0;
+            memset(buf, 'M', mlen);
+            n += mlen;
+            memcpy(buf + n, "@ / HTTP/1.1\r\n\r\n", 17);
+            n += 17;
+            size_t pos = 0;
+            int rv     = hwire_parse_request(&cb, buf, n, &pos, 1024, 10);
+            ASSERT_EQ(rv, HWIRE_EMETHOD);
+        }
+    }
+
+    TEST_END();
+}
+
+/*
+ * Covers: RFC 9112 §3.2 request-target forms and path / query split.
+ * MUST: path MUST be uri before the first '?', query MUST follow it.
+ * MUST: query.ptr MUST be NULL without '?', and non-NULL for an empty query.
+ * MUST: a '?' outside the request-target MUST NOT be reported.
+ * MUST: the split MUST not depend on where '?' falls relative to blocks.
+ */
+void test_parse_request_target_split(void)
+{
+    TEST_START("test_parse_request_target_split");
+
+    static const struct {
+        const char *buf;
+        const char *path;
+        const char *query; // NULL = no query
+        hwire_target_form_t form;
+    } cases[] = {
+        {"GET / HTTP/1.1\r\n\r\n", "/", NULL, HWIRE_TARGET_ORIGIN},
+        {"GET /a/b?x=1&y=2 HTTP/1.1\r\n\r\n", "/a/b", "x=1&y=2",
+         HWIRE_TARGET_ORIGIN},
+        {"GET /a? HTTP/1.1\r\n\r\n", "/a", "", HWIRE_TARGET_ORIGIN},
+        {"GET /?a?b HTTP/1.1\r\n\r\n", "/", "a?b", HWIRE_TARGET_ORIGIN},
+        {"GET /a HTTP/1.1\r\nX: ?\r\n\r\n", "/a", NULL, HWIRE_TARGET_ORIGIN},
+        {"GET http://example.com/p?q HTTP/1.1\r\n\r\n", "http://example.com/p",
+         "q", HWIRE_TARGET_ABSOLUTE},
+        {"CONNECT example.com:443 HTTP/1.1\r\n\r\n", "example.com:443", NULL,
+         HWIRE_TARGET_AUTHORITY},
+        {"OPTIONS * HTTP/1.1\r\n\r\n", "*", NULL, HWIRE_TARGET_ASTERISK},
+        {"OPTIONS *x HTTP/1.1\r\n\r\n", "*x", NULL, HWIRE_TARGET_ABSOLUTE},
+    };
+    hwire_request_t req;
+    hwire_ctx_t cb = {.uctx       = &req,
+                      .request_cb = capture_request_cb,
+                      .header_cb  = mock_header_cb};
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        size_t pos = 0;
+        memset(&req, 0, sizeof(req));
+        int rv = hwire_parse_request(&cb, cases[i].buf, strlen(cases[i].buf),
+                                     &pos, 1024, 10);
+        ASSERT_OK(rv);
+        ASSERT_EQ(req.form, cases[i].form);
+        ASSERT(req.path.ptr == req.uri.ptr);
+        ASSERT_EQ(req.path.len, strlen(cases[i].path));
+        ASSERT(memcmp(req.path.ptr, cases[i].path, req.path.len) == 0);
+        if (cases[i].query == NULL) {
+            ASSERT(req.query.ptr == NULL);
+            ASSERT_EQ(req.query.len, 0);
+        } else {
+            ASSERT(req.query.ptr == req.uri.ptr + req.path.len + 1);
+            ASSERT_EQ(req.query.len, strlen(cases[i].query));
+            ASSERT(memcmp(req.query.ptr, cases[i].query, req.query.len) == 0);
+        }
+    }
+
+    /* '?' at every offset for methods ending around block boundaries */
+    char buf[TEST_BUF_SIZE];
+    for (size_t mlen = 1; mlen <= 34; mlen++) {
+        for (size_t q = 1; q < 70; q++) {
+            size_t n = 0;
+            memset(buf, 'M', mlen);
+            n += mlen;
+            buf[n++] = ' ';
+            buf[n++] = '/';
+            memset(buf + n, 'p', 69);
+            buf[n + q - 1] = '?';
+            n += 69;
+            memcpy(buf + n, " HTTP/1.1\r\nQ: ?\r\n\r\n", 19);
+            n += 19;
+
+            size_t pos = 0;
+            int rv     = hwire_parse_request(&cb, buf, n, &pos, 1024, 10);
+            ASSERT_OK(rv);
+            ASSERT_EQ(req.path.len, q);
+            ASSERT(req.query.ptr == req.uri.ptr + q + 1);
+            ASSERT_EQ(req.query.len, 70 - q - 1);
+        }
+    }
+
+    TEST_END();
+}
+
 int main(void)
 {
     test_parse_request_valid();
@@ -628,6 +798,8 @@ int main(void)
     test_parse_request_lf_eol();
     test_parse_request_uri_chars();
     test_parse_request_content_verification();
+    test_parse_request_line_simd_boundary();
+    test_parse_request_target_split();
     print_test_summary();
     return g_tests_failed;
 }
@@ -553,6 +553,85 @@ void test_parse_response_content_verification(void)
     TEST_END();
 }
 
+static int capture_response_cb(hwire_ctx_t *ctx, hwire_response_t *rsp)
+{
+    *(hwire_response_t *)ctx->uctx = *rsp;
+    return 0;
+}
+
+/*
+ * Covers: common status lines (200, 204, 301, 302, 304, 404, 500) and
+ * near-misses that must take the general status-line path.
+ * MUST: version, status and reason MUST be identical to the general path.
+ * MUST: the reason-phrase limit (maxlen) MUST still apply.
+ * MUST: incomplete common status lines → HWIRE_EAGAIN.
+ */
+void test_parse_response_common_status_lines(void)
+{
+    TEST_START("test_parse_response_common_status_lines");
+
+    static const struct {
+        const char *buf;
+        hwire_http_version_t version;
+        uint16_t status;
+        const char *reason;
+    } cases[] = {
+        {"HTTP/1.1 200 OK\r\n\r\n",                    HWIRE_HTTP_V11, 200, "OK"                   },
+        {"HTTP/1.1 204 No Content\r\n\r\n",            HWIRE_HTTP_V11, 204, "No Content"           },
+        {"HTTP/1.1 301 Moved Permanently\r\n\r\n",     HWIRE_HTTP_V11, 301, "Moved Permanently"    },
+        {"HTTP/1.1 302 Found\r\n\r\n",                 HWIRE_HTTP_V11, 302, "Found"                },
+        {"HTTP/1.1 304 Not Modified\r\n\r\n",          HWIRE_HTTP_V11, 304, "Not Modified"         },
+        {"HTTP/1.1 404 Not Found\r\n\r\n",             HWIRE_HTTP_V11, 404, "Not Found"            },
+        {"HTTP/1.1 500 Internal Server Error\r\n\r\n", HWIRE_HTTP_V11, 500, "Internal Server Error"},
+        // near-misses handled by the general path
+        {"HTTP/1.0 200 OK\r\n\r\n",                    HWIRE_HTTP_V10, 200, "OK"                   },
+        {"HTTP/1.1 200 Ok\r\n\r\n",                    HWIRE_HTTP_V11, 200, "Ok"                   },
+        {"HTTP/1.1 200 OK \r\n\r\n",                   HWIRE_HTTP_V11, 200, "OK "                  },
+        {"HTTP/1.1 200 OK\n\r\n",                      HWIRE_HTTP_V11, 200, "OK"                   },
+        {"HTTP/1.1 404 Not found\r\n\r\n",             HWIRE_HTTP_V11, 404, "Not found"            },
+        {"HTTP/1.1 201 Created\r\n\r\n",               HWIRE_HTTP_V11, 201, "Created"              },
+    };
+    hwire_response_t rsp;
+    hwire_ctx_t cb = {.uctx        = &rsp,
+                      .response_cb = capture_response_cb,
+                      .header_cb   = mock_header_cb};
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        const char *buf   = cases[i].buf;
+        size_t len        = strlen(buf);
+        size_t reason_len = strlen(cases[i].reason);
+        size_t pos        = 0;
+        int rv;
+
+        memset(&rsp, 0, sizeof(rsp));
+        rv = hwire_parse_response(&cb, buf, len, &pos, 1024, 10);
+        ASSERT_OK(rv);
+        ASSERT_EQ(pos, len);
+        ASSERT_EQ(rsp.version, cases[i].version);
+        ASSERT_EQ(rsp.status, cases[i].status);
+        ASSERT_EQ(rsp.reason.len, reason_len);
+        ASSERT(rsp.reason.ptr == buf + 13);
+        ASSERT(memcmp(rsp.reason.ptr, cases[i].reason, reason_len) == 0);
+
+        // the reason-phrase must be shorter than maxlen
+        pos = 0;
+        rv  = hwire_parse_response(&cb, buf, len, &pos, reason_len + 1, 10);
+        ASSERT_OK(rv);
+        pos = 0;
+        rv  = hwire_parse_response(&cb, buf, len, &pos, reason_len, 10);
+        ASSERT_EQ(rv, HWIRE_ELEN);
+
+        // every truncation of the status line needs more data
+        for (size_t n = 0; n < len - 2; n++) {
+            pos = 0;
+            rv  = hwire_parse_response(&cb, buf, n, &pos, 1024, 10);
+            ASSERT_EQ(rv, HWIRE_EAGAIN);
+        }
+    }
+
+    TEST_END();
+}
+
 int main(void)
 {
     test_parse_response_valid();
@@ -563,6 +642,7 @@ int main(void)
     test_parse_response_reason_obstext();
     test_parse_response_status_boundaries();
     test_parse_response_content_verification();
+    test_parse_response_common_status_lines();
     print_test_summary();
     return g_tests_failed;
 }
@@ -0,0 +1,179 @@
+#include "test_helpers.h"
+
+typedef struct {
+    char names[TEST_BUF_SIZE];
+    size_t len;
+    int count;
+} field_log_t;
+
+// append "name=value;" for each reported field
+static int log_field_cb(hwire_ctx_t *ctx, hwire_header_t *field)
+{
+    field_log_t *log = (field_log_t *)ctx->uctx;
+    size_t n         = field->key.len + field->value.len + 2;
+    if (log->len + n >= sizeof(log->names)) {
+        return 1;
+    }
+    memcpy(log->names + log->len, field->key.ptr, field->key.len);
+    log->len += field->key.len;
+    log->names[log->len++] = '=';
+    memcpy(log->names + log->len, field->value.ptr, field->value.len);
+    log->len += field->value.len;
+    log->names[log->len++] = ';';
+    log->names[log->len]   = '\0';
+    log->count++;
+    return 0;
+}
+
+/*
+ * Covers: RFC 9112 §7.1.2 trailer section and RFC 9110 §6.5.1 limitations.
+ * MUST: allowed fields MUST be passed to header_cb; *pos MUST follow the
+ *       empty line.
+ * MUST: fields forbidden in trailers MUST be dropped without a callback.
+ */
+void test_parse_trailers(void)
+{
+    TEST_START("test_parse_trailers");
+
+    static const struct {
+        const char *buf;
+        const char *fields;
+        uint8_t nfields;
+    } cases[] = {
+        {"\r\n", "", 0},
+        {"\n", "", 0},
+        {"grpc-status: 0\r\ngrpc-message: OK \r\n\r\n",
+         "grpc-status=0;grpc-message=OK;", 2},
+        {"Checksum: abc\r\nContent-Length: 5\r\nHOST: x\r\n"
+         "Transfer-Encoding: chunked\r\nSet-Cookie: a=b\r\nTE: trailers\r\n"
+         "If-None-Match: *\r\nX-Trailer: 1\r\n\r\n",
+         "Checksum=abc;X-Trailer=1;", 8},
+        // names that only resemble forbidden ones
+        {"Hosts: a\r\nT: b\r\nContent-Lengths: c\r\n\r\n",
+         "Hosts=a;T=b;Content-Lengths=c;", 3},
+    };
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        field_log_t log = {0};
+        hwire_ctx_t ctx = {.uctx = &log, .header_cb = log_field_cb};
+        size_t len      = strlen(cases[i].buf);
+        size_t pos      = 0;
+        uint8_t nfields = 0;
+        int rv = hwire_parse_trailers(&ctx, cases[i].buf, len, &pos, 256, 10,
+                                      &nfields);
+        ASSERT_OK(rv);
+        ASSERT_EQ(pos, len);
+        ASSERT_EQ(nfields, cases[i].nfields);
+        ASSERT(strcmp(log.names, cases[i].fields) == 0);
+    }
+
+    TEST_END();
+}
+
+/*
+ * Covers: trailer sections split across fragments.
+ * MUST: on HWIRE_EAGAIN *pos MUST be the end of the last complete field line.
+ * MUST: every field MUST be reported exactly once however input is split.
+ */
+void test_parse_trailers_resume(void)
+{
+    TEST_START("test_parse_trailers_resume");
+
+    static const char buf[] = "grpc-status: 13\r\n"
+                              "grpc-message: a longer message value\r\n"
+                              "Expires: 0\r\n"
+                              "Server-Timing: db;dur=53\r\n"
+                              "\r\n";
+    const size_t len        = sizeof(buf) - 1;
+
+    for (size_t step = 1; step <= len; step++) {
+        field_log_t log = {0};
+        hwire_ctx_t ctx = {.uctx = &log, .header_cb = log_field_cb};
+        uint8_t nfields = 0;
+        size_t start    = 0; // first byte not consumed
+        size_t avail    = 0; // bytes received so far
+        int rv          = HWIRE_EAGAIN;
+
+        while (rv == HWIRE_EAGAIN && avail < len) {
+            size_t pos = 0;
+            avail      = (avail + step > len) ? len : avail + step;
+            rv = hwire_parse_trailers(&ctx, buf + start, avail - start, &pos,
+                                      256, 10, &nfields);
+            // only whole field lines are consumed
+            ASSERT(pos == 0 || start + pos == avail ||
+                   buf[start + pos - 1] == '\n');
+            start += pos;
+        }
+        ASSERT_OK(rv);
+        ASSERT_EQ(start, len);
+        ASSERT_EQ(nfields, 4);
+        ASSERT_EQ(log.count, 3);
+        ASSERT(strcmp(log.names, "grpc-status=13;grpc-message=a longer "
+                                 "message value;Server-Timing=db;dur=53;") ==
+               0);
+    }
+
+    TEST_END();
+}
+
+/*
+ * Covers: errors and HWIRE_OPT_HARDENED in trailer sections.
+ * MUST: a forbidden field MUST return HWIRE_ETRAILER when hardened.
+ * MUST: more fields than maxnfields MUST return HWIRE_ENOBUFS.
+ * MUST: an invalid field line MUST fail like in hwire_parse_headers.
+ */
+void test_parse_trailers_errors(void)
+{
+    TEST_START("test_parse_trailers_errors");
+
+    static const struct {
+        const char *buf;
+        unsigned int options;
+        int rv;
+        size_t pos;
+    } cases[] = {
+        {"A: 1\r\nContent-Length: 0\r\n\r\n", HWIRE_OPT_HARDENED,
+         HWIRE_ETRAILER, 6},
+        {"A: 1\r\nAuthorization: x\r\n\r\n", HWIRE_OPT_HARDENED,
+         HWIRE_ETRAILER, 6},
+        {"A : 1\r\n\r\n", HWIRE_OPT_HARDENED, HWIRE_EHDRWS, 0},
+        {"A: 1\r\n b\r\n\r\n", HWIRE_OPT_HARDENED, HWIRE_EOBSFOLD, 6},
+        {"A : 1\r\n\r\n", 0, HWIRE_EHDRNAME, 0},
+        {"A: \x01\r\n\r\n", 0, HWIRE_EHDRVALUE, 0},
+        {"A: 1\r\nB: 2\r\nC: 3\r\n\r\n", 0, HWIRE_ENOBUFS, 12},
+        {"A: 1\r\nB: 2\r\n", 0, HWIRE_EAGAIN, 12},
+        {"A: 1\r", 0, HWIRE_EAGAIN, 0},
+    };
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        hwire_ctx_t ctx = {.header_cb = mock_header_cb,
+                           .options   = cases[i].options};
+        size_t pos      = SIZE_MAX;
+        uint8_t nfields = 0;
+        int rv = hwire_parse_trailers(&ctx, cases[i].buf, strlen(cases[i].buf),
+                                      &pos, 256, 2, &nfields);
+        ASSERT_EQ(rv, cases[i].rv);
+        ASSERT_EQ(pos, cases[i].pos);
+    }
+
+    /* callback abort */
+    {
+        hwire_ctx_t ctx = {.header_cb = mock_header_cb_fail};
+        size_t pos      = 0;
+        uint8_t nfields = 0;
+        ASSERT_EQ(hwire_parse_trailers(&ctx, "A: 1\r\n\r\n", 8, &pos, 256, 2,
+                                       &nfields),
+                  HWIRE_ECALLBACK);
+    }
+
+    TEST_END();
+}
+
+int main(void)
+{
+    test_parse_trailers();
+    test_parse_trailers_resume();
+    test_parse_trailers_errors();
+    print_test_summary();
+    return g_tests_failed;
+}
@@ -0,0 +1,104 @@
+#include "test_helpers.h"
+
+/*
+ * Covers: RFC 3986 §5.2.4 dot-segment removal and §6.2.2 normalization.
+ * MUST: "." and ".." segments MUST be removed, also when percent-encoded.
+ * MUST: runs of '/' MUST be collapsed.
+ * MUST: unreserved escapes MUST be decoded, others kept with uppercase hex.
+ * MUST: ".." above the root MUST return HWIRE_ERANGE.
+ */
+void test_path_normalize(void)
+{
+    TEST_START("test_path_normalize");
+
+    static const struct {
+        const char *in;
+        int rv;
+        const char *out;
+    } cases[] = {
+        {"/", HWIRE_OK, "/"},
+        {"/a/b/c", HWIRE_OK, "/a/b/c"},
+        {"/a/b/", HWIRE_OK, "/a/b/"},
+        {"//a///b//", HWIRE_OK, "/a/b/"},
+        {"/./a/./b/.", HWIRE_OK, "/a/b/"},
+        {"/a/b/../c", HWIRE_OK, "/a/c"},
+        {"/a/b/..", HWIRE_OK, "/a/"},
+        {"/a/..", HWIRE_OK, "/"},
+        {"/a/b/c/../../d", HWIRE_OK, "/a/d"},
+        {"/a//..//b", HWIRE_OK, "/b"},
+        {"/a/.b/..c/...", HWIRE_OK, "/a/.b/..c/..."},
+        {"/%7Euser/%61%62%2D", HWIRE_OK, "/~user/ab-"},
+        {"/a/%2e%2E/b", HWIRE_OK, "/b"},
+        {"/a/%2E/b", HWIRE_OK, "/a/b"},
+        {"/a%2fb/%3f%20", HWIRE_OK, "/a%2Fb/%3F%20"},
+        {"/..", HWIRE_ERANGE, NULL},
+        {"/a/../..", HWIRE_ERANGE, NULL},
+        {"/./../a", HWIRE_ERANGE, NULL},
+        {"//%2e%2e", HWIRE_ERANGE, NULL},
+        {"", HWIRE_EILSEQ, NULL},
+        {"a/b", HWIRE_EILSEQ, NULL},
+        {"/a%2", HWIRE_EILSEQ, NULL},
+        {"/a%zz", HWIRE_EILSEQ, NULL},
+    };
+    char buf[TEST_BUF_SIZE];
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        hwire_str_t path = {.ptr = buf, .len = strlen(cases[i].in)};
+        memcpy(buf, cases[i].in, path.len);
+
+        int rv = hwire_path_normalize(&path);
+        ASSERT_EQ(rv, cases[i].rv);
+        if (rv == HWIRE_OK) {
+            ASSERT(path.ptr == buf);
+            ASSERT_EQ(path.len, strlen(cases[i].out));
+            ASSERT(memcmp(buf, cases[i].out, path.len) == 0);
+
+            // normalizing again changes nothing
+            size_t len = path.len;
+            ASSERT_OK(hwire_path_normalize(&path));
+            ASSERT_EQ(path.len, len);
+            ASSERT(memcmp(buf, cases[i].out, len) == 0);
+        }
+    }
+
+    TEST_END();
+}
+
+static int copy_path_cb(hwire_ctx_t *ctx, hwire_request_t *req)
+{
+    *(hwire_str_t *)ctx->uctx = req->path;
+    return 0;
+}
+
+/*
+ * Covers: normalization of the path slice of a parsed request.
+ * MUST: the path slice MUST be normalized without touching the query.
+ */
+void test_path_normalize_request(void)
+{
+    TEST_START("test_path_normalize_request");
+
+    char buf[TEST_BUF_SIZE];
+    const char *req = "GET /static/./css/../img//logo%2Epng?v=1 HTTP/1.1\r\n\r\n";
+    hwire_str_t path;
+    hwire_ctx_t cb = {.uctx       = &path,
+                      .request_cb = copy_path_cb,
+                      .header_cb  = mock_header_cb};
+    size_t pos     = 0;
+
+    memcpy(buf, req, strlen(req));
+    ASSERT_OK(hwire_parse_request(&cb, buf, strlen(req), &pos, 1024, 10));
+    ASSERT_OK(hwire_path_normalize(&path));
+    ASSERT_EQ(path.len, 20);
+    ASSERT(memcmp(path.ptr, "/static/img/logo.png", 20) == 0);
+
+    TEST_END();
+}
+
+int main(void)
+{
+    test_path_normalize();
+    test_path_normalize_request();
+    print_test_summary();
+    return g_tests_failed;
+}
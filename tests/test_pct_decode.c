@@ -0,0 +1,171 @@
+#include "test_helpers.h"
+
+static int decode(const char *src, unsigned int flags, char *out, size_t size,
+                  size_t *outlen)
+{
+    hwire_buf_t dst = {.buf = out, .size = size};
+    int rv          = hwire_pct_decode(src, strlen(src), &dst, flags);
+    *outlen         = dst.len;
+    return rv;
+}
+
+/*
+ * Covers: RFC 3986 §2.1 percent-encoding.
+ * MUST: "%" HEXDIG HEXDIG MUST decode to the octet, in either letter case.
+ * MUST: '+' MUST only be decoded as SP with HWIRE_PCT_PLUS.
+ * MUST: the in-place variant MUST produce the same result.
+ */
+void test_pct_decode_valid(void)
+{
+    TEST_START("test_pct_decode_valid");
+
+    static const struct {
+        const char *src;
+        unsigned int flags;
+        const char *expected;
+        size_t expected_len;
+    } cases[] = {
+        {"", 0, "", 0},
+        {"/plain/path", 0, "/plain/path", 11},
+        {"%41%62%2f%2F", 0, "Ab//", 4},
+        {"a%20b", 0, "a b", 3},
+        {"%e3%81%82", 0, "\xe3\x81\x82", 3},
+        {"%00", 0, "\0", 1},
+        {"a+b%2B", 0, "a+b+", 4},
+        {"a+b%2B", HWIRE_PCT_PLUS, "a b+", 4},
+        {"++", HWIRE_PCT_PLUS, "  ", 2},
+        {"%25%25", 0, "%%", 2},
+    };
+    char out[TEST_BUF_SIZE];
+    char work[TEST_BUF_SIZE];
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        size_t len = 0;
+        int rv = decode(cases[i].src, cases[i].flags, out, sizeof(out), &len);
+        ASSERT_OK(rv);
+        ASSERT_EQ(len, cases[i].expected_len);
+        ASSERT(memcmp(out, cases[i].expected, len) == 0);
+
+        hwire_str_t s = {.ptr = work, .len = strlen(cases[i].src)};
+        memcpy(work, cases[i].src, s.len);
+        rv = hwire_pct_decode_inplace(&s, cases[i].flags);
+        ASSERT_OK(rv);
+        ASSERT(s.ptr == work);
+        ASSERT_EQ(s.len, cases[i].expected_len);
+        ASSERT(memcmp(work, cases[i].expected, s.len) == 0);
+    }
+
+    TEST_END();
+}
+
+/*
+ * Covers: invalid escapes and rejected octets.
+ * MUST: '%' not followed by two hex digits MUST return HWIRE_EILSEQ.
+ * MUST: HWIRE_PCT_REJECT_NUL / HWIRE_PCT_REJECT_SLASH MUST reject "%00" /
+ *       "%2F" while a literal '/' stays valid.
+ * MUST: output that does not fit MUST return HWIRE_ENOBUFS.
+ */
+void test_pct_decode_errors(void)
+{
+    TEST_START("test_pct_decode_errors");
+
+    static const struct {
+        const char *src;
+        unsigned int flags;
+        int rv;
+    } cases[] = {
+        {"%", 0, HWIRE_EILSEQ},
+        {"ab%4", 0, HWIRE_EILSEQ},
+        {"%g0", 0, HWIRE_EILSEQ},
+        {"%0g", 0, HWIRE_EILSEQ},
+        {"% 20", 0, HWIRE_EILSEQ},
+        {"a%00b", HWIRE_PCT_REJECT_NUL, HWIRE_EILSEQ},
+        {"a%2fb", HWIRE_PCT_REJECT_SLASH, HWIRE_EILSEQ},
+        {"a%2Fb", HWIRE_PCT_REJECT_SLASH, HWIRE_EILSEQ},
+        {"/a/b%2e", HWIRE_PCT_REJECT_SLASH | HWIRE_PCT_REJECT_NUL, HWIRE_OK},
+        {"a%2fb", HWIRE_PCT_REJECT_NUL, HWIRE_OK},
+    };
+    char out[TEST_BUF_SIZE];
+    char work[TEST_BUF_SIZE];
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        size_t len = 0;
+        int rv = decode(cases[i].src, cases[i].flags, out, sizeof(out), &len);
+        ASSERT_EQ(rv, cases[i].rv);
+
+        hwire_str_t s = {.ptr = work, .len = strlen(cases[i].src)};
+        memcpy(work, cases[i].src, s.len);
+        ASSERT_EQ(hwire_pct_decode_inplace(&s, cases[i].flags), cases[i].rv);
+    }
+
+    /* output buffer too small, at a clean run and at an escape */
+    {
+        size_t len = 0;
+        ASSERT_EQ(decode("abcdef", 0, out, 5, &len), HWIRE_ENOBUFS);
+        ASSERT_EQ(decode("abcd%41", 0, out, 4, &len), HWIRE_ENOBUFS);
+        ASSERT_EQ(decode("abcd%41", 0, out, 5, &len), HWIRE_OK);
+        ASSERT_EQ(len, 5);
+        ASSERT_EQ(decode("", 0, NULL, 0, &len), HWIRE_OK);
+        ASSERT_EQ(len, 0);
+    }
+
+    TEST_END();
+}
+
+/*
+ * Covers: escapes at every offset of inputs spanning several SIMD blocks.
+ * MUST: the result MUST match a byte-wise reference decoder.
+ */
+void test_pct_decode_simd_boundary(void)
+{
+    TEST_START("test_pct_decode_simd_boundary");
+
+    char src[TEST_BUF_SIZE];
+    char out[TEST_BUF_SIZE];
+    char expected[TEST_BUF_SIZE];
+
+    for (size_t n = 1; n <= 100; n++) {
+        for (size_t at = 0; at + 3 <= n; at++) {
+            // plain bytes, one escape at 'at' and a '+' right after it
+            for (size_t i = 0; i < n; i++) {
+                src[i] = (char)('a' + i % 26);
+            }
+            memcpy(src + at, "%7E", 3);
+            if (at + 3 < n) {
+                src[at + 3] = '+';
+            }
+            size_t elen = 0;
+            for (size_t i = 0; i < n; i++) {
+                if (i == at) {
+                    expected[elen++] = '~';
+                    i += 2;
+                } else {
+                    expected[elen++] = (src[i] == '+') ? ' ' : src[i];
+                }
+            }
+
+            hwire_buf_t dst = {.buf = out, .size = sizeof(out)};
+            int rv          = hwire_pct_decode(src, n, &dst, HWIRE_PCT_PLUS);
+            ASSERT_OK(rv);
+            ASSERT_EQ(dst.len, elen);
+            ASSERT(memcmp(out, expected, elen) == 0);
+
+            hwire_str_t s = {.ptr = src, .len = n};
+            rv            = hwire_pct_decode_inplace(&s, HWIRE_PCT_PLUS);
+            ASSERT_OK(rv);
+            ASSERT_EQ(s.len, elen);
+            ASSERT(memcmp(src, expected, elen) == 0);
+        }
+    }
+
+    TEST_END();
+}
+
+int main(void)
+{
+    test_pct_decode_valid();
+    test_pct_decode_errors();
+    test_pct_decode_simd_boundary();
+    print_test_summary();
+    return g_tests_failed;
+}
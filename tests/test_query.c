@@ -0,0 +1,138 @@
+#include "test_helpers.h"
+
+typedef struct {
+    const char *key;
+    const char *value;
+    uint8_t flags;
+} query_expect_t;
+
+/*
+ * Covers: application/x-www-form-urlencoded iteration.
+ * MUST: pairs MUST be split at '&' and at the first '=' of each pair.
+ * MUST: empty pairs MUST be skipped.
+ * MUST: encoded flags MUST be set per key / value, for '%' and '+'.
+ */
+void test_query_next(void)
+{
+    TEST_START("test_query_next");
+
+    static const struct {
+        const char *str;
+        size_t n;
+        query_expect_t params[4];
+    } cases[] = {
+        {"", 0, {{0}}},
+        {"&&", 0, {{0}}},
+        {"a=1", 1, {{"a", "1", HWIRE_QUERY_HAS_VALUE}}},
+        {"a=1&b=2",
+         2,
+         {{"a", "1", HWIRE_QUERY_HAS_VALUE}, {"b", "2", HWIRE_QUERY_HAS_VALUE}}},
+        {"&a&&b=&",
+         2,
+         {{"a", "", 0}, {"b", "", HWIRE_QUERY_HAS_VALUE}}},
+        {"x=a=b", 1, {{"x", "a=b", HWIRE_QUERY_HAS_VALUE}}},
+        {"=v", 1, {{"", "v", HWIRE_QUERY_HAS_VALUE}}},
+        {"q=a+b&k%20y=v&n=%41",
+         3,
+         {{"q", "a+b", HWIRE_QUERY_HAS_VALUE | HWIRE_QUERY_VALUE_ENCODED},
+          {"k%20y", "v", HWIRE_QUERY_HAS_VALUE | HWIRE_QUERY_KEY_ENCODED},
+          {"n", "%41", HWIRE_QUERY_HAS_VALUE | HWIRE_QUERY_VALUE_ENCODED}}},
+        {"a+", 1, {{"a+", "", HWIRE_QUERY_KEY_ENCODED}}},
+    };
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        const char *str = cases[i].str;
+        size_t len      = strlen(str);
+        size_t pos      = 0;
+        size_t n        = 0;
+        hwire_query_param_t p;
+
+        while (hwire_query_next(str, len, &pos, &p)) {
+            ASSERT(n < cases[i].n);
+            ASSERT(str_eq(p.key, cases[i].params[n].key));
+            ASSERT(str_eq(p.value, cases[i].params[n].value));
+            ASSERT_EQ(p.flags, cases[i].params[n].flags);
+            n++;
+        }
+        ASSERT_EQ(n, cases[i].n);
+        ASSERT_EQ(pos, len);
+        // the end is sticky
+        ASSERT_EQ(hwire_query_next(str, len, &pos, &p), 0);
+    }
+
+    // NULL string with length 0
+    {
+        size_t pos = 0;
+        hwire_query_param_t p;
+        ASSERT_EQ(hwire_query_next(NULL, 0, &pos, &p), 0);
+    }
+
+    TEST_END();
+}
+
+/*
+ * Covers: separators and encoded bytes around SIMD block boundaries.
+ * MUST: results MUST not depend on the position of '&', '=' or '%'.
+ */
+void test_query_next_simd_boundary(void)
+{
+    TEST_START("test_query_next_simd_boundary");
+
+    char buf[TEST_BUF_SIZE];
+
+    for (size_t klen = 1; klen <= 40; klen++) {
+        for (size_t vlen = 0; vlen <= 40; vlen++) {
+            for (int enc = 0; enc < 4; enc++) {
+                size_t n = 0;
+                memset(buf, 'k', klen);
+                if (enc & 1) {
+                    buf[klen - 1] = '%';
+                }
+                n += klen;
+                buf[n++] = '=';
+                memset(buf + n, 'v', vlen);
+                if ((enc & 2) && vlen > 0) {
+                    buf[n + vlen - 1] = '+';
+                }
+                n += vlen;
+                memcpy(buf + n, "&z=%7E", 6);
+                n += 6;
+
+                uint8_t flags = HWIRE_QUERY_HAS_VALUE;
+                if (enc & 1) {
+                    flags |= HWIRE_QUERY_KEY_ENCODED;
+                }
+                if ((enc & 2) && vlen > 0) {
+                    flags |= HWIRE_QUERY_VALUE_ENCODED;
+                }
+
+                size_t pos = 0;
+                hwire_query_param_t p;
+                ASSERT_EQ(hwire_query_next(buf, n, &pos, &p), 1);
+                ASSERT(p.key.ptr == buf);
+                ASSERT_EQ(p.key.len, klen);
+                ASSERT(p.value.ptr == buf + klen + 1);
+                ASSERT_EQ(p.value.len, vlen);
+                ASSERT_EQ(p.flags, flags);
+                ASSERT_EQ(pos, klen + 1 + vlen);
+
+                ASSERT_EQ(hwire_query_next(buf, n, &pos, &p), 1);
+                ASSERT(str_eq(p.key, "z"));
+                ASSERT(str_eq(p.value, "%7E"));
+                ASSERT_EQ(p.flags, HWIRE_QUERY_HAS_VALUE |
+                                       HWIRE_QUERY_VALUE_ENCODED);
+                ASSERT_EQ(hwire_query_next(buf, n, &pos, &p), 0);
+            }
+        }
+    }
+
+    TEST_END();
+}
+
+int main(void)
+{
+    test_query_next();
+    test_query_next_simd_boundary();
+    print_test_summary();
+    return g_tests_failed;
+}
@@ -0,0 +1,224 @@
+#include "test_helpers.h"
+
+#if defined(HWIRE_RING)
+
+typedef struct {
+    size_t nreqs;
+    size_t nhdrs;
+    size_t nbody;
+    int bad_uri;
+} ring_log_t;
+
+static int ring_request_cb(hwire_ctx_t *ctx, hwire_request_t *req)
+{
+    ring_log_t *log = (ring_log_t *)ctx->uctx;
+    if (req->uri.len != 14 || memcmp(req->uri.ptr, "/pipelined/req", 14)) {
+        log->bad_uri++;
+    }
+    log->nreqs++;
+    return 0;
+}
+
+static int ring_header_cb(hwire_ctx_t *ctx, hwire_header_t *header)
+{
+    ring_log_t *log = (ring_log_t *)ctx->uctx;
+    (void)header;
+    log->nhdrs++;
+    return 0;
+}
+
+static int ring_body_cb(hwire_ctx_t *ctx, const char *data, size_t len)
+{
+    ring_log_t *log = (ring_log_t *)ctx->uctx;
+    for (size_t i = 0; i < len; i++) {
+        if (data[i] != 'x') {
+            log->bad_uri++;
+        }
+    }
+    log->nbody += len;
+    return 0;
+}
+
+/*
+ * Covers: the mirrored mapping and the read / write cursors.
+ * MUST: the capacity MUST be rounded up to whole pages.
+ * MUST: buf[i] and buf[i + size] MUST be the same byte.
+ * MUST: unread data MUST stay contiguous when it wraps.
+ */
+void test_ring(void)
+{
+    TEST_START("test_ring");
+
+    hwire_ring_t ring;
+    size_t n = 0;
+
+    ASSERT_EQ(hwire_ring_init(&ring, 0), HWIRE_ERANGE);
+    ASSERT_EQ(hwire_ring_init(&ring, SIZE_MAX), HWIRE_ERANGE);
+    ASSERT_OK(hwire_ring_init(&ring, 100));
+    ASSERT(ring.size >= 100);
+    ASSERT_EQ(ring.size % 512, 0);
+
+    // the second copy aliases the first
+    ring.buf[ring.size + 7] = 'a';
+    ASSERT_EQ(ring.buf[7], 'a');
+    ring.buf[3] = 'b';
+    ASSERT_EQ(ring.buf[ring.size + 3], 'b');
+
+    // leave 10 unread bytes at the end, then wrap
+    char *w = hwire_ring_wbuf(&ring, &n);
+    ASSERT(w == ring.buf);
+    ASSERT_EQ(n, ring.size);
+    memset(w, '-', ring.size);
+    hwire_ring_commit(&ring, ring.size);
+    hwire_ring_consume(&ring, ring.size - 10);
+    w = hwire_ring_wbuf(&ring, &n);
+    ASSERT(w == ring.buf + ring.size);
+    ASSERT_EQ(n, ring.size - 10);
+    memcpy(w, "wrapped", 7);
+    hwire_ring_commit(&ring, 7);
+
+    const char *r = hwire_ring_rbuf(&ring, &n);
+    ASSERT(r == ring.buf + ring.size - 10);
+    ASSERT_EQ(n, 17);
+    ASSERT(memcmp(r, "----------wrapped", 17) == 0);
+    ASSERT(memcmp(ring.buf, "wrapped", 7) == 0);
+
+    // consuming past the end moves the head to the front copy
+    hwire_ring_consume(&ring, 12);
+    r = hwire_ring_rbuf(&ring, &n);
+    ASSERT(r == ring.buf + 2);
+    ASSERT_EQ(n, 5);
+    hwire_ring_consume(&ring, 5);
+    ASSERT_EQ(ring.head, 0);
+    ASSERT_EQ(ring.len, 0);
+
+    hwire_ring_free(&ring);
+    ASSERT(ring.buf == NULL);
+
+    TEST_END();
+}
+
+/*
+ * Covers: pipelined keep-alive requests streamed through a small ring.
+ * MUST: every message MUST be parsed from one contiguous span, also when
+ *       it wraps, without moving any bytes.
+ * MUST: a head split across reads MUST be parsed again from its start on
+ *       each call, so request_cb and header_cb fire once per call that
+ *       reaches their line (the duplicates documented for hwire_msg_parse)
+ *       and no more.
+ * MUST: a head that does not fit into a full ring MUST return
+ *       HWIRE_ENOBUFS.
+ */
+void test_ring_msg_parse(void)
+{
+    TEST_START("test_ring_msg_parse");
+
+    static const char REQ[] = "POST /pipelined/req HTTP/1.1\r\n"
+                              "Host: example.com\r\n"
+                              "Content-Length: 40\r\n"
+                              "\r\n"
+                              "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx";
+    const size_t reqlen     = sizeof(REQ) - 1;
+    const size_t total      = 500;
+    ring_log_t log          = {0};
+    hwire_ctx_t ctx         = {.uctx       = &log,
+                               .request_cb = ring_request_cb,
+                               .header_cb  = ring_header_cb,
+                               .body_cb    = ring_body_cb};
+    hwire_msg_parser_t msg;
+    hwire_ring_t ring;
+    size_t sent  = 0; // bytes of the stream written so far
+    size_t nmsgs = 0;
+    size_t wraps = 0;
+    static size_t ends[1024]; // sent after each read
+    size_t nreads = 0;
+
+    ASSERT_OK(hwire_ring_init(&ring, 1));
+    hwire_msg_init(&msg, 0, 256, 10, 4);
+
+    // write odd-sized reads until total requests have been parsed
+    while (nmsgs < total) {
+        size_t n = 0;
+        char *w  = hwire_ring_wbuf(&ring, &n);
+        if (n > 1000) {
+            n = 1000;
+        }
+        for (size_t i = 0; i < n; i++) {
+            w[i] = REQ[(sent + i) % reqlen];
+        }
+        if (ring.head + ring.len + n > ring.size &&
+            ring.head + ring.len < ring.size) {
+            wraps++;
+        }
+        sent += n;
+        hwire_ring_commit(&ring, n);
+        ASSERT(nreads < sizeof(ends) / sizeof(ends[0]));
+        ends[nreads++] = sent;
+
+        int rv;
+        while ((rv = hwire_ring_msg_parse(&ring, &msg, &ctx)) == HWIRE_OK) {
+            hwire_msg_init(&msg, 0, 256, 10, 4);
+            nmsgs++;
+        }
+        ASSERT_EQ(rv, HWIRE_EAGAIN);
+    }
+    ASSERT(wraps > 0);
+    ASSERT_EQ(log.bad_uri, 0);
+    // the body of the next message may have started
+    ASSERT(log.nbody >= nmsgs * 40 && log.nbody < nmsgs * 40 + 40);
+
+    // a message is parsed after each read from the one that completed the
+    // message before it up to the one that completes its head; each of
+    // these calls reports the lines of the head that are complete
+    {
+        const size_t lines[] = {30, 49, 69}; // ends of the head lines
+        const size_t hlen    = reqlen - 40;
+        size_t nreqs         = 0;
+        size_t nhdrs         = 0;
+        size_t r             = 0;
+
+        for (size_t start = 0; start < sent; start += reqlen) {
+            while (r < nreads && ends[r] < start) {
+                r++;
+            }
+            for (; r < nreads; r++) {
+                size_t avail = ends[r] - start;
+                nreqs += (size_t)(avail >= lines[0]);
+                nhdrs += (size_t)(avail >= lines[1]) +
+                         (size_t)(avail >= lines[2]);
+                if (avail >= hlen) {
+                    break;
+                }
+            }
+        }
+        ASSERT(nreqs > nmsgs);
+        ASSERT_EQ(log.nreqs, nreqs);
+        ASSERT_EQ(log.nhdrs, nhdrs);
+    }
+
+    // a head larger than the ring
+    hwire_ring_consume(&ring, ring.len);
+    hwire_msg_init(&msg, 0, ring.size * 2, 10, 4);
+    size_t n = 0;
+    char *w  = hwire_ring_wbuf(&ring, &n);
+    memcpy(w, "GET / HTTP/1.1\r\nX: ", 19);
+    memset(w + 19, 'v', n - 19);
+    hwire_ring_commit(&ring, n);
+    ASSERT_EQ(hwire_ring_msg_parse(&ring, &msg, &ctx), HWIRE_ENOBUFS);
+
+    hwire_ring_free(&ring);
+
+    TEST_END();
+}
+
+#endif
+
+int main(void)
+{
+#if defined(HWIRE_RING)
+    test_ring();
+    test_ring_msg_parse();
+#endif
+    print_test_summary();
+    return g_tests_failed;
+}
@@ -0,0 +1,319 @@
+#include "test_helpers.h"
+
+static int scan(const char *buf, unsigned int flags, hwire_msginfo_t *info,
+                size_t *pos)
+{
+    *pos = 0;
+    return hwire_scan_message(buf, strlen(buf), pos, 1024, 20, flags, info);
+}
+
+/*
+ * Covers: RFC 9112 §6.3 message body length of requests.
+ * MUST: Transfer-Encoding with final "chunked" MUST take precedence over
+ *       Content-Length, and such a request MUST NOT be persistent.
+ * MUST: a request whose final transfer coding is not chunked MUST be
+ *       rejected.
+ * MUST: a request without Content-Length and Transfer-Encoding has no body.
+ */
+void test_scan_message_request_body(void)
+{
+    TEST_START("test_scan_message_request_body");
+
+    hwire_msginfo_t info;
+    size_t pos;
+    int rv;
+    const char *buf;
+
+    /* no body */
+    buf = "GET / HTTP/1.1\r\nHost: example.com\r\n\r\n";
+    rv  = scan(buf, 0, &info, &pos);
+    ASSERT_OK(rv);
+    ASSERT_EQ(pos, strlen(buf));
+    ASSERT_EQ(info.version, HWIRE_HTTP_V11);
+    ASSERT_EQ(info.status, 0);
+    ASSERT_EQ(info.method.len, 3);
+    ASSERT(memcmp(info.method.ptr, "GET", 3) == 0);
+    ASSERT_EQ(info.body, HWIRE_BODY_NONE);
+    ASSERT_EQ(info.keep_alive, 1);
+    ASSERT_EQ(info.framing.flags, 0);
+
+    /* Content-Length; pos points at the first body byte */
+    buf = "POST /a HTTP/1.1\r\ncontent-LENGTH: 12345\r\n\r\nbody";
+    rv  = scan(buf, 0, &info, &pos);
+    ASSERT_OK(rv);
+    ASSERT_EQ(pos, strlen(buf) - 4);
+    ASSERT_EQ(info.body, HWIRE_BODY_LENGTH);
+    ASSERT_EQ(info.framing.content_length, 12345);
+    ASSERT_EQ(info.framing.flags, HWIRE_FRAMING_CONTENT_LENGTH);
+
+    /* largest 64-bit length, and repeated identical values */
+    buf = "POST / HTTP/1.1\r\nContent-Length: 18446744073709551615\r\n"
+          "Content-Length: 18446744073709551615\r\n\r\n";
+    rv  = scan(buf, 0, &info, &pos);
+    ASSERT_OK(rv);
+    ASSERT(info.framing.content_length == UINT64_MAX);
+
+    /* chunked as final coding, across list elements and fields */
+    buf = "POST / HTTP/1.1\r\nTransfer-Encoding: gzip\r\n"
+          "Transfer-Encoding: deflate ,, CHUNKED \r\n\r\n";
+    rv  = scan(buf, 0, &info, &pos);
+    ASSERT_OK(rv);
+    ASSERT_EQ(info.body, HWIRE_BODY_CHUNKED);
+    ASSERT_EQ(info.keep_alive, 1);
+
+    /* chunked overrides Content-Length; connection must not be reused */
+    buf = "POST / HTTP/1.1\r\nContent-Length: 5\r\n"
+          "Transfer-Encoding: chunked\r\n\r\n";
+    rv  = scan(buf, 0, &info, &pos);
+    ASSERT_OK(rv);
+    ASSERT_EQ(info.body, HWIRE_BODY_CHUNKED);
+    ASSERT_EQ(info.keep_alive, 0);
+    ASSERT_EQ(scan(buf, HWIRE_SCAN_HARDENED, &info, &pos), HWIRE_ECLTE);
+
+    /* final coding is not chunked */
+    buf = "POST / HTTP/1.1\r\nTransfer-Encoding: chunked, gzip\r\n\r\n";
+    rv  = scan(buf, 0, &info, &pos);
+    ASSERT_EQ(rv, HWIRE_EHDRVALUE);
+
+    /* invalid Content-Length values */
+    buf = "POST / HTTP/1.1\r\nContent-Length: 1x\r\n\r\n";
+    ASSERT_EQ(scan(buf, 0, &info, &pos), HWIRE_EHDRVALUE);
+    buf = "POST / HTTP/1.1\r\nContent-Length: +1\r\n\r\n";
+    ASSERT_EQ(scan(buf, 0, &info, &pos), HWIRE_EHDRVALUE);
+    buf = "POST / HTTP/1.1\r\nContent-Length:\r\n\r\n";
+    ASSERT_EQ(scan(buf, 0, &info, &pos), HWIRE_EHDRVALUE);
+    buf = "POST / HTTP/1.1\r\nContent-Length: 1, 1\r\n\r\n";
+    ASSERT_EQ(scan(buf, 0, &info, &pos), HWIRE_EHDRVALUE);
+    buf = "POST / HTTP/1.1\r\nContent-Length: 5\r\nContent-Length: 6\r\n\r\n";
+    ASSERT_EQ(scan(buf, 0, &info, &pos), HWIRE_ECLDUP);
+    buf = "POST / HTTP/1.1\r\nContent-Length: 18446744073709551616\r\n\r\n";
+    ASSERT_EQ(scan(buf, 0, &info, &pos), HWIRE_ERANGE);
+
+    /* names that only resemble framing fields are ignored */
+    buf = "POST / HTTP/1.1\r\nContent-Lengthx: 1x\r\nContent_Length: 1x\r\n"
+          "Transfer-Encodinh: gzip\r\nConnectiox: close\r\n\r\n";
+    rv  = scan(buf, 0, &info, &pos);
+    ASSERT_OK(rv);
+    ASSERT_EQ(info.framing.flags, 0);
+    ASSERT_EQ(info.body, HWIRE_BODY_NONE);
+
+    TEST_END();
+}
+
+/*
+ * Covers: RFC 9112 §6.3 message body length of responses.
+ * MUST: responses to HEAD, 1xx, 204 and 304 MUST NOT have a body.
+ * MUST: 2xx responses to CONNECT MUST NOT have a body.
+ * MUST: a response without a final chunked coding or Content-Length is
+ *       delimited by closing the connection.
+ */
+void test_scan_message_response_body(void)
+{
+    TEST_START("test_scan_message_response_body");
+
+    hwire_msginfo_t info;
+    size_t pos;
+    int rv;
+    const char *buf;
+
+    buf = "HTTP/1.1 200 OK\r\nContent-Length: 2\r\n\r\nok";
+    rv  = scan(buf, HWIRE_SCAN_RESPONSE, &info, &pos);
+    ASSERT_OK(rv);
+    ASSERT_EQ(pos, strlen(buf) - 2);
+    ASSERT_EQ(info.status, 200);
+    ASSERT_EQ(info.method.len, 0);
+    ASSERT_EQ(info.body, HWIRE_BODY_LENGTH);
+    ASSERT_EQ(info.framing.content_length, 2);
+    ASSERT_EQ(info.keep_alive, 1);
+
+    /* same response to a HEAD request */
+    rv = scan(buf, HWIRE_SCAN_RESPONSE | HWIRE_SCAN_HEAD, &info, &pos);
+    ASSERT_OK(rv);
+    ASSERT_EQ(info.body, HWIRE_BODY_NONE);
+    ASSERT_EQ(info.keep_alive, 1);
+
+    /* 1xx, 204 and 304 never have a body */
+    buf = "HTTP/1.1 100 Continue\r\n\r\n";
+    ASSERT_OK(scan(buf, HWIRE_SCAN_RESPONSE, &info, &pos));
+    ASSERT_EQ(info.body, HWIRE_BODY_NONE);
+    buf = "HTTP/1.1 204 No Content\r\nTransfer-Encoding: chunked\r\n\r\n";
+    ASSERT_OK(scan(buf, HWIRE_SCAN_RESPONSE, &info, &pos));
+    ASSERT_EQ(info.body, HWIRE_BODY_NONE);
+    buf = "HTTP/1.1 304 Not Modified\r\nContent-Length: 10\r\n\r\n";
+    ASSERT_OK(scan(buf, HWIRE_SCAN_RESPONSE, &info, &pos));
+    ASSERT_EQ(info.body, HWIRE_BODY_NONE);
+    ASSERT_EQ(info.keep_alive, 1);
+
+    /* 2xx to CONNECT switches to a tunnel; other statuses are normal */
+    buf = "HTTP/1.1 200 Connection Established\r\n\r\n";
+    ASSERT_OK(scan(buf, HWIRE_SCAN_RESPONSE | HWIRE_SCAN_CONNECT, &info, &pos));
+    ASSERT_EQ(info.body, HWIRE_BODY_NONE);
+    ASSERT_EQ(info.keep_alive, 0);
+    buf = "HTTP/1.1 407 Proxy Authentication Required\r\n"
+          "Content-Length: 0\r\n\r\n";
+    ASSERT_OK(scan(buf, HWIRE_SCAN_RESPONSE | HWIRE_SCAN_CONNECT, &info, &pos));
+    ASSERT_EQ(info.body, HWIRE_BODY_LENGTH);
+    ASSERT_EQ(info.keep_alive, 1);
+
+    /* chunked */
+    buf = "HTTP/1.1 200 OK\r\nTransfer-Encoding: chunked\r\n\r\n";
+    ASSERT_OK(scan(buf, HWIRE_SCAN_RESPONSE, &info, &pos));
+    ASSERT_EQ(info.body, HWIRE_BODY_CHUNKED);
+
+    /* non-chunked final coding and missing length are close-delimited */
+    buf = "HTTP/1.1 200 OK\r\nTransfer-Encoding: gzip\r\n\r\n";
+    ASSERT_OK(scan(buf, HWIRE_SCAN_RESPONSE, &info, &pos));
+    ASSERT_EQ(info.body, HWIRE_BODY_CLOSE);
+    ASSERT_EQ(info.keep_alive, 0);
+    buf = "HTTP/1.1 200 OK\r\nServer: x\r\n\r\n";
+    ASSERT_OK(scan(buf, HWIRE_SCAN_RESPONSE, &info, &pos));
+    ASSERT_EQ(info.body, HWIRE_BODY_CLOSE);
+    ASSERT_EQ(info.keep_alive, 0);
+
+    TEST_END();
+}
+
+/*
+ * Covers: RFC 9112 §9.3 persistence.
+ * MUST: "close" connection option MUST end persistence.
+ * MUST: HTTP/1.1 is persistent by default; HTTP/1.0 only with keep-alive.
+ * MUST: RFC 9112 §6.1 an HTTP/1.0 message with Transfer-Encoding MUST NOT
+ *       be persistent, even with keep-alive.
+ */
+void test_scan_message_keep_alive(void)
+{
+    TEST_START("test_scan_message_keep_alive");
+
+    hwire_msginfo_t info;
+    size_t pos;
+    const char *buf;
+
+    buf = "GET / HTTP/1.1\r\nConnection: Close\r\n\r\n";
+    ASSERT_OK(scan(buf, 0, &info, &pos));
+    ASSERT_EQ(info.keep_alive, 0);
+    ASSERT_EQ(info.framing.flags, HWIRE_FRAMING_CLOSE);
+
+    buf = "GET / HTTP/1.0\r\n\r\n";
+    ASSERT_OK(scan(buf, 0, &info, &pos));
+    ASSERT_EQ(info.version, HWIRE_HTTP_V10);
+    ASSERT_EQ(info.keep_alive, 0);
+
+    buf = "GET / HTTP/1.0\r\nCONNECTION: Upgrade,Keep-Alive\r\n\r\n";
+    ASSERT_OK(scan(buf, 0, &info, &pos));
+    ASSERT_EQ(info.keep_alive, 1);
+    ASSERT_EQ(info.framing.flags,
+              HWIRE_FRAMING_UPGRADE | HWIRE_FRAMING_KEEP_ALIVE);
+
+    /* close wins over keep-alive */
+    buf = "GET / HTTP/1.0\r\nConnection: keep-alive\r\n"
+          "Connection: close\r\n\r\n";
+    ASSERT_OK(scan(buf, 0, &info, &pos));
+    ASSERT_EQ(info.keep_alive, 0);
+
+    /* tokens must match exactly */
+    buf = "GET / HTTP/1.1\r\nConnection: closed, xclose\r\n\r\n";
+    ASSERT_OK(scan(buf, 0, &info, &pos));
+    ASSERT_EQ(info.keep_alive, 1);
+
+    buf = "HTTP/1.0 200 OK\r\nConnection: keep-alive\r\n"
+          "Content-Length: 0\r\n\r\n";
+    ASSERT_OK(scan(buf, HWIRE_SCAN_RESPONSE, &info, &pos));
+    ASSERT_EQ(info.keep_alive, 1);
+
+    /* Transfer-Encoding in HTTP/1.0 is faulty framing */
+    buf = "POST / HTTP/1.0\r\nTransfer-Encoding: chunked\r\n"
+          "Connection: keep-alive\r\n\r\n";
+    ASSERT_OK(scan(buf, 0, &info, &pos));
+    ASSERT_EQ(info.body, HWIRE_BODY_CHUNKED);
+    ASSERT_EQ(info.keep_alive, 0);
+    ASSERT_OK(scan(buf, HWIRE_SCAN_HARDENED, &info, &pos));
+    ASSERT_EQ(info.keep_alive, 0);
+
+    buf = "HTTP/1.0 200 OK\r\nConnection: keep-alive\r\n"
+          "Transfer-Encoding: chunked\r\n\r\n";
+    ASSERT_OK(scan(buf, HWIRE_SCAN_RESPONSE, &info, &pos));
+    ASSERT_EQ(info.body, HWIRE_BODY_CHUNKED);
+    ASSERT_EQ(info.keep_alive, 0);
+
+    TEST_END();
+}
+
+/*
+ * Covers: validation parity with the callback parsers.
+ * MUST: hwire_scan_message MUST return the same result and position as
+ *       hwire_parse_request / hwire_parse_response for every prefix of a
+ *       message, including malformed ones.
+ */
+void test_scan_message_parity(void)
+{
+    TEST_START("test_scan_message_parity");
+
+    static const char *reqs[] = {
+        "\r\nGET /index.html?q=1 HTTP/1.1\r\nHost: example.com\r\n"
+        "Content-Length: 3\r\nAccept: */*\r\n\r\n",
+        "GET / HTTP/1.1\r\nX-Long-Header-Name-Over-One-Block: 1\r\n"
+        "X: a value that does not end within the first block\r\n"
+        "Y:\t \t\r\nZ: v \r\n\r\n",
+        "POST /a HTTP/1.0\nX-A:\tb \n\n",
+        "GET / HTTP/1.1\r\nHost : x\r\n\r\n",
+        "GET / HTTP/1.1\r\nBad\x01: x\r\n\r\n",
+        "GET / HTTP/1.1\r\nA: b\rc\r\n\r\n",
+        "GET / HTTP/1.1\r\nA: \x7f\r\n\r\n",
+        "GET /\x01 HTTP/1.1\r\n\r\n",
+        "G@T / HTTP/1.1\r\n\r\n",
+        "GET / HTTP/1.2\r\n\r\n",
+    };
+    static const char *rsps[] = {
+        "HTTP/1.1 200 OK\r\nContent-Length: 0\r\n\r\n",
+        "HTTP/1.1 404 Not Found\r\nServer: x\r\n\r\n",
+        "HTTP/1.0 599 Custom\tReason\r\nA: b\r\n\r\n",
+        "HTTP/1.1 600 Bad\r\n\r\n",
+        "HTTP/1.1 200 O\x01K\r\n\r\n",
+        "HTTP/1.1 200 OK\r\n: empty\r\n\r\n",
+    };
+    hwire_ctx_t ctx = {.request_cb  = mock_request_cb,
+                       .response_cb = mock_response_cb,
+                       .header_cb   = mock_header_cb};
+    hwire_msginfo_t info;
+
+    for (size_t i = 0; i < sizeof(reqs) / sizeof(reqs[0]); i++) {
+        size_t len = strlen(reqs[i]);
+        for (size_t n = 0; n <= len; n++) {
+            for (size_t maxlen = 1; maxlen <= 48; maxlen++) {
+                size_t pos1 = 0, pos2 = 0;
+                int rv1 = hwire_parse_request(&ctx, reqs[i], n, &pos1, maxlen,
+                                              2);
+                int rv2 = hwire_scan_message(reqs[i], n, &pos2, maxlen, 2, 0,
+                                             &info);
+                ASSERT_EQ(rv2, rv1);
+                ASSERT_EQ(pos2, pos1);
+            }
+        }
+    }
+    for (size_t i = 0; i < sizeof(rsps) / sizeof(rsps[0]); i++) {
+        size_t len = strlen(rsps[i]);
+        for (size_t n = 0; n <= len; n++) {
+            for (size_t maxlen = 1; maxlen <= 48; maxlen++) {
+                size_t pos1 = 0, pos2 = 0;
+                int rv1 = hwire_parse_response(&ctx, rsps[i], n, &pos1, maxlen,
+                                               2);
+                int rv2 = hwire_scan_message(rsps[i], n, &pos2, maxlen, 2,
+                                             HWIRE_SCAN_RESPONSE, &info);
+                ASSERT_EQ(rv2, rv1);
+                ASSERT_EQ(pos2, pos1);
+            }
+        }
+    }
+
+    TEST_END();
+}
+
+int main(void)
+{
+    test_scan_message_request_body();
+    test_scan_message_response_body();
+    test_scan_message_keep_alive();
+    test_scan_message_parity();
+    print_test_summary();
+    return g_tests_failed;
+}
@@ -0,0 +1,214 @@
+#include "test_helpers.h"
+
+// concatenate the segments of out into buf
+static size_t gather(const hwire_iov_array_t *out, char *buf, size_t size)
+{
+    size_t len = 0;
+    for (size_t i = 0; i < out->count; i++) {
+        if (len + out->items[i].len >= size) {
+            return 0;
+        }
+        memcpy(buf + len, out->items[i].base, out->items[i].len);
+        len += out->items[i].len;
+    }
+    buf[len] = '\0';
+    return len;
+}
+
+/*
+ * Covers: request lines and status lines (RFC 9112 §3, §4).
+ * MUST: HTTP/1.1 status lines with the registered phrase MUST be one
+ *       static segment.
+ * MUST: caller slices MUST be referenced, not copied.
+ * MUST: unknown versions and out-of-range status codes MUST be rejected.
+ */
+void test_serialize_start_line(void)
+{
+    TEST_START("test_serialize_start_line");
+
+    hwire_iov_t items[8];
+    hwire_iov_array_t out = {.items = items, .size = 8};
+    char buf[TEST_BUF_SIZE];
+
+    static const struct {
+        hwire_http_version_t version;
+        uint16_t status;
+        const char *reason;
+        const char *line;
+        size_t count;
+    } cases[] = {
+        {HWIRE_HTTP_V11, 200, NULL, "HTTP/1.1 200 OK\r\n", 1},
+        {HWIRE_HTTP_V11, 431, NULL,
+         "HTTP/1.1 431 Request Header Fields Too Large\r\n", 1},
+        {HWIRE_HTTP_V10, 404, NULL, "HTTP/1.0 404 Not Found\r\n", 2},
+        {HWIRE_HTTP_V11, 299, NULL, "HTTP/1.1 299 \r\n", 3},
+        {HWIRE_HTTP_V11, 200, "Fine", "HTTP/1.1 200 Fine\r\n", 4},
+        {HWIRE_HTTP_V10, 599, "", "HTTP/1.0 599 \r\n", 3},
+        {HWIRE_HTTP_V11, 100, NULL, "HTTP/1.1 100 Continue\r\n", 1},
+    };
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        hwire_str_t reason = {0, cases[i].reason};
+        if (cases[i].reason != NULL) {
+            reason.len = strlen(cases[i].reason);
+        }
+        out.count = 0;
+        out.len   = 0;
+        ASSERT_OK(hwire_serialize_status_line(
+            &out, cases[i].version, cases[i].status,
+            cases[i].reason != NULL ? &reason : NULL));
+        ASSERT_EQ(out.count, cases[i].count);
+        ASSERT_EQ(gather(&out, buf, sizeof(buf)), out.len);
+        ASSERT(strcmp(buf, cases[i].line) == 0);
+    }
+
+    out.count = 0;
+    out.len   = 0;
+    ASSERT_EQ(hwire_serialize_status_line(&out, HWIRE_HTTP_V11, 99, NULL),
+              HWIRE_ESTATUS);
+    ASSERT_EQ(hwire_serialize_status_line(&out, HWIRE_HTTP_V11, 600, NULL),
+              HWIRE_ESTATUS);
+    ASSERT_EQ(hwire_serialize_status_line(&out, (hwire_http_version_t)0x0200,
+                                          200, NULL),
+              HWIRE_EVERSION);
+    ASSERT_EQ(out.count, 0);
+
+    // request line
+    const char target[] = "/search?q=1";
+    hwire_str_t m       = {3, "GET"};
+    hwire_str_t t       = {sizeof(target) - 1, target};
+    ASSERT_OK(hwire_serialize_request_line(&out, &m, &t, HWIRE_HTTP_V11));
+    ASSERT_EQ(out.count, 4);
+    ASSERT(items[2].base == target);
+    ASSERT_EQ(gather(&out, buf, sizeof(buf)), out.len);
+    ASSERT(strcmp(buf, "GET /search?q=1 HTTP/1.1\r\n") == 0);
+    ASSERT_EQ(hwire_serialize_request_line(&out, &m, &t,
+                                           (hwire_http_version_t)0),
+              HWIRE_EVERSION);
+    ASSERT_EQ(out.count, 4);
+
+    TEST_END();
+}
+
+static hwire_header_t g_headers[8];
+static size_t g_nheaders;
+
+static int collect_header_cb(hwire_ctx_t *ctx, hwire_header_t *header)
+{
+    (void)ctx;
+    if (g_nheaders >= 8) {
+        return 1;
+    }
+    g_headers[g_nheaders++] = *header;
+    return 0;
+}
+
+/*
+ * Covers: re-emitting parsed fields and adding new ones.
+ * MUST: parsed "name: value" lines MUST be referenced in place.
+ * MUST: the CRLF of the last field and the empty line MUST share a segment.
+ * MUST: the serialized head MUST parse back to the same fields.
+ */
+void test_serialize_headers(void)
+{
+    TEST_START("test_serialize_headers");
+
+    static const char in[] = "HTTP/1.1 200 OK\r\n"
+                             "Content-Type: text/plain\r\n"
+                             "Server:hwire\r\n"
+                             "Empty: \r\n"
+                             "Content-Length: 3\r\n"
+                             "\r\n";
+    hwire_ctx_t ctx        = {.response_cb = mock_response_cb,
+                              .header_cb   = collect_header_cb};
+    size_t pos             = 0;
+    g_nheaders             = 0;
+    ASSERT_OK(hwire_parse_response(&ctx, in, sizeof(in) - 1, &pos, 256, 8));
+    ASSERT_EQ(g_nheaders, 4);
+
+    hwire_iov_t items[16];
+    hwire_iov_array_t out = {.items = items, .size = 16};
+    hwire_str_t via_k     = {3, "Via"};
+    hwire_str_t via_v     = {9, "1.1 hwire"};
+    char buf[TEST_BUF_SIZE];
+
+    ASSERT_OK(hwire_serialize_status_line(&out, HWIRE_HTTP_V11, 200, NULL));
+    ASSERT_OK(hwire_serialize_headers(&out, g_headers, g_nheaders));
+    ASSERT_OK(hwire_serialize_header(&out, &via_k, &via_v));
+    ASSERT_OK(hwire_serialize_end(&out));
+
+    ASSERT_EQ(gather(&out, buf, sizeof(buf)), out.len);
+    ASSERT(strcmp(buf, "HTTP/1.1 200 OK\r\n"
+                       "Content-Type: text/plain\r\n"
+                       "Server: hwire\r\n"
+                       "Empty: \r\n"
+                       "Content-Length: 3\r\n"
+                       "Via: 1.1 hwire\r\n"
+                       "\r\n") == 0);
+    // "Content-Type: text/plain" is one slice of the input
+    ASSERT(items[1].base == in + 17);
+    ASSERT_EQ(items[1].len, 24);
+    ASSERT_EQ(items[out.count - 1].len, 4);
+    // status 1 + Content-Type 2 + Server 4 + Empty 2 + Content-Length 2 +
+    // Via 4 (its CRLF merged with the empty line)
+    ASSERT_EQ(out.count, 15);
+
+    // round trip
+    size_t len = out.len;
+    g_nheaders = 0;
+    ASSERT_OK(hwire_parse_response(&ctx, buf, len, &pos, 256, 8));
+    ASSERT_EQ(pos, len);
+    ASSERT_EQ(g_nheaders, 5);
+
+    TEST_END();
+}
+
+/*
+ * Covers: running out of segments.
+ * MUST: a call that does not fit MUST return HWIRE_ENOBUFS and leave the
+ *       array unchanged.
+ */
+void test_serialize_enobufs(void)
+{
+    TEST_START("test_serialize_enobufs");
+
+    hwire_iov_t items[3];
+    hwire_iov_array_t out = {.items = items, .size = 3};
+    hwire_header_t h[2]   = {{{1, "A"}, {1, "1"}, 0}, {{1, "B"}, {1, "2"}, 0}};
+
+    ASSERT_OK(hwire_serialize_status_line(&out, HWIRE_HTTP_V11, 204, NULL));
+    ASSERT_EQ(hwire_serialize_headers(&out, h, 2), HWIRE_ENOBUFS);
+    ASSERT_EQ(out.count, 1);
+    ASSERT_EQ(out.len, 25);
+    ASSERT_EQ(hwire_serialize_header(&out, &h[0].key, &h[0].value),
+              HWIRE_ENOBUFS);
+    ASSERT_EQ(out.count, 1);
+
+    // the empty line still fits
+    ASSERT_OK(hwire_serialize_end(&out));
+    ASSERT_EQ(out.count, 2);
+    ASSERT_EQ(out.len, 27);
+
+    // a merge into the last segment is undone as well
+    static const char line[] = "abcA";
+    hwire_str_t name         = {1, line + 3};
+    out                      = (hwire_iov_array_t){.items = items, .size = 1};
+    items[0]                 = (hwire_iov_t){.base = line, .len = 3};
+    out.count                = 1;
+    out.len                  = 3;
+    ASSERT_EQ(hwire_serialize_header(&out, &name, &h[0].value),
+              HWIRE_ENOBUFS);
+    ASSERT_EQ(out.count, 1);
+    ASSERT_EQ(items[0].len, 3);
+    ASSERT_EQ(out.len, 3);
+
+    TEST_END();
+}
+
+int main(void)
+{
+    test_serialize_start_line();
+    test_serialize_headers();
+    test_serialize_enobufs();
+    print_test_summary();
+    return g_tests_failed;
+}
@@ -0,0 +1,324 @@
+#include "test_helpers.h"
+
+/*
+ * Covers: RFC 6455 §4.2.2 Sec-WebSocket-Accept.
+ * MUST: the accept value MUST match the example of RFC 6455 §1.3.
+ * MUST: a key that is not the base64 encoding of 16 bytes MUST return
+ *       HWIRE_EILSEQ.
+ */
+void test_ws_accept(void)
+{
+    TEST_START("test_ws_accept");
+
+    static const struct {
+        const char *key;
+        const char *accept;
+    } cases[] = {
+        {"dGhlIHNhbXBsZSBub25jZQ==", "s3pPLMBiTxaQ9kYGzzhZRbK+xOo="},
+        {"AAAAAAAAAAAAAAAAAAAAAA==", "ICX+Yqv66kxgM0FcWaLWlFLwTAI="},
+        {"x3JJHMbDL1EzLkh9GBhXDw==", "HSmrc0sMlYUkAGmm5OPpG2HaGWk="},
+    };
+    char accept[HWIRE_WS_ACCEPT_LEN + 1];
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        accept[HWIRE_WS_ACCEPT_LEN] = '\0';
+        ASSERT_OK(hwire_ws_accept(cases[i].key, strlen(cases[i].key),
+                                  accept));
+        ASSERT(strcmp(accept, cases[i].accept) == 0);
+    }
+
+    static const char *const invalid[] = {
+        "",
+        "dGhlIHNhbXBsZSBub25jZQ=",
+        "dGhlIHNhbXBsZSBub25jZQ===",
+        "dGhlIHNhbXBsZSBub25jZQ",
+        "dGhlIHNhbXBsZSBub25jZ===",
+        "dGhlIHNhbXBsZSBub25jZR==",
+        "dGhlIHNhbXBsZSBub2 jZQ==",
+        "dGhlIHNhbXBsZSBub2-jZQ==",
+        "dGhlIHNhbXBsZSBub25jZQ=x",
+    };
+    for (size_t i = 0; i < sizeof(invalid) / sizeof(invalid[0]); i++) {
+        ASSERT_EQ(hwire_ws_accept(invalid[i], strlen(invalid[i]), accept),
+                  HWIRE_EILSEQ);
+    }
+
+    TEST_END();
+}
+
+/*
+ * Covers: RFC 6455 §4.2.1 opening handshake request.
+ * MUST: Upgrade, Connection, Sec-WebSocket-Version and Sec-WebSocket-Key
+ *       MUST be checked from the header index and framing flags.
+ * MUST: a missing or unsupported version MUST return HWIRE_EVERSION.
+ */
+void test_ws_handshake(void)
+{
+    TEST_START("test_ws_handshake");
+
+    static const struct {
+        const char *headers;
+        int rv;
+    } cases[] = {
+        {"Host: server.example.com\r\n"
+         "Upgrade: websocket\r\n"
+         "Connection: Upgrade\r\n"
+         "Sec-WebSocket-Key: dGhlIHNhbXBsZSBub25jZQ==\r\n"
+         "Origin: http://example.com\r\n"
+         "Sec-WebSocket-Version: 13\r\n"
+         "\r\n",
+         HWIRE_OK},
+        {"upgrade: WebSocket\r\n"
+         "connection: keep-alive, Upgrade\r\n"
+         "sec-websocket-version:13\r\n"
+         "sec-websocket-key:   dGhlIHNhbXBsZSBub25jZQ==  \r\n"
+         "\r\n",
+         HWIRE_OK},
+        {"Connection: Upgrade\r\n"
+         "Sec-WebSocket-Version: 13\r\n"
+         "Sec-WebSocket-Key: dGhlIHNhbXBsZSBub25jZQ==\r\n"
+         "\r\n",
+         HWIRE_EHDRVALUE},
+        {"Upgrade: websocket\r\n"
+         "Sec-WebSocket-Version: 13\r\n"
+         "Sec-WebSocket-Key: dGhlIHNhbXBsZSBub25jZQ==\r\n"
+         "\r\n",
+         HWIRE_EHDRVALUE},
+        {"Upgrade: h2c\r\n"
+         "Connection: Upgrade\r\n"
+         "Sec-WebSocket-Version: 13\r\n"
+         "Sec-WebSocket-Key: dGhlIHNhbXBsZSBub25jZQ==\r\n"
+         "\r\n",
+         HWIRE_EHDRVALUE},
+        {"Upgrade: websocket\r\n"
+         "Connection: Upgrade\r\n"
+         "Sec-WebSocket-Key: dGhlIHNhbXBsZSBub25jZQ==\r\n"
+         "\r\n",
+         HWIRE_EVERSION},
+        {"Upgrade: websocket\r\n"
+         "Connection: Upgrade\r\n"
+         "Sec-WebSocket-Version: 8\r\n"
+         "Sec-WebSocket-Key: dGhlIHNhbXBsZSBub25jZQ==\r\n"
+         "\r\n",
+         HWIRE_EVERSION},
+        {"Upgrade: websocket\r\n"
+         "Connection: Upgrade\r\n"
+         "Sec-WebSocket-Version: 13\r\n"
+         "\r\n",
+         HWIRE_EHDRVALUE},
+        {"Upgrade: websocket\r\n"
+         "Connection: Upgrade\r\n"
+         "Sec-WebSocket-Version: 13\r\n"
+         "Sec-WebSocket-Key: dGhlIHNhbXBsZSBub25jZQ==\r\n"
+         "Sec-WebSocket-Key: dGhlIHNhbXBsZSBub25jZQ==\r\n"
+         "\r\n",
+         HWIRE_EHDRVALUE},
+        {"Upgrade: websocket\r\n"
+         "Connection: Upgrade\r\n"
+         "Sec-WebSocket-Version: 13\r\n"
+         "Sec-WebSocket-Key: c2hvcnQ=\r\n"
+         "\r\n",
+         HWIRE_EHDRVALUE},
+    };
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        hdr_index_fixture_t f;
+        hwire_framing_t fr = {0};
+        const char *h      = cases[i].headers;
+        char accept[HWIRE_WS_ACCEPT_LEN];
+        size_t pos = 0;
+
+        hdr_index_fixture_init(&f, 0);
+        f.ctx.framing = &fr;
+        ASSERT_OK(hwire_parse_headers(&f.ctx, h, strlen(h), &pos, 256,
+                                      TEST_NENTRIES));
+        ASSERT_EQ(hwire_ws_handshake(&f.ctx, accept), cases[i].rv);
+        if (cases[i].rv == HWIRE_OK) {
+            ASSERT(memcmp(accept, "s3pPLMBiTxaQ9kYGzzhZRbK+xOo=",
+                          HWIRE_WS_ACCEPT_LEN) == 0);
+        }
+    }
+
+    TEST_END();
+}
+
+/*
+ * Covers: RFC 6455 §5.2 base framing and the examples of §5.7.
+ * MUST: FIN, RSV, opcode, MASK, the 7/16/64-bit lengths and the masking key
+ *       MUST be decoded.
+ * MUST: every truncated header MUST return HWIRE_EAGAIN.
+ */
+void test_ws_parse_frame(void)
+{
+    TEST_START("test_ws_parse_frame");
+
+    static const struct {
+        const char *frame;
+        size_t hlen;
+        uint64_t len;
+        uint8_t flags;
+        uint8_t opcode;
+    } cases[] = {
+        // single-frame unmasked text message
+        {"\x81\x05Hello", 2, 5, HWIRE_WS_FIN, HWIRE_WS_TEXT},
+        // single-frame masked text message
+        {"\x81\x85\x37\xfa\x21\x3d\x7f\x9f\x4d\x51\x58", 6, 5,
+         HWIRE_WS_FIN | HWIRE_WS_MASKED, HWIRE_WS_TEXT},
+        // fragmented unmasked text message
+        {"\x01\x03Hel", 2, 3, 0, HWIRE_WS_TEXT},
+        {"\x80\x02lo", 2, 2, HWIRE_WS_FIN, HWIRE_WS_CONTINUATION},
+        // unmasked ping and masked pong
+        {"\x89\x05Hello", 2, 5, HWIRE_WS_FIN, HWIRE_WS_PING},
+        {"\x8a\x85\x37\xfa\x21\x3d\x7f\x9f\x4d\x51\x58", 6, 5,
+         HWIRE_WS_FIN | HWIRE_WS_MASKED, HWIRE_WS_PONG},
+        // 256 bytes and 64 KiB binary messages
+        {"\x82\x7E\x01\x00", 4, 256, HWIRE_WS_FIN, HWIRE_WS_BINARY},
+        {"\x82\x7F\x00\x00\x00\x00\x00\x01\x00\x00", 10, 65536, HWIRE_WS_FIN,
+         HWIRE_WS_BINARY},
+        // masked 16-bit length, RSV1 (e.g. permessage-deflate)
+        {"\xc2\xfe\x00\x7e\x01\x02\x03\x04", 8, 126,
+         HWIRE_WS_FIN | HWIRE_WS_RSV1 | HWIRE_WS_MASKED, HWIRE_WS_BINARY},
+        {"\xf8\x00", 2, 0,
+         HWIRE_WS_FIN | HWIRE_WS_RSV1 | HWIRE_WS_RSV2 | HWIRE_WS_RSV3,
+         HWIRE_WS_CLOSE},
+        // a control frame of 125 bytes
+        {"\x88\x7d", 2, 125, HWIRE_WS_FIN, HWIRE_WS_CLOSE},
+    };
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        const char *s      = cases[i].frame;
+        hwire_ws_frame_t f = {0};
+        size_t pos         = 0;
+
+        for (size_t n = 0; n < cases[i].hlen; n++) {
+            ASSERT_EQ(hwire_ws_parse_frame(s, n, &pos, UINT64_MAX, &f),
+                      HWIRE_EAGAIN);
+        }
+        ASSERT_OK(hwire_ws_parse_frame(s, cases[i].hlen, &pos, UINT64_MAX,
+                                       &f));
+        ASSERT_EQ(pos, cases[i].hlen);
+        ASSERT_EQ(f.len, cases[i].len);
+        ASSERT_EQ(f.flags, cases[i].flags);
+        ASSERT_EQ(f.opcode, cases[i].opcode);
+        if (f.flags & HWIRE_WS_MASKED) {
+            ASSERT(memcmp(f.mask, s + pos - 4, 4) == 0);
+        }
+    }
+
+    // masked "Hello"
+    {
+        char frame[] = "\x81\x85\x37\xfa\x21\x3d\x7f\x9f\x4d\x51\x58";
+        hwire_ws_frame_t f;
+        size_t pos = 0;
+        ASSERT_OK(hwire_ws_parse_frame(frame, 11, &pos, 125, &f));
+        hwire_ws_unmask(frame + pos, (size_t)f.len, f.mask, 0);
+        ASSERT(memcmp(frame + pos, "Hello", 5) == 0);
+    }
+
+    TEST_END();
+}
+
+/*
+ * Covers: invalid frame headers.
+ * MUST: reserved opcodes, fragmented or long control frames and lengths not
+ *       in their shortest form MUST return HWIRE_EILSEQ.
+ * MUST: a payload longer than maxlen MUST return HWIRE_ELEN.
+ */
+void test_ws_parse_frame_errors(void)
+{
+    TEST_START("test_ws_parse_frame_errors");
+
+    static const struct {
+        const char *frame;
+        size_t len;
+        int rv;
+    } cases[] = {
+        {"\x83\x00", 2, HWIRE_EILSEQ},
+        {"\x87\x00", 2, HWIRE_EILSEQ},
+        {"\x8b\x00", 2, HWIRE_EILSEQ},
+        {"\x8f\x00", 2, HWIRE_EILSEQ},
+        {"\x09\x00", 2, HWIRE_EILSEQ},
+        {"\x88\x7e\x00\x7e", 4, HWIRE_EILSEQ},
+        {"\x82\x7e\x00\x7d", 4, HWIRE_EILSEQ},
+        {"\x82\x7f\x00\x00\x00\x00\x00\x00\xff\xff", 10, HWIRE_EILSEQ},
+        {"\x82\x7f\x80\x00\x00\x00\x00\x00\x00\x00", 10, HWIRE_EILSEQ},
+        {"\x82\x7e\x04\x01", 4, HWIRE_ELEN},
+        {"\x82\xff\x00\x00\x00\x00\x00\x01\x00\x00", 10, HWIRE_ELEN},
+        {"\x82\x7e\x04\x00", 4, HWIRE_OK},
+    };
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        hwire_ws_frame_t f;
+        size_t pos = SIZE_MAX;
+        ASSERT_EQ(hwire_ws_parse_frame(cases[i].frame, cases[i].len, &pos,
+                                       1024, &f),
+                  cases[i].rv);
+        ASSERT_EQ(pos, cases[i].rv == HWIRE_OK ? cases[i].len : SIZE_MAX);
+    }
+
+    TEST_END();
+}
+
+/*
+ * Covers: RFC 6455 §5.3 masking.
+ * MUST: the vectorized XOR MUST match the byte-wise definition for every
+ *       length, alignment and key phase.
+ * MUST: unmasking in pieces with their payload offset MUST equal unmasking
+ *       at once.
+ */
+void test_ws_unmask(void)
+{
+    TEST_START("test_ws_unmask");
+
+    static const uint8_t mask[4] = {0x37, 0xfa, 0x21, 0x3d};
+    static char data[512];
+    static char ref[512];
+
+    for (size_t i = 0; i < sizeof(data); i++) {
+        data[i] = (char)(i * 131 + 7);
+    }
+    for (size_t align = 0; align < 4; align++) {
+        for (size_t len = 0; len + align <= 300; len++) {
+            for (uint64_t off = 0; off < 4; off++) {
+                char *p = data + align;
+                memcpy(ref, p, len);
+                for (size_t i = 0; i < len; i++) {
+                    ref[i] ^= (char)mask[(off + i) % 4];
+                }
+                hwire_ws_unmask(p, len, mask, off);
+                ASSERT(memcmp(p, ref, len) == 0);
+                // XOR is its own inverse; restores data for the next case
+                hwire_ws_unmask(p, len, mask, off + 4);
+                for (size_t i = 0; i < len; i++) {
+                    ASSERT((char)(p[i] ^ ref[i]) == (char)mask[(off + i) % 4]);
+                }
+            }
+        }
+    }
+
+    // in pieces
+    memcpy(ref, data, sizeof(data));
+    hwire_ws_unmask(ref, sizeof(ref), mask, 0);
+    for (size_t step = 1; step < 100; step += 7) {
+        char buf[512];
+        memcpy(buf, data, sizeof(buf));
+        for (size_t off = 0; off < sizeof(buf); off += step) {
+            size_t n = (off + step > sizeof(buf)) ? sizeof(buf) - off : step;
+            hwire_ws_unmask(buf + off, n, mask, off);
+        }
+        ASSERT(memcmp(buf, ref, sizeof(buf)) == 0);
+    }
+
+    TEST_END();
+}
+
+int main(void)
+{
+    test_ws_accept();
+    test_ws_handshake();
+    test_ws_parse_frame();
+    test_ws_parse_frame_errors();
+    test_ws_unmask();
+    print_test_summary();
+    return g_tests_failed;
+}